@@ -0,0 +1,46 @@
+#pragma once
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Single entry point for asset paths ("assets/levels/zone1_level1.json"), shared by every loader.
+// Mount table, searched in order: the baked asset pack (AssetPack, when open), then the asset
+// roots found once at startup (project source directory, working directory, build output
+// directories). Each mounted directory's assets/ tree is indexed when mounted, so a lookup is
+// a hash lookup instead of filesystem probing on every load.
+class AssetFileSystem {
+public:
+    static AssetFileSystem& getInstance();
+
+    // Opens the pack as the first mount (false when absent: loose files only)
+    bool mountPack(const std::string& packPath);
+    // Indexes root/assets; files already provided by an earlier mount keep it
+    void mountDirectory(const std::string& root);
+
+    // Loose file behind an asset path. Pack entries, absolute and unknown paths come back unchanged
+    std::string resolve(const std::string& path) const;
+    // In the pack or in a mounted directory
+    bool exists(const std::string& path) const;
+
+    // Where a tool writes an asset (editor save): the project source tree when found, so edits
+    // survive a rebuild, the directory already holding the file otherwise
+    std::string getWritablePath(const std::string& path) const;
+    // Points `path` at a file written at runtime (editor save)
+    void addFile(const std::string& path, const std::string& looseFile);
+
+    const std::vector<std::string>& getRoots() const { return roots; }
+
+private:
+    AssetFileSystem();
+    AssetFileSystem(const AssetFileSystem&) = delete;
+    AssetFileSystem& operator=(const AssetFileSystem&) = delete;
+
+    static std::string normalize(const std::string& path);
+
+    std::vector<std::string> roots;                       // Mounted directories, in search order
+    std::string sourceRoot;                               // PlatformerGame source directory (empty when not found)
+    std::unordered_map<std::string, std::string> files;   // "assets/..." -> loose file
+    mutable std::mutex mutex;                             // LevelPrefetcher resolves from its thread
+};
@@ -0,0 +1,88 @@
+#pragma once
+
+#include "core/MappedFile.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+
+// Read-only view over the baked asset pack (assets.pack, written by PlatformerPack).
+// The file is memory-mapped once; entries are keyed by their loose path
+// ("assets/levels/zone1_level1.json"). Images are stored decoded (RGBA8), everything
+// else as raw bytes. Views point straight into the mapping and stay valid until close().
+// When no pack is open every lookup misses and callers read loose files (development).
+class AssetPack {
+public:
+    // On-disk layout, shared with the packer:
+    //   Header | IndexEntry + name bytes (x entryCount) | data blobs (DATA_ALIGNMENT aligned)
+    static constexpr std::uint32_t MAGIC = 0x4B504750;   // "PGPK" little-endian
+    static constexpr std::uint32_t VERSION = 1;
+    static constexpr std::uint64_t DATA_ALIGNMENT = 16;
+
+    enum class EntryType : std::uint32_t {
+        Raw = 0,
+        Image = 1    // width * height * 4 bytes, RGBA8, rows top to bottom
+    };
+
+    struct Header {
+        std::uint32_t magic;
+        std::uint32_t version;
+        std::uint32_t entryCount;
+        std::uint32_t reserved;
+    };
+
+    struct IndexEntry {
+        std::uint64_t offset;       // From the start of the file
+        std::uint64_t size;
+        std::uint32_t type;         // EntryType
+        std::uint32_t width;        // Images only
+        std::uint32_t height;
+        std::uint32_t nameLength;   // Name bytes follow the entry (no terminator)
+    };
+
+    struct DataView {
+        const std::uint8_t* data = nullptr;
+        std::size_t size = 0;
+    };
+
+    struct ImageView {
+        const std::uint8_t* pixels = nullptr;
+        unsigned int width = 0;
+        unsigned int height = 0;
+    };
+
+    static AssetPack& getInstance();
+
+    AssetPack(const AssetPack&) = delete;
+    AssetPack& operator=(const AssetPack&) = delete;
+
+    bool open(const std::string& path);
+    void close();
+    bool isOpen() const { return file.isOpen(); }
+
+    bool contains(const std::string& path) const;
+    bool findData(const std::string& path, DataView& out) const;
+    bool findImage(const std::string& path, ImageView& out) const;
+    std::size_t getEntryCount() const { return entries.size(); }
+
+    // Key used in the index: forward slashes, no leading "./"
+    static std::string normalizeKey(const std::string& path);
+
+private:
+    AssetPack() = default;
+    ~AssetPack();
+
+    struct Record {
+        EntryType type;
+        std::uint64_t offset;
+        std::uint64_t size;
+        std::uint32_t width;
+        std::uint32_t height;
+    };
+
+    const Record* find(const std::string& path) const;
+    bool readIndex();
+
+    MappedFile file;
+    std::unordered_map<std::string, Record> entries;
+};
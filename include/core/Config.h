@@ -1,11 +1,25 @@
 #pragma once
 
+#include <cstddef>
+
 namespace Config {
     // Window settings
     constexpr unsigned int WINDOW_WIDTH = 1280;
     constexpr unsigned int WINDOW_HEIGHT = 720;
     constexpr const char* WINDOW_TITLE = "Platformer Game - MVP";
-    constexpr unsigned int FRAMERATE_LIMIT = 60;
+    constexpr unsigned int FRAMERATE_LIMIT = 60;         // Render cap (0 = uncapped, simulation stays fixed)
+    constexpr bool USE_RENDER_THREAD = true;             // Gameplay frames drawn on a second thread from snapshots
+    constexpr bool MENU_RENDER_ON_CHANGE = true;         // Menus wait for input and redraw only when they change
+    constexpr int MENU_IDLE_POLL_MS = 10;                // Event check interval while a menu waits (input latency)
+    constexpr int MENU_IDLE_TIMEOUT_MS = 250;            // Max wait before the menu state is updated anyway
+
+    // Assets
+    constexpr const char* ASSET_PACK_PATH = "assets.pack";  // Built by PlatformerPack; loose files when absent
+
+    // Simulation loop (fixed timestep, rendering interpolates between ticks)
+    constexpr unsigned int SIMULATION_TICK_RATE = 60;    // Simulation ticks per second
+    constexpr int MAX_SIMULATION_STEPS = 5;              // Max catch-up ticks per rendered frame
+    constexpr float INTERPOLATION_SNAP_DISTANCE = 128.0f; // Teleports (respawn, portals) are not interpolated
 
     // Game constants
     constexpr float GRAVITY = 980.0f;           // pixels/s²
@@ -21,9 +35,15 @@ namespace Config {
 
     // Platform settings
     constexpr float PLATFORM_HEIGHT = 20.0f;
+    constexpr float PLATFORM_QUERY_MARGIN = 64.0f;  // Broad-phase padding around the player (covers collision pushes)
 
     // Camera settings
     constexpr float CAMERA_SMOOTHING = 0.1f;
+    constexpr float RENDER_CULL_MARGIN = 128.0f;   // Off-screen padding for render culling (sprites overhang hitboxes)
+
+    // Particles
+    constexpr std::size_t PARTICLE_CAPACITY = 8192;     // Hard cap of live particles (storage allocated once)
+    constexpr float PARTICLE_BUDGET_SOFT_LIMIT = 0.75f; // Past this fill ratio, bursts shrink with the free room
 
     // Death settings
     constexpr float DEATH_ZONE_Y = 800.0f;      // Y position below which player dies (just below screen)
@@ -33,6 +53,13 @@ namespace Config {
     constexpr bool SHOW_FPS = true;
     constexpr bool SHOW_COLLISION_BOXES = false;
     constexpr bool SHOW_HITBOXES = false;  // Default off, toggle with key
+    constexpr int PROFILER_HISTORY_FRAMES = 600;   // Frames kept by the profiler ring buffer (~10s)
+    constexpr int PROFILER_GRAPH_FRAMES = 240;     // Frames drawn by the overlay graph
+    constexpr float PROFILER_GRAPH_MAX_MS = 33.3f; // Graph height in milliseconds
+    constexpr std::size_t LEVEL_PREFETCH_MAX_BYTES = 8 * 1024 * 1024; // Parsed neighbouring levels kept in memory
+    constexpr std::size_t LEVEL_CACHE_CAPACITY = 8;    // Parsed levels kept for revisits and respawns (LRU)
+    constexpr int SECTOR_ACTIVE_RADIUS = 1;            // Sectors simulated around the player (levels with a sectorSize)
+    constexpr int SECTOR_EVICT_RADIUS = 2;             // Active sectors go back to sleep beyond this distance
 
     // Special abilities
     constexpr float KINETIC_WAVE_RANGE = 150.0f;      // Lyra's kinetic wave range
@@ -60,7 +87,7 @@ namespace Config {
     constexpr float DASH_COOLDOWN = 1.0f;              // Dash cooldown in seconds
 
     // Gameplay constants
-    constexpr float MAX_DELTA_TIME = 0.1f;            // Cap delta time to avoid spiral of death
+    constexpr float MAX_DELTA_TIME = 0.1f;            // Cap frame time fed to the tick accumulator
     constexpr float STOMP_TOLERANCE_BASE = 10.0f;     // Base tolerance for stomp detection
     constexpr float KINETIC_WAVE_DOT_THRESHOLD = 0.3f; // Dot product threshold for kinetic wave direction
     constexpr float ENEMY_BOUNCE_VELOCITY = -300.0f;   // Bounce velocity when stomping enemy
@@ -7,19 +7,17 @@
 #include <vector>
 #include "core/GameState.h"
 #include "core/SaveSystem.h"
+#include "graphics/SpriteManager.h"
 
 // Forward declarations to reduce compile-time coupling
+class Entity;
 class Player;
-class Enemy;
-class KineticWaveProjectile;
-class EnemyProjectile;
-class Platform;
 class Camera;
-class Checkpoint;
-class InteractiveObject;
+class World;
+struct VisibleSet;
 struct LevelData;
+struct EditorContext;
 class GameUI;
-class ParticleSystem;
 class CameraShake;
 class ScreenTransition;
 class AudioManager;
@@ -30,6 +28,13 @@ class KeyBindingMenu;
 class EditorController;
 class CheckpointManager;
 class SaveManager;
+class BackgroundLayer;
+class PlatformRenderer;
+class RenderQueue;
+class RenderThread;
+class LevelPrefetcher;
+class Menu;
+struct FrameSnapshot;
 
 class Game {
 public:
@@ -40,20 +45,37 @@ public:
 
 private:
     void processEvents();
+    void handleEvent(const sf::Event& event);
+
+    // Menu states (title, pause, settings, controls): redraw only on change
+    Menu* getActiveMenu() const;
+    void runMenuFrame();
+    bool waitForEvent(sf::Time timeout);   // Handles the first event; false on timeout
     void update(float dt);
-    void render();
+    void render(float alpha);
+    void submitWorld(RenderQueue& queue, float alpha);
+    void submitInterpolated(RenderQueue& queue, Entity& entity, float alpha);
+    bool canRenderThreaded() const;
+    void publishFrame(float alpha);            // Build and hand a snapshot to the render thread
+    void drawFrame(FrameSnapshot& snapshot);   // Render thread side
+    void drawFps(sf::RenderTarget& target, int fps);
+    void collectVisible();   // Fill visibleSet from the view currently applied to the window
 
     void handleInput();
     void loadLevel();
     void loadLevel(const std::string& levelPath);
+    void prefetchNeighbours();   // Queue the levels reachable from the current one
     void goBackOneLevel();
     
     // Background rendering
     void drawParallaxBackground(sf::RenderWindow& window);
+    void rebuildBackground();
+    void drawPlatforms(sf::RenderWindow& window);
 
     // Helper to get active player
-    Player* getActivePlayer() { return activePlayerIndex < players.size() ? players[activePlayerIndex].get() : nullptr; }
+    Player* getActivePlayer() const;
     void switchCharacter();
+    EditorContext makeEditorContext();
 
     // Menu actions
     void startNewGame();
@@ -65,19 +87,13 @@ private:
     sf::RenderWindow window;
     sf::Clock clock;
 
-    std::vector<std::unique_ptr<Player>> players;
-    int activePlayerIndex;
-    std::vector<std::unique_ptr<Platform>> platforms;
-    std::vector<std::unique_ptr<Checkpoint>> checkpoints;
-    std::vector<std::unique_ptr<InteractiveObject>> interactiveObjects;
-    std::vector<std::unique_ptr<Enemy>> enemies;
-    std::vector<std::unique_ptr<KineticWaveProjectile>> kineticWaveProjectiles;
-    std::vector<std::unique_ptr<EnemyProjectile>> enemyProjectiles;
+    // Simulation state (players, level entities, projectiles, particles)
+    std::unique_ptr<World> world;
+    std::unique_ptr<VisibleSet> visibleSet;   // Render culling scratch, refilled every frame
     std::unique_ptr<Camera> camera;
     std::unique_ptr<GameUI> gameUI;
 
     // Level system
-    std::unique_ptr<LevelData> currentLevel;
     std::string currentLevelPath;
     std::string activeCheckpointId;
     std::vector<std::string> levelHistory;
@@ -95,11 +111,11 @@ private:
     sf::Vector2f pendingPortalCustomSpawnPos;
 
     // Polish systems
-    std::unique_ptr<ParticleSystem> particleSystem;
     std::unique_ptr<CameraShake> cameraShake;
     
     // Debug
     bool showHitboxes = false;
+    bool showProfiler = false;
     std::unique_ptr<AudioManager> audioManager;
     std::unique_ptr<ScreenTransition> screenTransition;
 
@@ -109,7 +125,8 @@ private:
     SaveData saveData;
 
     bool isRunning;
-    bool playerWasDead;
+    bool redrawRequested = true;                 // Window resized / refocused: menus draw again
+    GameState lastRenderedState = GameState::TitleScreen;
     bool levelCompleted;
     bool victoryEffectsTriggered;
     bool isTransitioning;
@@ -128,21 +145,23 @@ private:
     std::unique_ptr<SaveManager> saveManager;
 
     // Background walls
-    sf::Texture* bgWallPlain32;
-    sf::Texture* bgWallCables32;
+    SpriteFrame bgWallPlain32;      // Wall tiles live in the sprite atlas (trimmed)
+    SpriteFrame bgWallCables32;
     sf::Texture* bgFarTexture;
-    sf::Texture* bgWallPlainVarA32;
-    sf::Texture* bgWallPlainVarB32;
-    sf::Texture* bgWallCablesAlt32;
+    SpriteFrame bgWallPlainVarA32;
+    SpriteFrame bgWallPlainVarB32;
+    SpriteFrame bgWallCablesAlt32;
+    std::unique_ptr<BackgroundLayer> backgroundLayer;   // Wall tiles baked per level
+    std::unique_ptr<PlatformRenderer> platformRenderer; // Platforms merged into chunk vertex arrays
+    std::unique_ptr<RenderQueue> renderQueue;           // World entities, sorted and batched per frame
+    std::unique_ptr<RenderThread> renderThread;         // Draws gameplay frames while the next tick runs
+    std::unique_ptr<LevelPrefetcher> levelPrefetcher;   // Parses neighbouring levels in the background
     
     // Debug
     sf::Font debugFont;
     sf::Text fpsText;
     float fpsUpdateTime;
     int frameCount;
-
-    // Per-frame input / ability state that used to be static locals in update()
-    bool doorKeyHeld = false;
-    float lastAbilityTimer = 0.0f;
-
+    int fpsValue;     // Last measured frame rate
+    int fpsShown;     // Value fpsText was formatted for
 };
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include "graphics/RenderQueue.h"
+#include "ui/GameUI.h"
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+// Everything the render thread needs to draw one gameplay frame, built by the main thread
+// after the simulation ticks. Immutable once published: entity transforms and animation
+// frames are baked into the queued vertices, particle buffers are copied into the queue.
+struct FrameSnapshot {
+    sf::Color clearColor;
+    sf::View worldView;            // Interpolated camera view
+    RenderQueue entities;          // Emptied by the flush on the render thread
+    GameUI::HudValues hud;
+    int fps = 0;
+
+    // Written by the render thread while drawing, read back by the main thread the next time
+    // it acquires this slot: the render thread never touches the Profiler itself
+    struct DrawStats {
+        bool drawn = false;
+        float backgroundMs = 0.0f;
+        float platformsMs = 0.0f;
+        float entitiesMs = 0.0f;   // RenderQueue flush
+        float uiMs = 0.0f;
+        RenderQueue::Stats queue;
+    };
+    DrawStats drawStats;
+};
+
+// Draws gameplay frames on a dedicated thread while the main thread simulates the next one.
+// Two snapshot slots: the main thread fills one while the render thread draws the other.
+// publish() waits for the previous snapshot to be picked up, so the simulation runs at most
+// one frame ahead and the frame rate limit (applied by display()) still paces the game loop.
+// The window's GL context belongs to the render thread between start() and stop().
+class RenderThread {
+public:
+    using DrawFunction = std::function<void(FrameSnapshot&)>;
+
+    RenderThread() = default;
+    ~RenderThread();
+
+    RenderThread(const RenderThread&) = delete;
+    RenderThread& operator=(const RenderThread&) = delete;
+
+    // Hands the window over to a new thread that calls `draw` for every published snapshot
+    void start(sf::RenderWindow& window, DrawFunction draw);
+    // Waits for the frame being drawn, joins, and gives the window back to the caller
+    void stop();
+    bool isRunning() const { return running; }
+
+    // Slot to fill for the next frame (never the one being drawn). Its drawStats still hold
+    // the frame drawn from it two frames ago
+    FrameSnapshot& acquire() { return slots[writeIndex]; }
+    // Hands the acquired slot to the render thread
+    void publish();
+
+private:
+    void threadMain();
+
+    sf::RenderWindow* window = nullptr;
+    DrawFunction drawFunction;
+    std::thread thread;
+    bool running = false;
+
+    FrameSnapshot slots[2];
+    int writeIndex = 0;      // Main thread only
+    int readyIndex = -1;     // Published, not picked up yet
+    int drawingIndex = -1;   // Being drawn by the render thread
+    bool stopRequested = false;
+    std::mutex mutex;
+    std::condition_variable changed;
+};
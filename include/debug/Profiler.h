@@ -0,0 +1,112 @@
+#pragma once
+
+#include "core/Config.h"
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <string>
+
+// Per-frame phase profiler (singleton).
+// Scoped zones accumulate milliseconds into the current frame; finished frames
+// go into a fixed ring buffer that the overlay draws and exportCSV dumps.
+class Profiler {
+public:
+    enum Phase {
+        // Simulation (World / Game::update)
+        PlayerCollision,
+        EnemyGrid,
+        KineticWave,
+        EnemyProjectiles,
+        Enemies,
+        Particles,
+        CameraUpdate,
+        // Rendering (Game::render)
+        RenderBackground,
+        RenderPlatforms,
+        RenderEntities,
+        RenderParticles,
+        RenderUI,
+        RenderWait,        // Main thread blocked in RenderThread::publish()
+        PhaseCount
+    };
+
+    struct FrameSample {
+        float frameMs = 0.0f;                       // Wall time of the whole frame
+        std::array<float, PhaseCount> phaseMs{};    // Time spent in each zone
+        int simulationSteps = 0;                    // Fixed ticks run this frame
+        std::size_t renderCommands = 0;             // RenderQueue counters of the frame
+        std::size_t renderBatches = 0;
+        std::size_t textureSwitches = 0;
+    };
+
+    static Profiler& getInstance();
+
+    Profiler(const Profiler&) = delete;
+    Profiler& operator=(const Profiler&) = delete;
+
+    // Disabled by default: zones are free until Game turns recording on
+    void setEnabled(bool value) { enabled = value; }
+    bool isEnabled() const { return enabled; }
+
+    void beginFrame();
+    void endFrame();
+    void addSample(Phase phase, float ms);
+    void countSimulationStep();
+    void setRenderCounters(std::size_t commands, std::size_t batches, std::size_t textureSwitches);
+
+    // History access: index 0 = oldest kept frame
+    std::size_t getFrameCount() const { return count; }
+    const FrameSample& getFrame(std::size_t index) const;
+    const FrameSample& getLastFrame() const { return getFrame(count - 1); }
+
+    static const char* getPhaseName(Phase phase);
+
+    // Write the last `frames` frames (0 = all kept) as CSV. Returns false on I/O error.
+    bool exportCSV(const std::string& filepath, std::size_t frames = 0) const;
+
+private:
+    Profiler() = default;
+
+    static constexpr std::size_t HISTORY_SIZE = static_cast<std::size_t>(Config::PROFILER_HISTORY_FRAMES);
+
+    bool enabled = false;
+    bool frameOpen = false;
+    std::chrono::steady_clock::time_point frameStart;
+    FrameSample current;
+
+    std::array<FrameSample, HISTORY_SIZE> history{};
+    std::size_t head = 0;    // Next slot to write
+    std::size_t count = 0;   // Frames stored (<= HISTORY_SIZE)
+};
+
+// RAII timing zone: adds its lifetime to the current frame's phase
+class ProfileScope {
+public:
+    explicit ProfileScope(Profiler::Phase phase)
+        : phase(phase)
+        , active(Profiler::getInstance().isEnabled())
+    {
+        if (active) {
+            start = std::chrono::steady_clock::now();
+        }
+    }
+
+    ~ProfileScope() {
+        if (active) {
+            std::chrono::duration<float, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+            Profiler::getInstance().addSample(phase, elapsed.count());
+        }
+    }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+    Profiler::Phase phase;
+    bool active;
+    std::chrono::steady_clock::time_point start;
+};
+
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+#define PROFILE_ZONE(phase) ProfileScope PROFILE_CONCAT(profileScope_, __LINE__)(Profiler::phase)
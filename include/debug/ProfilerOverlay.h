@@ -0,0 +1,13 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+
+// Draws the Profiler history: stacked frame-time graph + per-phase averages.
+// Expects the default (screen-space) view to be active.
+class ProfilerOverlay {
+public:
+    static void draw(sf::RenderWindow& window, const sf::Font& font);
+
+private:
+    static sf::Color getPhaseColor(int phase);
+};
@@ -7,10 +7,14 @@
 #include <vector>
 
 #include "entities/FlameTrap.h"
+#include "graphics/TextBatch.h"
 
 class Camera;
 class Player;
 class Platform;
+class PlatformIndex;
+class PlatformRenderer;
+class RenderQueue;
 class Enemy;
 class InteractiveObject;
 class Checkpoint;
@@ -25,12 +29,16 @@ struct EditorContext {
     Camera* camera;
     Player* activePlayer;
     std::vector<std::unique_ptr<Platform>>& platforms;
+    PlatformIndex& platformIndex;   // Keep in sync when platforms move, resize, appear or disappear
+    PlatformRenderer& platformRenderer;   // Same, plus type changes (texture)
+    RenderQueue& renderQueue;
     std::vector<std::unique_ptr<Enemy>>& enemies;
     std::vector<std::unique_ptr<InteractiveObject>>& interactiveObjects;
     std::vector<std::unique_ptr<Checkpoint>>& checkpoints;
     LevelData* currentLevel;
     std::string& currentLevelPath;
     std::function<LevelData*(const std::string&)> reloadLevel;
+    std::function<void()> enemiesChanged;   // Call after adding or removing enemies
 };
 
 class EditorController {
@@ -90,8 +98,10 @@ private:
     bool isDraggingCheckpoint = false;
     bool isDraggingPortal = false;
     sf::Vector2f dragOffset;
+    std::vector<std::size_t> visiblePlatforms;   // Render culling scratch
 
     sf::Font editorFont;
+    TextBatch labels;   // Object labels in world space: glyphs cached, one draw per text size
     sf::Text editorText;
     sf::Text saveMessageText;
     float saveMessageTimer = 0.0f;
@@ -101,6 +111,8 @@ private:
     void setSaveMessage(const std::string& message, const sf::Color& color);
     void changeObjectType(ObjectType type);
     void reloadLevel(EditorContext& ctx);
+    // Regenerates the .lvlb next to a level JSON just written
+    void compileSavedLevel(const std::string& savePath);
     
     // Enemy preset helpers
     EnemyStats getPresetStats(EnemyPresetType preset) const;
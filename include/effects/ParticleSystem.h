@@ -1,17 +1,24 @@
 #pragma once
 
 #include <SFML/Graphics.hpp>
+#include <cstddef>
 #include <vector>
 #include <random>
-#include "effects/Particle.h"
+#include "core/Config.h"
 
+class RenderQueue;
+
+// Particles are stored as parallel arrays (structure of arrays) with a fixed capacity:
+// the update loop is a flat float kernel the compiler vectorises, dead particles are
+// swap-removed and bursts shrink once the store fills up (see emitBudget).
 class ParticleSystem {
 public:
-    ParticleSystem();
+    explicit ParticleSystem(std::size_t capacity = Config::PARTICLE_CAPACITY);
     ~ParticleSystem() = default;
 
     void update(float dt);
-    void draw(sf::RenderWindow& window);
+    // Hands the live quads to the queue as one pre-built batch (valid until its flush)
+    void submit(RenderQueue& queue);
 
     // Emit different types of particles
     void emitJump(const sf::Vector2f& position);
@@ -23,6 +30,11 @@ public:
 
     void clear();
 
+    // Round particles use a generated dot texture; off = plain squares
+    void setRoundParticles(bool enabled) { roundParticles = enabled; }
+    std::size_t getParticleCount() const { return liveCount; }
+    std::size_t getCapacity() const { return capacity; }
+
 private:
     void emitParticles(
         const sf::Vector2f& position,
@@ -38,10 +50,31 @@ private:
         float angleMax = 360.0f
     );
 
+    int emitBudget(int requested) const;
+    void removeDead();
     float randomFloat(float min, float max);
+    bool ensureDotTexture();
 
 private:
-    std::vector<Particle> particles;
+    std::size_t capacity;
+    std::size_t liveCount;
+
+    // One entry per live particle in [0, liveCount)
+    std::vector<float> posX;
+    std::vector<float> posY;
+    std::vector<float> velX;
+    std::vector<float> velY;
+    std::vector<float> lifetime;     // Remaining seconds
+    std::vector<float> alphaScale;   // 255 / max lifetime: alpha without a division per frame
+    std::vector<float> size;         // Radius
+    std::vector<sf::Color> colors;   // RGB (alpha comes from the lifetime)
+
     std::mt19937 randomEngine;
     std::uniform_real_distribution<float> distribution;
+
+    // All particles go into one quad array: a single draw call per frame
+    sf::VertexArray vertices;
+    sf::Texture dotTexture;
+    bool dotTextureReady;
+    bool roundParticles;
 };
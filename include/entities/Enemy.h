@@ -36,8 +36,8 @@ public:
     virtual ~Enemy() = default;
 
     virtual void update(float dt);
-    void draw(sf::RenderWindow& window) override;
-    void draw(sf::RenderWindow& window, bool forceDraw); // For editor: draw even if dead
+    void submit(RenderQueue& queue, const sf::Vector2f& offset) override;
+    void submit(RenderQueue& queue, const sf::Vector2f& offset, bool forceDraw); // For editor: draw even if dead
 
     EnemyType getType() const { return type; }
     bool isAlive() const { return alive; }
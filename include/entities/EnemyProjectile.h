@@ -2,13 +2,15 @@
 
 #include <SFML/Graphics.hpp>
 
+class RenderQueue;
+
 class EnemyProjectile {
 public:
     EnemyProjectile(const sf::Vector2f& startPos, const sf::Vector2f& direction, float speed, float maxDistance, int damage = 1);
     ~EnemyProjectile() = default;
 
     void update(float dt);
-    void draw(sf::RenderWindow& window);
+    void submit(RenderQueue& queue);
 
     bool isAlive() const { return alive; }
     void kill() { alive = false; }
@@ -2,13 +2,16 @@
 
 #include <SFML/Graphics.hpp>
 
+class RenderQueue;
+
 class Entity {
 public:
     Entity(float x, float y, float width, float height);
     virtual ~Entity() = default;
 
     virtual void update(float dt) = 0;
-    virtual void draw(sf::RenderWindow& window) = 0;
+    // Queue this entity's geometry; `offset` shifts it in world space (render interpolation)
+    virtual void submit(RenderQueue& queue, const sf::Vector2f& offset) = 0;
 
     // Getters
     virtual sf::FloatRect getBounds() const;
@@ -22,8 +25,13 @@ public:
     void setVelocity(float vx, float vy);
     void setVelocity(const sf::Vector2f& vel);
 
+    // Render interpolation between the last two simulation ticks
+    void storePreviousPosition() { previousPosition = position; }
+    sf::Vector2f getInterpolatedPosition(float alpha) const;
+
 protected:
     sf::Vector2f position;
+    sf::Vector2f previousPosition;
     sf::Vector2f velocity;
     sf::Vector2f size;
     bool isGrounded;
@@ -18,7 +18,7 @@ public:
     FlameTrap(float x, float y, const EnemyStats& stats);
 
     void update(float dt) override;
-    void draw(sf::RenderWindow& window) override;
+    void submit(RenderQueue& queue, const sf::Vector2f& offset) override;
 
     void updateFlame(float dt, std::vector<std::unique_ptr<EnemyProjectile>>& enemyProjectiles);
 
@@ -2,13 +2,15 @@
 
 #include <SFML/Graphics.hpp>
 
+class RenderQueue;
+
 class KineticWaveProjectile {
 public:
     KineticWaveProjectile(const sf::Vector2f& startPos, const sf::Vector2f& direction, float speed, float maxDistance);
     ~KineticWaveProjectile() = default;
 
     void update(float dt);
-    void draw(sf::RenderWindow& window);
+    void submit(RenderQueue& queue);
 
     bool isAlive() const { return alive; }
     sf::Vector2f getPosition() const { return position; }
@@ -2,8 +2,9 @@
 
 #include "Entity.h"
 #include <SFML/Graphics.hpp>
-#include "graphics/SpriteManager.h"
-#include <vector>
+#include "graphics/AnimatedSprite.h"
+#include <array>
+#include <cstddef>
 #include <string>
 
 enum class CharacterType {
@@ -18,7 +19,7 @@ public:
     ~Player() override = default;
 
     void update(float dt) override;
-    void draw(sf::RenderWindow& window) override;
+    void submit(RenderQueue& queue, const sf::Vector2f& offset) override;
 
 
     void moveLeft();
@@ -30,6 +31,10 @@ public:
     void dash();
     bool canDash() const;
 
+    // Held-button state fed by the input source (keyboard or simulation script)
+    void setJumpHeld(bool held) { jumpHeld = held; }
+    void setLookInput(bool up, bool down) { lookUp = up; lookDown = down; }
+
     void setGrounded(bool grounded);
     bool getIsGrounded() const { return isGrounded; }
 
@@ -93,50 +98,7 @@ private:
 
 private:
     sf::RectangleShape shape;  // Fallback si pas de sprite
-    sf::Sprite sprite;         // Sprite actuel
-    std::vector<sf::Texture*> idleTexturesSouth;  // Textures pour l'animation idle (face caméra/bas)
-    std::vector<sf::Texture*> idleTexturesNorth;  // Textures pour dos/haut
-    std::vector<sf::Texture*> idleTexturesEast;   // Textures pour droite
-    std::vector<sf::Texture*> idleTexturesWest;   // Textures pour gauche
-    std::vector<sf::Texture*> runTexturesSouth;   // Textures pour l'animation run (face caméra/bas)
-    std::vector<sf::Texture*> runTexturesNorth;   // Textures pour run dos/haut
-    std::vector<sf::Texture*> runTexturesEast;    // Textures pour run droite
-    std::vector<sf::Texture*> runTexturesWest;    // Textures pour run gauche
-    std::vector<sf::Texture*> jumpTexturesSouth;  // Textures pour l'animation jump
-    std::vector<sf::Texture*> jumpTexturesNorth;
-    std::vector<sf::Texture*> jumpTexturesEast;
-    std::vector<sf::Texture*> jumpTexturesWest;
-    std::vector<sf::Texture*> doubleJumpTexturesSouth; // Textures pour double jump
-    std::vector<sf::Texture*> doubleJumpTexturesNorth;
-    std::vector<sf::Texture*> doubleJumpTexturesEast;
-    std::vector<sf::Texture*> doubleJumpTexturesWest;
-    std::vector<sf::Texture*> hurtTexturesSouth;  // Textures pour l'animation hurt
-    std::vector<sf::Texture*> hurtTexturesNorth;
-    std::vector<sf::Texture*> hurtTexturesEast;
-    std::vector<sf::Texture*> hurtTexturesWest;
-    std::vector<sf::Texture*> deathTexturesSouth; // Textures pour l'animation death
-    std::vector<sf::Texture*> deathTexturesNorth;
-    std::vector<sf::Texture*> deathTexturesEast;
-    std::vector<sf::Texture*> deathTexturesWest;
-    std::vector<sf::Texture*> abilityTexturesSouth; // Textures pour l'animation ability (Kinetic Wave)
-    std::vector<sf::Texture*> abilityTexturesNorth;
-    std::vector<sf::Texture*> abilityTexturesEast;
-    std::vector<sf::Texture*> abilityTexturesWest;
-    std::vector<sf::Texture*> kickTexturesSouth; // Textures pour l'animation kick/attack
-    std::vector<sf::Texture*> kickTexturesNorth;
-    std::vector<sf::Texture*> kickTexturesEast;
-    std::vector<sf::Texture*> kickTexturesWest;
-    std::vector<sf::Texture*> currentAnimationTextures; // Textures de l'animation actuelle
-    int currentAnimationFrame;
-    float animationTimer;
-    float idleFrameDuration;
-    float runFrameDuration;
-    float jumpFrameDuration;
-    float doubleJumpFrameDuration;
-    float hurtFrameDuration;
-    float deathFrameDuration;
-    float abilityFrameDuration;
-    float kickFrameDuration;
+    AnimatedSprite sprite;     // Sprite actuel : clip partagé + frame courante
     bool useSprites;  // Utilise les sprites ou le rectangle coloré?
     int facingDirection; // 0 = face (south/bas), 2 = dos (north/haut), 1 = droite (east), -1 = gauche (west)
     bool isRunning;   // true = run animation, false = idle animation
@@ -152,21 +114,25 @@ private:
         Hurt,
         Death,
         Ability,
-        Attack
+        Attack,
+        Count
     };
     AnimationState currentAnimationState;
-    
+
+    // Clips of one character, indexed [state][direction] (South, North, East, West).
+    // Built once per character from a static table, shared by every Player of that character.
+    static constexpr std::size_t DIRECTION_COUNT = 4;
+    using ClipTable = std::array<std::array<AnimationClip, DIRECTION_COUNT>,
+                                 static_cast<std::size_t>(AnimationState::Count)>;
+    static const ClipTable& getClips(CharacterType type);
+
     CharacterType characterType;
     
-    void loadIdleAnimation();
-    void loadRunAnimation();
-    void loadJumpAnimation();
-    void loadDoubleJumpAnimation();
-    void loadHurtAnimation();
-    void loadDeathAnimation();
-    void loadAbilityAnimation();
-    void loadKickAnimation();
+    void initSprite();
+    // Clip of `state` for the current facing direction (south when that direction has none)
+    const AnimationClip* findClip(AnimationState state) const;
     void updateAnimation(float dt);
+    int computeFacingDirection() const;
 
     // Coyote time (grace period for jumping after leaving platform)
     float coyoteTimeCounter;
@@ -178,8 +144,13 @@ private:
     // Variable jump height
     bool isJumping;
     bool jumpReleased;
+    bool jumpHeld;
     int jumpsRemaining;  // For double jump mechanic
 
+    // Vertical look input (facing north/south when standing still)
+    bool lookUp;
+    bool lookDown;
+
     // Health system
     int health;
     int maxHealth;
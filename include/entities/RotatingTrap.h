@@ -7,7 +7,7 @@ public:
     RotatingTrap(float x, float y, const EnemyStats& stats);
 
     void update(float dt) override;
-    void draw(sf::RenderWindow& window) override;
+    void submit(RenderQueue& queue, const sf::Vector2f& offset) override;
 
     float getRotationSpeed() const { return rotationSpeed; }
     void setRotationSpeed(float speed) { rotationSpeed = speed; }
@@ -1,88 +1,62 @@
 #pragma once
 
 #include <SFML/Graphics.hpp>
-#include <string>
-#include <unordered_map>
+#include "graphics/RenderQueue.h"
+#include "graphics/SpriteManager.h"
 #include <vector>
 
-// Structure pour définir une animation
-struct Animation {
-    std::string name;
-    std::vector<sf::IntRect> frames;  // Rectangles de chaque frame dans la texture
-    float frameDuration;              // Durée d'une frame en secondes
-    bool loop;                        // L'animation boucle-t-elle?
-    
-    Animation()
-        : name("")
-        , frameDuration(0.1f)
-        , loop(true)
-    {}
+// Une animation : frames (rectangles dans l'atlas) + timing.
+// Immuable une fois construite et partagée : les instances n'en gardent qu'un pointeur.
+struct AnimationClip {
+    std::vector<SpriteFrame> frames;
+    float frameDuration = 0.1f;   // Durée d'une frame en secondes
+    bool loop = true;             // false : reste sur la dernière frame
+
+    bool empty() const { return frames.empty(); }
+    int size() const { return static_cast<int>(frames.size()); }
 };
 
+// Sprite + curseur de lecture sur un clip partagé (pointeur, frame courante, timer).
+// Le choix du clip reste à l'entité (état, direction) ; ici seulement le défilement des frames.
 class AnimatedSprite {
 public:
     AnimatedSprite();
     ~AnimatedSprite() = default;
 
-    // Set texture (from SpriteManager)
-    void setTexture(sf::Texture* texture);
-
-    // Add animation
-    void addAnimation(const Animation& animation);
-
-    // Play animation by name
-    void play(const std::string& animationName, bool forceRestart = false);
-
-    // Stop current animation
-    void stop();
-
-    // Pause/Resume
-    void pause();
-    void resume();
-
-    // Update animation (call every frame)
-    void update(float dt);
+    // Switch to `clip` at its first frame. The frame timer keeps running (no hitch on switches).
+    void play(const AnimationClip* clip);
+    // Advance by the clip timing; returns true when the shown frame changed
+    bool update(float dt);
+    // Show frame `index` of the current clip (clamped)
+    void setFrame(int index);
+    void resetTimer() { frameTimer = 0.0f; }
+
+    const AnimationClip* getClip() const { return clip; }
+    int getFrame() const { return frameIndex; }
+    bool hasFrame() const { return clip && !clip->empty(); }
+    // Non-looping clip sitting on its last frame
+    bool isFinished() const;
 
-    // Draw sprite
-    void draw(sf::RenderWindow& window);
+    // Draw through the render queue (nothing until a clip with frames is playing)
+    void submit(RenderQueue& queue, RenderLayer layer, const sf::Vector2f& offset = sf::Vector2f()) const;
 
     // Getters/Setters
     void setPosition(float x, float y);
     void setPosition(const sf::Vector2f& position);
     sf::Vector2f getPosition() const;
-    
+
     void setScale(float x, float y);
-    void setScale(const sf::Vector2f& scale);
-    
     void setOrigin(float x, float y);
-    void setOrigin(const sf::Vector2f& origin);
-    
-    void setRotation(float angle);
-    
     void setColor(const sf::Color& color);
 
-    // Get current animation name
-    std::string getCurrentAnimation() const;
-
-    // Check if animation is finished (for non-looping animations)
-    bool isFinished() const;
-
-    // Get sprite bounds (for collisions)
     sf::FloatRect getGlobalBounds() const;
-    sf::FloatRect getLocalBounds() const;
+    const sf::Sprite& getSprite() const { return sprite; }
 
 private:
+    void applyFrame();   // Atlas page + rect of the current frame
+
     sf::Sprite sprite;
-    sf::Texture* texture;
-    
-    std::unordered_map<std::string, Animation> animations;
-    std::string currentAnimationName;
-    Animation* currentAnimation;
-    
-    size_t currentFrameIndex;
+    const AnimationClip* clip;
+    int frameIndex;
     float frameTimer;
-    bool playing;
-    bool paused;
-    bool finished;
 };
-
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include "graphics/SpriteManager.h"
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+struct LevelData;
+
+// Tiled background wall baked once per level into vertex chunks.
+// Every tile of the level area is written up front (base tile, or a variant declared in
+// the level's "backgroundTiles"); drawing only submits the chunks under the view, one
+// draw call per texture used in each chunk (a single one when the tiles share an atlas page).
+class BackgroundLayer {
+public:
+    explicit BackgroundLayer(float tileSize = 32.0f, int chunkTiles = 16);
+
+    // Tiles must be registered before build(); frames come trimmed from the atlas
+    void setBaseTile(const SpriteFrame& frame);
+    void setVariant(const std::string& name, const SpriteFrame& frame);
+    void clearTextures();
+
+    // Bake the tiles covering `area` (world units)
+    void build(const LevelData& level, const sf::FloatRect& area);
+    void clear();
+    bool isBuilt() const { return !chunks.empty(); }
+
+    void draw(sf::RenderTarget& target) const;
+
+private:
+    struct Batch {
+        const sf::Texture* texture;
+        sf::VertexArray vertices;
+    };
+
+    struct Chunk {
+        sf::FloatRect bounds;
+        std::vector<Batch> batches;
+    };
+
+    void appendTile(Chunk& chunk, const SpriteFrame& frame, float x, float y);
+
+    float tileSize;
+    int chunkTiles;
+    SpriteFrame baseTile;
+    std::unordered_map<std::string, SpriteFrame> variants;
+    std::vector<Chunk> chunks;
+};
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+class Platform;
+
+// Static platform geometry merged into per-chunk vertex arrays (512px chunks by default).
+// Each platform belongs to the chunk holding its top-left corner; a chunk keeps one quad
+// batch per texture (untextured platforms share a coloured batch). Chunks are only
+// re-baked when marked dirty (level load, editor move / resize / type change), and
+// drawing submits the batches of the chunks under the view.
+class PlatformRenderer {
+public:
+    explicit PlatformRenderer(float chunkSize = 512.0f);
+
+    // Assign every platform to its chunk and bake all chunks
+    void build(const std::vector<std::unique_ptr<Platform>>& platforms);
+    // Platform `index` moved, resized or changed type: re-home it and dirty its chunk(s)
+    void update(std::size_t index);
+    void clear();
+
+    // Same platform list as the last build() (rebuild when it was replaced)
+    bool isBuiltFor(const std::vector<std::unique_ptr<Platform>>& platforms) const;
+
+    void draw(sf::RenderTarget& target);
+
+    std::size_t getChunkCount() const { return chunks.size(); }
+    std::size_t getLastDrawCalls() const { return lastDrawCalls; }
+
+private:
+    static constexpr std::size_t NONE = static_cast<std::size_t>(-1);
+
+    struct Batch {
+        const sf::Texture* texture;
+        sf::VertexArray vertices;
+    };
+
+    struct Chunk {
+        sf::FloatRect bounds;                // Union of the member platforms (culling)
+        std::vector<std::size_t> members;    // Platform indices, kept in level order
+        std::vector<Batch> batches;
+        bool dirty;
+    };
+
+    std::size_t chunkFor(const sf::FloatRect& bounds);
+    void removeMember(std::size_t chunk, std::size_t index);
+    void addMember(std::size_t chunk, std::size_t index);
+    void bake(Chunk& chunk);
+
+    float chunkSize;
+    const std::vector<std::unique_ptr<Platform>>* source;
+    std::size_t sourceSize;
+
+    std::vector<Chunk> chunks;
+    std::unordered_map<std::int64_t, std::size_t> chunkLookup;
+    std::vector<std::size_t> platformChunk;   // Chunk of each platform
+    std::size_t lastDrawCalls;
+};
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Draw order of the queued world entities (lowest first)
+enum class RenderLayer : std::uint8_t {
+    Props,          // Checkpoints, interactive objects
+    Enemies,        // Enemies and traps
+    Projectiles,    // Kinetic waves, enemy shots
+    Particles,
+    Player
+};
+
+// Per-frame render queue for world entities.
+// Entities submit lightweight commands (layer, texture, quad / shape geometry, colour)
+// instead of drawing to the window; flush() sorts them by layer then texture and
+// submits one vertex array per run of commands sharing a texture.
+// Within a layer, commands using different textures are not kept in submission order:
+// anything that must overlap something else goes in a higher layer.
+class RenderQueue {
+public:
+    struct Stats {
+        std::size_t commands = 0;          // Commands submitted this frame
+        std::size_t batches = 0;           // Draw calls issued by flush()
+        std::size_t textureSwitches = 0;   // Batches whose texture differs from the previous one
+    };
+
+    // Textured (or untextured when texture is null) quad, corners in clockwise order
+    void submitQuad(RenderLayer layer, const sf::Texture* texture, const sf::Vertex (&quad)[4]);
+    // Sprites and convex shapes keep their transform; `offset` shifts them in world space
+    // (render interpolation) without touching the drawable
+    void submit(RenderLayer layer, const sf::Sprite& sprite, const sf::Vector2f& offset = sf::Vector2f());
+    void submit(RenderLayer layer, const sf::Shape& shape, const sf::Vector2f& offset = sf::Vector2f());
+    // Already batched geometry (particles): copied, then drawn as its own batch.
+    // The copy keeps a filled queue self-contained, so it can be flushed on another thread.
+    void submitBatch(RenderLayer layer, const sf::Texture* texture, const sf::Vertex* vertices,
+                     std::size_t count, sf::PrimitiveType type);
+
+    // Sort, draw and reset for the next frame (stats stay readable until the next flush)
+    void flush(sf::RenderTarget& target);
+    void clear();
+
+    const Stats& getLastStats() const { return lastStats; }
+
+private:
+    struct Command {
+        RenderLayer layer;
+        const sf::Texture* texture;
+        std::uint32_t order;          // Submission index: stable order within a texture
+        std::size_t firstVertex;      // Into `vertices`
+        std::size_t vertexCount;
+        bool prebatched;              // submitBatch() geometry: never merged with other commands
+        sf::PrimitiveType type;
+    };
+
+    void pushCommand(RenderLayer layer, const sf::Texture* texture, std::size_t firstVertex);
+    void appendTriangle(const sf::Vertex& a, const sf::Vertex& b, const sf::Vertex& c);
+    void appendOutline(const sf::Shape& shape, const sf::Transform& transform);
+
+    std::vector<Command> commands;
+    std::vector<sf::Vertex> vertices;    // Geometry of every queued command, in submission order
+    std::vector<sf::Vertex> batch;       // Scratch: vertices of the batch being flushed
+    std::vector<sf::Vector2f> points;    // Scratch: shape points
+    Stats lastStats;
+};
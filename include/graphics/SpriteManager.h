@@ -1,9 +1,17 @@
 #pragma once
 
 #include <SFML/Graphics.hpp>
+#include "core/AssetPack.h"
 #include <string>
 #include <unordered_map>
 #include <memory>
+#include <vector>
+
+// Region of a texture handed out by the atlas: draw with setTexture(*texture) + setTextureRect(rect)
+struct SpriteFrame {
+    const sf::Texture* texture = nullptr;
+    sf::IntRect rect;
+};
 
 class SpriteManager {
 public:
@@ -14,7 +22,7 @@ public:
     SpriteManager(const SpriteManager&) = delete;
     SpriteManager& operator=(const SpriteManager&) = delete;
 
-    // Load texture from file
+    // Load texture (decoded image from the asset pack when present, loose file otherwise)
     bool loadTexture(const std::string& id, const std::string& filepath);
 
     // Get texture by ID (returns nullptr if not found)
@@ -29,10 +37,38 @@ public:
     // Check if texture is loaded
     bool hasTexture(const std::string& id) const;
 
+    // Atlas: small images (animation frames, tiles) are packed into shared pages at load
+    // time, so sprites switching frames or tiles keep the same texture bound.
+    // `trim` packs only the opaque bounding box (tiles with transparent padding).
+    bool loadFrame(const std::string& id, const std::string& filepath, bool trim = false);
+    SpriteFrame getFrame(const std::string& id) const;   // texture == nullptr when unknown
+    bool hasFrame(const std::string& id) const;
+    std::size_t getAtlasPageCount() const { return atlasPages.size(); }
+
+    // Headless mode: no GL context, every load fails fast (entities fall back to shapes)
+    void setHeadless(bool enabled) { headless = enabled; }
+    bool isHeadless() const { return headless; }
+
 private:
     SpriteManager() = default;
     ~SpriteManager() = default;
 
+    struct AtlasPage {
+        std::unique_ptr<sf::Texture> texture;
+        unsigned int cursorX = 0;      // Shelf packer: next free slot on the current shelf
+        unsigned int cursorY = 0;
+        unsigned int shelfHeight = 0;
+    };
+
+    bool packImage(const AssetPack::ImageView& image, const sf::IntRect& area, SpriteFrame& out);
+    // Pixels of `area` as one contiguous block (the image itself when area is all of it)
+    const sf::Uint8* regionPixels(const AssetPack::ImageView& image, const sf::IntRect& area);
+    unsigned int atlasPageSize() const;
+
     std::unordered_map<std::string, std::unique_ptr<sf::Texture>> textures;
+    std::vector<AtlasPage> atlasPages;
+    std::unordered_map<std::string, SpriteFrame> frames;
+    std::vector<sf::Uint8> regionScratch;
+    bool headless = false;
 };
 
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+struct TextStyle {
+    unsigned int characterSize = 30;
+    sf::Color fillColor = sf::Color::White;
+    sf::Color outlineColor = sf::Color::Black;
+    float outlineThickness = 0.0f;
+
+    bool operator==(const TextStyle& other) const {
+        return characterSize == other.characterSize && fillColor == other.fillColor &&
+               outlineColor == other.outlineColor && outlineThickness == other.outlineThickness;
+    }
+    bool operator!=(const TextStyle& other) const { return !(*this == other); }
+};
+
+// Retained text renderer for HUD, menus and editor labels.
+// Each string lives under a caller-chosen key and keeps its glyph quads: it is only laid out
+// again when its text or style changes. Every frame the caller put()s the entries to show;
+// draw() merges consecutive entries of the same character size into one vertex array (the font
+// keeps one glyph page per size), keeping put() order so overlapping labels stack as before,
+// and reuses the merged arrays when nothing moved or changed.
+// Glyph placement matches sf::Text (regular style, default letter / line spacing).
+class TextBatch {
+public:
+    TextBatch();
+
+    void setFont(const sf::Font& font);
+    bool hasFont() const { return font != nullptr; }
+
+    // Keys: one namespace per kind of label, the index inside it
+    static std::uint64_t key(std::uint32_t group, std::uint32_t index) {
+        return (static_cast<std::uint64_t>(group) << 32) | index;
+    }
+
+    // Lay `text` out under `key` (no-op when text and style are unchanged).
+    // Returns the local bounds, as sf::Text::getLocalBounds() would.
+    const sf::FloatRect& layout(std::uint64_t key, const std::string& text, const TextStyle& style);
+    // Show the entry laid out under `key` this frame, its origin at `position`
+    void put(std::uint64_t key, const sf::Vector2f& position);
+    void put(std::uint64_t key, const std::string& text, const TextStyle& style, const sf::Vector2f& position);
+    // Pen position after the last glyph (where a following string on the same line starts)
+    float getAdvance(std::uint64_t key) const;
+
+    // Draws everything put since the last draw, then starts a new frame
+    void draw(sf::RenderTarget& target);
+    void clear();
+
+    std::size_t getEntryCount() const { return entries.size(); }
+    std::size_t getLastDrawCalls() const { return lastDrawCalls; }
+
+private:
+    // Entries not shown for this many frames are dropped (editor labels of deleted objects)
+    static constexpr std::uint64_t EVICT_FRAMES = 600;
+
+    struct Entry {
+        std::string text;
+        TextStyle style;
+        std::vector<sf::Vertex> outline;   // Triangles, relative to the entry origin
+        std::vector<sf::Vertex> fill;
+        sf::FloatRect bounds;
+        float advance = 0.0f;
+        std::uint64_t lastFrame = 0;
+    };
+
+    struct Placement {
+        std::uint64_t key;
+        const Entry* entry;
+        sf::Vector2f position;
+
+        bool operator==(const Placement& other) const {
+            return key == other.key && position == other.position;
+        }
+    };
+
+    struct Group {
+        unsigned int characterSize;
+        sf::VertexArray vertices;
+    };
+
+    void build(Entry& entry) const;
+    void merge();
+    void evict();
+
+    const sf::Font* font;
+    std::unordered_map<std::uint64_t, Entry> entries;
+    std::vector<Placement> placements;       // This frame, in put() order
+    std::vector<Placement> lastPlacements;   // What the merged groups were built from
+    std::vector<Group> groups;
+    bool layoutChanged;                      // An entry was laid out again this frame
+    std::uint64_t frame;
+    std::size_t lastDrawCalls;
+};
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <cstdint>
+
+// 64-bit key of a 2D grid cell (x in the high half, y in the low half), shared by the
+// spatial indices. Packed through unsigned types: negative coordinates are valid, and
+// left-shifting a negative signed value is undefined in C++17.
+namespace CellKey {
+    inline std::int64_t pack(int cx, int cy) {
+        const std::uint64_t packed = (static_cast<std::uint64_t>(static_cast<std::uint32_t>(cx)) << 32) |
+                                     static_cast<std::uint32_t>(cy);
+        return static_cast<std::int64_t>(packed);
+    }
+
+    inline int unpackX(std::int64_t key) {
+        return static_cast<std::int32_t>(static_cast<std::uint64_t>(key) >> 32);
+    }
+
+    inline int unpackY(std::int64_t key) {
+        return static_cast<std::int32_t>(static_cast<std::uint64_t>(key) & 0xFFFFFFFFu);
+    }
+}
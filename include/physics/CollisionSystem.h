@@ -1,12 +1,38 @@
 #pragma once
 
 #include <SFML/Graphics.hpp>
+#include <vector>
 
 namespace CollisionSystem {
+    // Result of a swept AABB test
+    struct SweepHit {
+        bool hit = false;
+        float time = 1.0f;                   // Fraction of the displacement before contact [0, 1]
+        sf::Vector2f normal{0.0f, 0.0f};     // Surface normal of the static rect at contact
+    };
+
     // AABB collision detection
     bool checkCollision(const sf::FloatRect& a, const sf::FloatRect& b);
 
     // Resolve collision and return true if collision happened
     bool resolveCollision(sf::FloatRect& movingRect, sf::Vector2f& velocity,
                           const sf::FloatRect& staticRect, bool& isGrounded);
+
+    // Time of impact of movingRect travelling by displacement against staticRect.
+    // Rects already overlapping at the start are not reported (resolveCollision handles them).
+    SweepHit sweepAABB(const sf::FloatRect& movingRect, const sf::Vector2f& displacement,
+                       const sf::FloatRect& staticRect);
+
+    // True when the move passes completely through staticRect (the end position alone misses it)
+    bool sweepTunnels(const sf::FloatRect& movingRect, const sf::Vector2f& displacement,
+                      const sf::FloatRect& staticRect);
+
+    // Continuous move: travel by displacement, stop at the first obstacle and slide along it.
+    // Blocked velocity components are zeroed; landing on top of an obstacle sets isGrounded.
+    bool moveAndSlide(sf::FloatRect& movingRect, sf::Vector2f& velocity, const sf::Vector2f& displacement,
+                      const std::vector<sf::FloatRect>& obstacles, bool& isGrounded);
+
+    // Distance from point to the segment [a, b] (swept circle / point tests)
+    float distanceToSegment(const sf::Vector2f& point, const sf::Vector2f& a, const sf::Vector2f& b,
+                            sf::Vector2f* closestPoint = nullptr);
 }
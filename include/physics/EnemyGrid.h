@@ -0,0 +1,67 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+class Enemy;
+
+// Persistent spatial hash of living enemies (128px cells), owned by the World.
+// sync() only relinks enemies whose cell changed; cells live in a flat open-addressing
+// table and each cell is an intrusive list through the per-enemy slots, so a level in
+// steady state allocates nothing. Serves kinetic wave hits, attacks and player contact.
+class EnemyGrid {
+public:
+    explicit EnemyGrid(float cellSize = 128.0f);
+
+    // Bring the grid in line with the enemy list (rebuilds if the list itself changed)
+    void sync(const std::vector<std::unique_ptr<Enemy>>& enemies);
+    // Same for the listed slots only (enemy-list indices, list unchanged since the last sync()):
+    // the other enemies are assumed not to have moved or died since
+    void syncSlots(const std::vector<std::int32_t>& indices);
+    void clear();
+
+    // Living enemies whose bounds intersect `area`, in enemy-list order (out is cleared first)
+    void query(const sf::FloatRect& area, std::vector<Enemy*>& out) const;
+
+    float getCellSize() const { return cellSize; }
+
+private:
+    static constexpr std::int32_t NONE = -1;
+
+    struct Slot {
+        Enemy* enemy;
+        std::int32_t cell;   // Index in the cell table, NONE when not linked (dead / null)
+        std::int32_t prev;
+        std::int32_t next;
+        int cellX;
+        int cellY;
+    };
+
+    bool matches(const std::vector<std::unique_ptr<Enemy>>& enemies) const;
+    void rebuildSlots(const std::vector<std::unique_ptr<Enemy>>& enemies);
+    void syncSlot(std::int32_t slotIndex);
+    void link(std::int32_t slot, std::int32_t cell);
+    void unlink(std::int32_t slot);
+
+    int cellCoord(float value) const;
+    std::int32_t findCell(int cx, int cy) const;
+    std::int32_t findOrCreateCell(int cx, int cy);
+    void growCellTable();
+
+    static std::uint64_t hashCell(int cx, int cy);
+
+    float cellSize;
+    float maxExtent;   // Largest enemy bounds seen: queries reach back this far
+
+    std::vector<Slot> slots;
+
+    // Open-addressing cell table (power-of-two capacity, cells are never removed)
+    std::vector<std::int64_t> cellKeys;
+    std::vector<std::int32_t> cellHeads;
+    std::vector<std::uint8_t> cellUsed;
+    std::size_t cellCount;
+
+    mutable std::vector<std::int32_t> candidates;
+};
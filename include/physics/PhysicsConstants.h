@@ -4,4 +4,5 @@ namespace Physics {
     constexpr float GRAVITY = 980.0f;           // pixels/s²
     constexpr float TERMINAL_VELOCITY = 1000.0f; // max fall speed
     constexpr float EPSILON = 0.01f;            // small value for collision resolution
+    constexpr int MAX_SLIDE_ITERATIONS = 4;     // move-and-slide contacts handled per step
 }
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include "physics/CellKey.h"
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+class Platform;
+
+// Static broad phase for platforms: uniform grid of platform indices.
+// Built once per level, patched by the editor when a platform moves or is resized.
+// Queries return platforms in level order so collision resolution stays deterministic.
+class PlatformIndex {
+public:
+    explicit PlatformIndex(float cellSize = 256.0f);
+
+    void build(const std::vector<std::unique_ptr<Platform>>& platforms);
+    void update(std::size_t index);   // Platform at `index` moved or was resized
+    void clear();
+
+    std::size_t size() const { return entries.size(); }
+    bool isBuiltFor(const std::vector<std::unique_ptr<Platform>>& platforms) const;
+
+    // Appends every platform whose bounds intersect `area` (out is cleared first)
+    void query(const sf::FloatRect& area, std::vector<Platform*>& out) const;
+    // Same, as indices into the platform list (editor overlay)
+    void queryIndices(const sf::FloatRect& area, std::vector<std::size_t>& out) const;
+
+    // Union of all platform bounds (empty rect when there are no platforms)
+    const sf::FloatRect& getBounds() const { return totalBounds; }
+
+private:
+    struct Entry {
+        Platform* platform;
+        sf::FloatRect bounds;
+        bool oversized;   // Spans too many cells: kept in a separate list
+    };
+
+    struct CellRange {
+        int minX, minY, maxX, maxY;
+    };
+
+    CellRange cellRange(const sf::FloatRect& bounds) const;
+    void insert(std::uint32_t index);
+    void remove(std::uint32_t index);
+    void recomputeBounds();
+    void gatherCandidates(const sf::FloatRect& area) const;   // Sorted indices into `candidates`
+
+    static std::int64_t makeCellKey(int cx, int cy) { return CellKey::pack(cx, cy); }
+
+    float cellSize;
+    std::vector<Entry> entries;
+    std::unordered_map<std::int64_t, std::vector<std::uint32_t>> cells;
+    std::vector<std::uint32_t> oversizedEntries;
+    sf::FloatRect totalBounds;
+    CellRange occupiedCells;
+
+    // Query scratch (dedup of platforms spanning several cells)
+    mutable std::vector<std::uint32_t> visitStamps;
+    mutable std::uint32_t currentStamp = 0;
+    mutable std::vector<std::uint32_t> candidates;
+};
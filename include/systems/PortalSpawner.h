@@ -1,12 +1,10 @@
 #pragma once
 
 #include <SFML/System/Vector2.hpp>
-#include <memory>
 #include <string>
-#include <vector>
 
 struct LevelData;
-class Platform;
+class PlatformIndex;
 
 struct PortalSpawnResult {
     sf::Vector2f position;
@@ -19,6 +17,6 @@ public:
                                           bool useCustomSpawn,
                                           const sf::Vector2f& customSpawnPos,
                                           const LevelData* level,
-                                          const std::vector<std::unique_ptr<Platform>>& platforms);
+                                          const PlatformIndex& platforms);
 };
 
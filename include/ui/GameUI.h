@@ -1,54 +1,71 @@
 #pragma once
 
 #include <SFML/Graphics.hpp>
+#include "graphics/TextBatch.h"
 #include <string>
 #include <vector>
 
 class GameUI {
 public:
+    // What the HUD shows. Copied into the frame snapshot when a render thread draws the HUD:
+    // the setters below only touch these values, draw() owns everything else.
+    struct HudValues {
+        int deaths = 0;
+        float timer = 0.0f;
+        int health = 3;
+        int maxHealth = 3;
+        bool victoryVisible = false;
+    };
+
     GameUI();
     ~GameUI() = default;
 
     void update(float dt);
     void draw(sf::RenderWindow& window);
+    void draw(sf::RenderTarget& target, const HudValues& shown);
 
     void incrementDeaths();
     void resetDeaths();
-    int getDeathCount() const { return deathCount; }
+    int getDeathCount() const { return values.deaths; }
 
     void setTimer(float time);
-    float getTimer() const { return timer; }
+    float getTimer() const { return values.timer; }
 
     void showVictoryMessage();
     void hideVictoryMessage();
-    bool isVictoryMessageShown() const { return victoryMessageVisible; }
+    bool isVictoryMessageShown() const { return values.victoryVisible; }
 
     // Health display
     void setHealth(int health, int maxHealth);
 
+    const HudValues& getValues() const { return values; }
+
 private:
-    void updateTexts();
-    void updateHearts();
+    void updateTexts(const HudValues& shown);
+    void updateHearts(const HudValues& shown);
 
 private:
+    HudValues values;
+
     sf::Font font;
     bool fontLoaded;
 
-    // Death counter
-    sf::Text deathText;
-    int deathCount;
-
-    // Timer
-    sf::Text timerText;
-    float timer;
+    // Death counter and timer: one text batch, strings reformatted only when the shown value changes
+    TextBatch hudText;
+    TextStyle hudStyle;
+    int displayedDeaths;
+    int displayedSeconds;
+    int displayedCentiseconds;
+    std::string deathString;
+    std::string timerString;       // "Time: MM:SS"
+    std::string fractionString;    // ".mm", laid out right after timerString
 
     // Victory message
     sf::Text victoryText;
     sf::RectangleShape victoryBackground;
-    bool victoryMessageVisible;
 
-    // Health display
-    int currentHealth;
-    int maxHealthValue;
+    // Health display, rebuilt when the shown health changes
+    int displayedHealth;
+    int displayedMaxHealth;
     std::vector<sf::RectangleShape> hearts;
 };
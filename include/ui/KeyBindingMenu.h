@@ -10,14 +10,24 @@ public:
 
     void setCallbacks(std::function<void()> onBack);
     void handleInput(const sf::Event& event) override;
-    void draw(sf::RenderWindow& window) override;
+
+protected:
+    void putLabels() override;
 
 private:
     struct BindingDisplay {
         std::string actionName;
         std::string action;
-        sf::Text labelText;
-        sf::Text valueText;
+        std::string labelString;
+        std::string valueString;
+        sf::Color valueColor;
+    };
+
+    // Text batch groups (after Menu's own)
+    enum BindingLabelGroup : std::uint32_t {
+        LabelBindingName = LABEL_GROUP_USER,
+        LabelBindingValue,
+        LabelInstruction
     };
 
     std::vector<BindingDisplay> bindings;
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <SFML/Graphics.hpp>
+#include "graphics/TextBatch.h"
 #include <vector>
 #include <string>
 #include <functional>
@@ -9,6 +10,7 @@ class MenuItem {
 public:
     MenuItem(const std::string& text, std::function<void()> callback);
 
+    // Background only: the label goes through the menu's TextBatch
     void draw(sf::RenderWindow& window, bool isSelected);
     void setPosition(float x, float y);
     sf::FloatRect getBounds() const;
@@ -17,9 +19,7 @@ public:
 
 private:
     sf::RectangleShape background;
-    sf::Text text;
-    sf::Font* font; // Will be set by Menu
-    bool hasFont;
+    std::string label;
 
     friend class Menu;
 };
@@ -41,14 +41,30 @@ public:
     void selectPrevious();
     void activate();
 
+    // Render-on-change: the game only redraws a menu state when this returns true
+    void markDirty() { dirty = true; }
+    bool needsRedraw() const { return dirty || isAnimating(); }
+    virtual bool isAnimating() const { return false; }   // Time-driven effects keep redrawing
+
 protected:
     std::vector<MenuItem> items;
     int selectedIndex;
     sf::Font font;
     bool fontLoaded;
 
-    sf::Text titleText;
+    // Title, item labels and subclass texts share one batch (one draw call per run of same-size texts)
+    TextBatch labels;
+    TextStyle titleStyle;
+    TextStyle itemStyle;
+    std::string titleString;
     sf::RectangleShape background;
 
+    // Label keys: Menu uses groups below LABEL_GROUP_USER, subclasses from there on
+    enum LabelGroup : std::uint32_t { LabelTitle, LabelItem, LABEL_GROUP_USER };
+
+    bool dirty;   // Something shown changed since the last draw
+
     void updateLayout();
+    // Subclass texts, put after the title and items so they stack above them (font loaded)
+    virtual void putLabels() {}
 };
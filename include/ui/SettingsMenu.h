@@ -10,7 +10,9 @@ public:
 
     void setCallbacks(std::function<void()> onControls, std::function<void()> onBack);
     void handleInput(const sf::Event& event) override;
-    void draw(sf::RenderWindow& window) override;
+
+protected:
+    void putLabels() override;
 
 private:
     AudioManager* audioManager;
@@ -18,9 +20,8 @@ private:
     int soundVolume;
     int musicVolume;
 
-    sf::Text volumeText;
-    sf::Text soundVolumeText;
-    sf::Text musicVolumeText;
+    // Drawn over the first three (empty) items, through the menu's text batch
+    std::string volumeStrings[3];
 
     void updateVolumeDisplay();
     void adjustMasterVolume(int delta);
@@ -9,14 +9,20 @@ public:
     ~Camera() = default;
 
     void update(const sf::Vector2f& targetPosition, float dt);
-    void apply(sf::RenderWindow& window);
+    void apply(sf::RenderWindow& window, float alpha = 1.0f);
     const sf::View& getView() const { return view; }
+    // View drawn between the last two simulation ticks (what apply() sets)
+    sf::View getRenderView(float alpha = 1.0f) const;
+
+    // World rectangle covered by `view`, grown by `margin` on every side (render culling)
+    static sf::FloatRect visibleArea(const sf::View& view, float margin = 0.0f);
 
     void setLimits(float minX, float maxX, float minY, float maxY);
     void setShakeOffset(const sf::Vector2f& offset);
 
 private:
     sf::View view;
+    sf::Vector2f previousCenter;  // Center before the last update (render interpolation)
     float smoothing;
     sf::Vector2f shakeOffset;
     float limitMinX, limitMaxX;
@@ -3,13 +3,15 @@
 #include <SFML/Graphics.hpp>
 #include <string>
 
+class RenderQueue;
+
 class Checkpoint {
 public:
     Checkpoint(float x, float y, const std::string& id);
     ~Checkpoint() = default;
 
     void update(float dt);
-    void draw(sf::RenderWindow& window);
+    void submit(RenderQueue& queue) const;
 
     // Check if player is touching this checkpoint
     bool isPlayerInside(const sf::FloatRect& playerBounds) const;
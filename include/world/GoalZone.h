@@ -9,7 +9,7 @@ public:
     ~GoalZone() override = default;
 
     void update(float dt) override;
-    void draw(sf::RenderWindow& window) override;
+    void submit(RenderQueue& queue, const sf::Vector2f& offset) override;
 
     bool isPlayerInside(const sf::FloatRect& playerBounds) const;
 
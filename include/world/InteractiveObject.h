@@ -3,6 +3,8 @@
 #include <SFML/Graphics.hpp>
 #include <string>
 
+class RenderQueue;
+
 enum class InteractiveType {
     Terminal,
     Door,
@@ -15,7 +17,7 @@ public:
     virtual ~InteractiveObject() = default;
 
     virtual void update(float dt);
-    virtual void draw(sf::RenderWindow& window);
+    virtual void submit(RenderQueue& queue) const;
 
     sf::FloatRect getBounds() const;
     sf::Vector2f getPosition() const { return position; }
@@ -0,0 +1,166 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Compiled level format (.lvlb), produced from the JSON sources by PlatformerPack and the editor.
+// A level is a list of fixed-size records per section plus one string table; LevelLoader
+// builds the runtime objects from them without any text parsing.
+// The JSON parsers fill the same LevelRecords, so every source goes through one instantiation path.
+//
+// On-disk layout (little-endian, every section 8-byte aligned):
+//   Header | platforms | checkpoints | interactive objects | enemies | camera zones | portals
+//   | background tiles | next levels (StringRef) | string table
+class LevelBinary {
+public:
+    static constexpr std::uint32_t MAGIC = 0x424C564C;   // "LVLB" little-endian
+    static constexpr std::uint32_t VERSION = 1;
+    static constexpr const char* EXTENSION = ".lvlb";
+
+    // Bytes [offset, offset + length) of the string table
+    struct StringRef {
+        std::uint32_t offset = 0;
+        std::uint32_t length = 0;
+    };
+
+    struct PlatformRecord {
+        float x, y, width, height;
+        std::uint32_t type;             // Platform::Type
+    };
+
+    struct CheckpointRecord {
+        float x, y;
+        StringRef id;
+    };
+
+    struct InteractiveRecord {
+        float x, y, width, height;
+        std::uint32_t type;             // InteractiveType
+        StringRef id;
+    };
+
+    enum class EnemyKind : std::uint32_t {
+        Patrol,
+        Flying,
+        Spike,
+        FlameTrap,
+        RotatingTrap
+    };
+
+    // Trap parameters only applied when their bit is set (the constructor defaults stay otherwise)
+    enum EnemyOverride : std::uint32_t {
+        OverrideActiveDuration   = 1u << 0,
+        OverrideInactiveDuration = 1u << 1,
+        OverrideShotInterval     = 1u << 2,
+        OverrideProjectileSpeed  = 1u << 3,
+        OverrideProjectileRange  = 1u << 4,
+        OverrideRotationSpeed    = 1u << 5,
+        OverrideArmLength        = 1u << 6,
+        OverrideArmThickness     = 1u << 7
+    };
+
+    struct EnemyRecord {
+        std::uint32_t kind;             // EnemyKind
+        float x, y;
+        // EnemyStats, presets already applied
+        std::int32_t maxHP;
+        float sizeX, sizeY;
+        float speed;
+        std::int32_t damage;
+        std::uint8_t color[4];          // RGBA
+        std::uint32_t canShoot;
+        float shootCooldown;
+        float projectileSpeed;
+        float projectileRange;
+        float shootRange;
+        // Patrol / flying
+        float patrolDistance;
+        std::uint32_t horizontalPatrol;
+        // Flame trap
+        std::uint32_t direction;        // FlameDirection
+        float activeDuration;
+        float inactiveDuration;
+        float shotInterval;
+        float trapProjectileSpeed;
+        float trapProjectileRange;
+        // Rotating trap
+        float rotationSpeed;
+        float armLength;
+        float armThickness;
+        std::uint32_t overrides;        // EnemyOverride bits
+    };
+
+    struct CameraZoneRecord {
+        float minX, maxX, minY, maxY;
+    };
+
+    struct PortalRecord {
+        float x, y, width, height;
+        StringRef targetLevel;
+        StringRef spawnDirection;
+        float customSpawnX, customSpawnY;
+        std::uint32_t useCustomSpawn;
+    };
+
+    struct BackgroundTileRecord {
+        StringRef tile;
+        float x, y, width, height;
+    };
+
+    struct Header {
+        std::uint32_t magic;
+        std::uint32_t version;
+        StringRef name;
+        StringRef levelId;
+        StringRef nextZone;
+        std::int32_t zoneNumber;
+        std::uint32_t isBossLevel;
+        float startX, startY;
+        std::uint32_t platformCount;
+        std::uint32_t checkpointCount;
+        std::uint32_t interactiveCount;
+        std::uint32_t enemyCount;
+        std::uint32_t cameraZoneCount;
+        std::uint32_t portalCount;
+        std::uint32_t backgroundTileCount;
+        std::uint32_t nextLevelCount;
+        std::uint32_t stringTableSize;
+        float sectorSize;               // 0: no enemy sleep (files written before it hold 0 here)
+    };
+
+    // A level as records (what the parsers produce and what a .lvlb file holds)
+    struct LevelRecords {
+        StringRef name;
+        StringRef levelId;
+        StringRef nextZone;
+        std::int32_t zoneNumber = 1;
+        bool isBossLevel = false;
+        float startX = 100.0f;
+        float startY = 100.0f;
+        float sectorSize = 0.0f;
+        std::vector<PlatformRecord> platforms;
+        std::vector<CheckpointRecord> checkpoints;
+        std::vector<InteractiveRecord> interactiveObjects;
+        std::vector<EnemyRecord> enemies;
+        std::vector<CameraZoneRecord> cameraZones;
+        std::vector<PortalRecord> portals;
+        std::vector<BackgroundTileRecord> backgroundTiles;
+        std::vector<StringRef> nextLevels;
+        std::string strings;
+
+        StringRef addString(const std::string& value);
+        std::string getString(const StringRef& ref) const;
+    };
+
+    // "assets/levels/zone1_level1.json" -> "assets/levels/zone1_level1.lvlb"
+    static std::string pathFor(const std::string& sourcePath);
+
+    static bool write(const LevelRecords& level, const std::string& path);
+    // Bulk copies the record sections out of `data` (a mapped file or pack entry).
+    // False on a bad magic, an older version or a truncated file.
+    static bool read(const std::uint8_t* data, std::size_t size, LevelRecords& out);
+    // Maps `path` and reads it
+    static bool readFile(const std::string& path, LevelRecords& out);
+};
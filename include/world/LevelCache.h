@@ -0,0 +1,54 @@
+#pragma once
+
+#include "world/LevelBinary.h"
+#include <cstddef>
+#include <filesystem>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+// LRU cache of parsed levels (immutable LevelRecords templates), keyed by resolved path.
+// An entry is only valid for the source modification time it was parsed from: editing the
+// JSON (editor save, text editor) makes the next load miss. Shared by the game thread and
+// LevelPrefetcher, hence the lock. Revisits and respawns go straight to
+// LevelLoader::instantiate() without touching the disk or the parser.
+class LevelCache {
+public:
+    using Stamp = std::filesystem::file_time_type;
+    using Template = std::shared_ptr<const LevelBinary::LevelRecords>;
+
+    static LevelCache& getInstance();
+
+    // Modification time of a level source (fixed for pack entries: the pack is read-only).
+    // False when the file cannot be found.
+    static bool getStamp(const std::string& path, Stamp& out);
+
+    // Null when absent or parsed from another version of the file
+    Template find(const std::string& path, Stamp stamp);
+    void store(const std::string& path, Stamp stamp, Template records);
+    void invalidate(const std::string& path);
+    void clear();
+
+    void setCapacity(std::size_t levels);
+    std::size_t getSize() const;
+
+private:
+    struct Entry {
+        std::string path;
+        Stamp stamp;
+        Template records;
+    };
+
+    LevelCache();
+    LevelCache(const LevelCache&) = delete;
+    LevelCache& operator=(const LevelCache&) = delete;
+
+    void trim();
+
+    std::size_t capacity;
+    std::list<Entry> entries;   // Most recently used first
+    std::unordered_map<std::string, std::list<Entry>::iterator> index;
+    mutable std::mutex mutex;
+};
@@ -6,6 +6,8 @@
 #include "world/Platform.h"
 #include "world/Checkpoint.h"
 #include "world/InteractiveObject.h"
+#include "physics/PlatformIndex.h"
+#include "world/LevelBinary.h"
 #include <SFML/Graphics.hpp>
 
 // Forward declarations
@@ -25,38 +27,72 @@ struct Portal {
     bool useCustomSpawn;            // Utiliser la position personnalisée
 };
 
+// Zone du fond remplie avec une tuile variante (ex: "bgWallCables32")
+struct BackgroundTile {
+    std::string tile;               // Nom de la variante
+    float x, y;                     // Coin haut-gauche (aligné sur la grille de 32px au rendu)
+    float width, height;
+};
+
 struct LevelData {
     std::string name;
     std::string levelId;          // Unique ID (e.g., "zone1_level1", "zone2_north")
     int zoneNumber;               // Zone number (1, 2, 3, etc.)
     bool isBossLevel;             // Is this a boss level?
+    float sectorSize = 0.0f;      // Enemy sleep sector size in px (0: every enemy is simulated)
     std::string nextZone;         // Next zone ID if boss completed
     std::vector<std::string> nextLevels;  // Possible next levels (for non-linear progression)
     sf::Vector2f startPosition;
     std::vector<std::unique_ptr<Platform>> platforms;
+    PlatformIndex platformIndex;    // Broad phase over platforms, built by LevelLoader
     std::vector<std::unique_ptr<Checkpoint>> checkpoints;
     std::vector<std::unique_ptr<InteractiveObject>> interactiveObjects;
     std::vector<std::unique_ptr<Enemy>> enemies;
     std::vector<CameraZone> cameraZones;
     std::vector<Portal> portals;    // Portails/limites pour changer de niveau
+    std::vector<BackgroundTile> backgroundTiles;  // Variantes du mur de fond (dessinées par BackgroundLayer)
 };
 
 class LevelLoader {
 public:
+    enum class Parser {
+        Auto,     // Compiled .lvlb when available and up to date, JSON source otherwise
+        Json,     // JSON source: nlohmann/json when compiled in, built-in single-pass reader otherwise
+        Legacy    // JSON source, built-in reader only
+    };
+
     LevelLoader() = default;
     ~LevelLoader() = default;
 
     // Resolve level path (search source/assets locations)
     static std::string resolveLevelPath(const std::string& filepath);
 
-    // Load level from JSON file
-    static std::unique_ptr<LevelData> loadFromFile(const std::string& filepath);
+    // Load level from its JSON path (asset pack entry first, loose file otherwise)
+    static std::unique_ptr<LevelData> loadFromFile(const std::string& filepath, Parser parser = Parser::Auto);
+
+    // Parsed level without any runtime object, so it can run off the main thread (LevelPrefetcher).
+    // Parser::Auto goes through LevelCache, then the compiled level, then the JSON source;
+    // Json/Legacy always parse the source. Null on failure.
+    // `label` tags the load summary ("cache", "binary", "json", none for the built-in reader)
+    static std::shared_ptr<const LevelBinary::LevelRecords> loadTemplate(const std::string& filepath, Parser parser,
+                                                                         const char*& label);
+
+    // Runtime objects from records, whatever their source (main thread)
+    static std::unique_ptr<LevelData> instantiate(const LevelBinary::LevelRecords& records, const char* label);
+
+    // Parse a JSON level and write it as a compiled level (PlatformerPack, editor save)
+    static bool compileLevel(const std::string& sourcePath, const std::string& outputPath);
+
+    // True when built with nlohmann/json
+    static bool hasJsonLibrary();
 
     // Create a default level if file loading fails
     static std::unique_ptr<LevelData> createDefaultLevel();
 
 private:
-    // Helper to parse JSON manually (simple key-value parser)
-    static std::string trim(const std::string& str);
-    static float parseFloat(const std::string& str);
+    // Records of the compiled level (asset pack entry, or loose .lvlb at least as recent as its JSON)
+    static bool loadCompiled(const std::string& filepath, LevelBinary::LevelRecords& out);
+    // Reads and parses the JSON source; `label` tags the load summary ("json", none for the built-in reader)
+    static bool parseSource(const std::string& filepath, Parser parser, LevelBinary::LevelRecords& out,
+                            const char*& label);
 };
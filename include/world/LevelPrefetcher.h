@@ -0,0 +1,64 @@
+#pragma once
+
+#include "world/LevelBinary.h"
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+// Parses the levels reachable from the active one (nextLevels, portal targets) on a
+// background thread, so a portal transition only instantiates records already in memory.
+// Only records are produced off the main thread: building the Platform/Enemy objects
+// stays on the game thread (LevelLoader::instantiate).
+//
+// want() replaces the wanted set: queued or parsed levels that are no longer wanted are
+// dropped (cancellation when the player heads for another portal). Parsed levels are kept
+// while their total size stays under the memory cap; a level over the cap is discarded
+// and loaded synchronously when needed.
+class LevelPrefetcher {
+public:
+    explicit LevelPrefetcher(std::size_t maxBytes);
+    ~LevelPrefetcher();
+
+    LevelPrefetcher(const LevelPrefetcher&) = delete;
+    LevelPrefetcher& operator=(const LevelPrefetcher&) = delete;
+
+    // Resolved level paths, in priority order (the first one is parsed first)
+    void want(const std::vector<std::string>& paths);
+    // Forget every queued and parsed level (new game, editor)
+    void clear();
+
+    // Hands the parsed level of `path` over and forgets it. Waits when the worker is
+    // parsing it right now; false when it was never requested, dropped or failed.
+    bool take(const std::string& path, std::shared_ptr<const LevelBinary::LevelRecords>& out,
+              const char*& label);
+
+    std::size_t getReadyBytes() const;
+
+private:
+    struct Ready {
+        std::shared_ptr<const LevelBinary::LevelRecords> records;   // Shared with LevelCache
+        const char* label = nullptr;
+        std::size_t bytes = 0;
+    };
+
+    void threadMain();
+    bool isWanted(const std::string& path) const;
+
+    const std::size_t maxBytes;
+    std::vector<std::string> wanted;
+    std::deque<std::string> queue;                  // Wanted, not parsed yet
+    std::unordered_map<std::string, Ready> ready;   // Parsed, waiting for a transition
+    std::size_t readyBytes = 0;
+    std::string parsing;                            // Being parsed by the worker (empty when idle)
+
+    bool stopRequested = false;
+    mutable std::mutex mutex;
+    std::condition_variable changed;
+    std::thread thread;
+};
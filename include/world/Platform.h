@@ -14,6 +14,11 @@ public:
 
     void draw(sf::RenderWindow& window);
 
+    // Batched rendering (PlatformRenderer): appends this platform's quad, textured like
+    // the sprite (repeated horizontally, stretched vertically) or in its fallback colour
+    void appendVertices(sf::VertexArray& vertices) const;
+    const sf::Texture* getTexture() const { return getTextureForType(platformType); }
+
     sf::FloatRect getBounds() const;
     sf::Vector2f getPosition() const { return position; }
     sf::Vector2f getSize() const { return size; }
@@ -40,4 +45,5 @@ private:
     
     void updateSprite();
     sf::Texture* getTextureForType(Type type) const;
+    sf::Color getFallbackColor() const;
 };
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+class Enemy;
+
+// Enemy sleep by sector for large levels (LevelData::sectorSize > 0), owned by the World.
+// Not streaming: every platform, object and enemy of the level stays loaded and indexed.
+// The level is cut into fixed-size square sectors and enemies are bucketed by the sector
+// holding their center; only the sectors around the focus (active player) are simulated.
+// Hysteresis: a sector wakes up within SECTOR_ACTIVE_RADIUS sectors of the focus and only
+// goes back to sleep beyond SECTOR_EVICT_RADIUS, so walking along a border does not toggle it.
+// Sleeping enemies keep their whole state (HP, timers, patrol position) and resume as they were.
+// Sleeping only stops the enemy's own update: it stays in the EnemyGrid, so it is still drawn
+// and kinetic waves, attacks and contact still hit it (a small sector can be on screen).
+// Hits resolve on the spot (damage, death effects), nothing waits for the enemy's update.
+// With a sector size of 0 every enemy is active: small levels behave exactly as before.
+class SectorMap {
+public:
+    SectorMap();
+
+    // Bucket `enemies` (after a level load or an editor session)
+    void build(float sectorSize, const std::vector<std::unique_ptr<Enemy>>& enemies);
+    void clear();
+
+    bool isEnabled() const { return sectorSize > 0.0f; }
+    float getSectorSize() const { return sectorSize; }
+    // Moves the active window around `focus` (no-op while it stays in the same sector)
+    void setFocus(const sf::Vector2f& focus);
+    // Rebuckets active enemies that walked into another sector
+    void updateMembership();
+
+    // Enemies to simulate this step, in enemy-list order
+    const std::vector<Enemy*>& getActiveEnemies() const { return activeEnemies; }
+    // Their indices in the enemy list (EnemyGrid slots)
+    const std::vector<std::int32_t>& getActiveIndices() const { return activeIndices; }
+    std::size_t getActiveSectorCount() const { return activeSectors.size(); }
+
+private:
+    static std::int64_t key(int sx, int sy);
+    std::int64_t sectorOf(const Enemy& enemy) const;
+    void refreshActiveEnemies();
+
+    float sectorSize;
+    std::vector<Enemy*> enemies;                      // Same order as the World's list (null kept)
+    std::vector<std::int64_t> enemySectors;           // Per enemy
+    std::unordered_map<std::int64_t, std::vector<std::int32_t>> buckets;   // Sector -> enemy indices
+    std::unordered_set<std::int64_t> activeSectors;
+    std::vector<std::int32_t> activeIndices;
+    std::vector<std::int32_t> previousIndices;        // Active set before the last refresh
+    std::vector<Enemy*> activeEnemies;
+    bool hasFocus;
+    int focusX;
+    int focusY;
+};
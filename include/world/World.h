@@ -0,0 +1,154 @@
+#pragma once
+
+#include "core/Config.h"
+#include "physics/EnemyGrid.h"
+#include "physics/PlatformIndex.h"
+#include "world/SectorMap.h"
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Forward declarations to reduce compile-time coupling
+class Player;
+class Enemy;
+class KineticWaveProjectile;
+class EnemyProjectile;
+class Platform;
+class Checkpoint;
+class InteractiveObject;
+struct LevelData;
+struct Portal;
+class ParticleSystem;
+class CameraShake;
+class AudioManager;
+
+// Logical input for the active player, sampled once per frame.
+// Game fills it from the keyboard; PlatformerSim fills it from a script.
+struct PlayerInput {
+    bool moveLeft = false;
+    bool moveRight = false;
+    bool jump = false;
+    bool ability = false;
+    bool dash = false;
+    bool up = false;     // Regarder en haut / entrer dans une porte
+    bool down = false;
+};
+
+// Gameplay events produced by one World::update step.
+// The owner (Game or PlatformerSim) decides what they mean (UI, saves, transitions).
+struct WorldEvents {
+    bool playerDied = false;
+    bool playerRespawned = false;
+    Checkpoint* reachedCheckpoint = nullptr;  // First non-activated checkpoint touched this step
+    const Portal* enteredPortal = nullptr;    // Set when the step stopped on a portal
+    bool doorUsed = false;                    // Up pressed while inside a Door
+};
+
+// Entities whose bounds touch a render area (camera view plus margin), in list order.
+// Filled by World::collectVisible; the vectors are reused frame to frame.
+struct VisibleSet {
+    std::vector<Checkpoint*> checkpoints;
+    std::vector<InteractiveObject*> interactiveObjects;
+    std::vector<Enemy*> enemies;   // Living only
+    std::vector<KineticWaveProjectile*> kineticWaveProjectiles;
+    std::vector<EnemyProjectile*> enemyProjectiles;
+};
+
+// Window-free simulation core: owns the level entities and steps gameplay.
+// No sf::RenderWindow, no keyboard polling; audio and camera shake are optional.
+class World {
+public:
+    // Particle capacity: the game keeps the default, PlatformerBench raises it for large fills
+    explicit World(std::size_t particleCapacity = Config::PARTICLE_CAPACITY);
+    ~World();
+
+    // Optional feedback systems (nullptr in headless mode)
+    void setAudioManager(AudioManager* audio) { audioManager = audio; }
+    void setCameraShake(CameraShake* shake) { cameraShake = shake; }
+
+    // Take ownership of a freshly loaded level (entities are moved out of LevelData)
+    void setLevel(std::unique_ptr<LevelData> level);
+    void clear();
+
+    // Spawn used when nothing better is known: first checkpoint, camera zone, fallback
+    sf::Vector2f getDefaultSpawnPosition() const;
+
+    // Players
+    void addPlayer(std::unique_ptr<Player> player);
+    Player* getActivePlayer() const;
+    int getActivePlayerIndex() const { return activePlayerIndex; }
+    void setActivePlayerIndex(int index) { activePlayerIndex = index; }
+    void switchCharacter();
+
+    // Simulation
+    void applyInput(const PlayerInput& input);
+    WorldEvents update(float dt);
+
+    // The editor added, removed or moved enemies: sectors and the enemy grid are rebuilt
+    // before their next use (steps only look at the active sectors otherwise)
+    void markEnemiesChanged() { enemiesVersion++; }
+    const SectorMap& getSectors() const { return sectors; }
+
+    // Render culling: enemies come from the enemy grid, the short lists are bounds-tested
+    void collectVisible(const sf::FloatRect& area, VisibleSet& out);
+
+    // Accessors (references so the editor and checkpoint systems can mutate in place)
+    LevelData* getLevel() const { return level.get(); }
+    std::vector<std::unique_ptr<Player>>& getPlayers() { return players; }
+    std::vector<std::unique_ptr<Platform>>& getPlatforms() { return platforms; }
+    PlatformIndex& getPlatformIndex() { return platformIndex; }
+    std::vector<std::unique_ptr<Checkpoint>>& getCheckpoints() { return checkpoints; }
+    std::vector<std::unique_ptr<InteractiveObject>>& getInteractiveObjects() { return interactiveObjects; }
+    std::vector<std::unique_ptr<Enemy>>& getEnemies() { return enemies; }
+    std::vector<std::unique_ptr<KineticWaveProjectile>>& getKineticWaveProjectiles() { return kineticWaveProjectiles; }
+    std::vector<std::unique_ptr<EnemyProjectile>>& getEnemyProjectiles() { return enemyProjectiles; }
+    ParticleSystem& getParticleSystem() { return *particleSystem; }
+
+private:
+    void resolvePlayerCollisions(Player& player, const sf::Vector2f& startPosition, bool sweep);
+    void updateAbilities(Player& player);
+    void updateProjectiles(Player& player, float dt);
+    void updatePlayerAttack(Player& player);
+    void updateEnemies(Player& player, float dt);
+    void rebuildSectors();
+    void syncEnemyGrid();
+
+    // Null-safe feedback helpers
+    void playSound(const std::string& name, float volume);
+    void shakeLight();
+    void shakeMedium();
+
+private:
+    std::vector<std::unique_ptr<Player>> players;
+    int activePlayerIndex;
+    std::vector<std::unique_ptr<Platform>> platforms;
+    PlatformIndex platformIndex;
+    std::vector<std::unique_ptr<Checkpoint>> checkpoints;
+    std::vector<std::unique_ptr<InteractiveObject>> interactiveObjects;
+    std::vector<std::unique_ptr<Enemy>> enemies;
+    std::vector<std::unique_ptr<KineticWaveProjectile>> kineticWaveProjectiles;
+    std::vector<std::unique_ptr<EnemyProjectile>> enemyProjectiles;
+    std::unique_ptr<LevelData> level;
+    EnemyGrid enemyGrid;   // Every enemy, sleeping ones included (see SectorMap)
+    SectorMap sectors;   // Enemies simulated this step (all of them unless the level has a sectorSize)
+    std::uint64_t enemiesVersion;   // Bumped by markEnemiesChanged()
+    std::uint64_t builtVersion;     // enemiesVersion at the last rebuildSectors()
+    std::vector<Platform*> nearbyPlatforms;   // Broad-phase query scratch
+    std::vector<sf::FloatRect> sweptObstacles;
+    std::vector<Enemy*> nearbyEnemies;
+
+    std::unique_ptr<ParticleSystem> particleSystem;
+    AudioManager* audioManager;
+    CameraShake* cameraShake;
+
+    // Per-frame input / ability state (edge detection)
+    PlayerInput currentInput;
+    bool abilityKeyHeld;
+    bool dashKeyHeld;
+    bool doorKeyHeld;
+    float lastAbilityTimer;
+    bool playerWasDead;
+};
@@ -1,4 +1,6 @@
 #include "audio/AudioManager.h"
+#include "core/AssetPack.h"
+#include "core/AssetFileSystem.h"
 #include <iostream>
 #include <algorithm>
 #include <set>
@@ -15,7 +17,11 @@ AudioManager::AudioManager()
 
 bool AudioManager::loadSound(const std::string& name, const std::string& filepath) {
     sf::SoundBuffer buffer;
-    if (!buffer.loadFromFile(filepath)) {
+    AssetPack::DataView packed;
+    const bool loaded = AssetPack::getInstance().findData(filepath, packed)
+        ? buffer.loadFromMemory(packed.data, packed.size)
+        : buffer.loadFromFile(AssetFileSystem::getInstance().resolve(filepath));
+    if (!loaded) {
         std::cout << "Warning: Could not load sound: " << filepath << "\n";
         return false;
     }
@@ -25,7 +31,12 @@ bool AudioManager::loadSound(const std::string& name, const std::string& filepat
 
 bool AudioManager::loadMusic(const std::string& name, const std::string& filepath) {
     auto music = std::make_unique<sf::Music>();
-    if (!music->openFromFile(filepath)) {
+    // Streams straight from the pack mapping (it stays mapped for the whole run)
+    AssetPack::DataView packed;
+    const bool opened = AssetPack::getInstance().findData(filepath, packed)
+        ? music->openFromMemory(packed.data, packed.size)
+        : music->openFromFile(AssetFileSystem::getInstance().resolve(filepath));
+    if (!opened) {
         std::cout << "Warning: Could not load music: " << filepath << "\n";
         return false;
     }
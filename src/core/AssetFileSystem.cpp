@@ -0,0 +1,120 @@
+#include "core/AssetFileSystem.h"
+#include "core/AssetPack.h"
+#include <algorithm>
+#include <filesystem>
+
+namespace fs = std::filesystem;
+
+AssetFileSystem& AssetFileSystem::getInstance() {
+    static AssetFileSystem instance;
+    return instance;
+}
+
+AssetFileSystem::AssetFileSystem() {
+    std::error_code ec;
+    const fs::path cwd = fs::current_path(ec);
+    if (ec) {
+        return;
+    }
+
+    // Project source directory first: levels saved by the editor land there, not in a build copy
+    fs::path probe = cwd;
+    for (int i = 0; i < 10 && !probe.empty(); ++i) {
+        if (probe.filename() == "PlatformerGame") {
+            sourceRoot = probe.string();
+            break;
+        }
+        if (probe.filename() == "nouveauprojet") {
+            sourceRoot = (probe / "PlatformerGame").string();
+            break;
+        }
+        if (probe == probe.parent_path()) break;
+        probe = probe.parent_path();
+    }
+
+    if (!sourceRoot.empty()) {
+        mountDirectory(sourceRoot);
+    }
+    mountDirectory(cwd.string());
+    // Common build output directories
+    mountDirectory((cwd / "bin" / "Release").string());
+    mountDirectory((cwd / "bin" / "Debug").string());
+    mountDirectory(cwd.parent_path().string());
+}
+
+bool AssetFileSystem::mountPack(const std::string& packPath) {
+    return AssetPack::getInstance().open(packPath);
+}
+
+void AssetFileSystem::mountDirectory(const std::string& root) {
+    std::error_code ec;
+    const fs::path rootPath = fs::weakly_canonical(fs::path(root), ec);
+    if (ec || !fs::is_directory(rootPath / "assets", ec)) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    const std::string rootName = rootPath.string();
+    if (std::find(roots.begin(), roots.end(), rootName) != roots.end()) {
+        return;
+    }
+    roots.push_back(rootName);
+
+    // One directory walk per mount; loads never probe the filesystem afterwards
+    fs::recursive_directory_iterator it(rootPath / "assets", fs::directory_options::skip_permission_denied, ec);
+    for (; !ec && it != fs::recursive_directory_iterator(); it.increment(ec)) {
+        if (!it->is_regular_file(ec)) continue;
+        const std::string key = it->path().lexically_relative(rootPath).generic_string();
+        files.emplace(key, it->path().string());
+    }
+}
+
+std::string AssetFileSystem::resolve(const std::string& path) const {
+    // Baked assets are looked up by their asset path: the pack serves them
+    if (path.empty() || AssetPack::getInstance().contains(path) || fs::path(path).is_absolute()) {
+        return path;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = files.find(normalize(path));
+    return it != files.end() ? it->second : path;
+}
+
+bool AssetFileSystem::exists(const std::string& path) const {
+    if (AssetPack::getInstance().contains(path)) {
+        return true;
+    }
+    std::lock_guard<std::mutex> lock(mutex);
+    return files.count(normalize(path)) != 0;
+}
+
+std::string AssetFileSystem::getWritablePath(const std::string& path) const {
+    const std::string key = normalize(path);
+    if (!sourceRoot.empty()) {
+        return (fs::path(sourceRoot) / key).string();
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = files.find(key);
+    if (it != files.end()) {
+        return it->second;
+    }
+    if (!roots.empty()) {
+        return (fs::path(roots.front()) / key).string();
+    }
+    return path;
+}
+
+void AssetFileSystem::addFile(const std::string& path, const std::string& looseFile) {
+    std::lock_guard<std::mutex> lock(mutex);
+    files[normalize(path)] = looseFile;
+}
+
+std::string AssetFileSystem::normalize(const std::string& path) {
+    std::string key = path;
+    std::replace(key.begin(), key.end(), '\\', '/');
+    while (key.compare(0, 2, "./") == 0) {
+        key.erase(0, 2);
+    }
+    return key;
+}
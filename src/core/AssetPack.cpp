@@ -0,0 +1,117 @@
+#include "core/AssetPack.h"
+#include "core/Logger.h"
+#include <cstring>
+
+AssetPack& AssetPack::getInstance() {
+    static AssetPack instance;
+    return instance;
+}
+
+AssetPack::~AssetPack() {
+    close();
+}
+
+std::string AssetPack::normalizeKey(const std::string& path) {
+    std::string key = path;
+    for (char& c : key) {
+        if (c == '\\') c = '/';
+    }
+    while (key.compare(0, 2, "./") == 0) {
+        key.erase(0, 2);
+    }
+    return key;
+}
+
+bool AssetPack::open(const std::string& path) {
+    close();
+    if (!file.open(path)) {
+        return false;
+    }
+    if (!readIndex()) {
+        Logger::error("Invalid asset pack: " + path);
+        close();
+        return false;
+    }
+
+    Logger::info("Asset pack " + path + " mapped (" + std::to_string(entries.size()) + " entries)");
+    return true;
+}
+
+void AssetPack::close() {
+    entries.clear();
+    file.close();
+}
+
+bool AssetPack::readIndex() {
+    const std::uint8_t* mapped = file.getData();
+    const std::size_t mappedSize = file.getSize();
+    if (mappedSize < sizeof(Header)) {
+        return false;
+    }
+
+    Header header;
+    std::memcpy(&header, mapped, sizeof(Header));
+    if (header.magic != MAGIC || header.version != VERSION) {
+        return false;
+    }
+
+    std::size_t cursor = sizeof(Header);
+    entries.reserve(header.entryCount);
+    for (std::uint32_t i = 0; i < header.entryCount; ++i) {
+        if (cursor + sizeof(IndexEntry) > mappedSize) {
+            return false;
+        }
+        IndexEntry entry;
+        std::memcpy(&entry, mapped + cursor, sizeof(IndexEntry));
+        cursor += sizeof(IndexEntry);
+
+        if (cursor + entry.nameLength > mappedSize ||
+            entry.offset > mappedSize || entry.size > mappedSize - entry.offset) {
+            return false;
+        }
+        if (entry.type == static_cast<std::uint32_t>(EntryType::Image) &&
+            static_cast<std::uint64_t>(entry.width) * entry.height * 4 != entry.size) {
+            return false;
+        }
+
+        std::string name(reinterpret_cast<const char*>(mapped + cursor), entry.nameLength);
+        cursor += entry.nameLength;
+
+        entries[name] = Record{static_cast<EntryType>(entry.type), entry.offset, entry.size,
+                               entry.width, entry.height};
+    }
+    return true;
+}
+
+const AssetPack::Record* AssetPack::find(const std::string& path) const {
+    if (entries.empty()) {
+        return nullptr;
+    }
+    auto it = entries.find(normalizeKey(path));
+    return it != entries.end() ? &it->second : nullptr;
+}
+
+bool AssetPack::contains(const std::string& path) const {
+    return find(path) != nullptr;
+}
+
+bool AssetPack::findData(const std::string& path, DataView& out) const {
+    const Record* record = find(path);
+    if (!record || record->type != EntryType::Raw) {
+        return false;
+    }
+    out.data = file.getData() + record->offset;
+    out.size = static_cast<std::size_t>(record->size);
+    return true;
+}
+
+bool AssetPack::findImage(const std::string& path, ImageView& out) const {
+    const Record* record = find(path);
+    if (!record || record->type != EntryType::Image) {
+        return false;
+    }
+    out.pixels = file.getData() + record->offset;
+    out.width = record->width;
+    out.height = record->height;
+    return true;
+}
@@ -2,6 +2,9 @@
 // Central place where input, physics, combat and UI are orchestrated.
 #include "core/Game.h"
 #include "core/Config.h"
+#include "core/AssetPack.h"
+#include "core/AssetFileSystem.h"
+#include "core/RenderThread.h"
 #include "core/InputConfig.h"
 #include "core/Logger.h"
 #include "core/SaveSystem.h"
@@ -19,6 +22,8 @@
 #include "world/Checkpoint.h"
 #include "world/InteractiveObject.h"
 #include "world/LevelLoader.h"
+#include "world/LevelPrefetcher.h"
+#include "world/World.h"
 #include "editor/EditorController.h"
 #include "systems/CheckpointManager.h"
 #include "systems/PortalSpawner.h"
@@ -34,22 +39,24 @@
 #include "effects/ScreenTransition.h"
 #include "audio/AudioManager.h"
 #include "graphics/SpriteManager.h"
-#include "physics/CollisionSystem.h"
+#include "graphics/BackgroundLayer.h"
+#include "graphics/PlatformRenderer.h"
+#include "graphics/RenderQueue.h"
 #include "debug/HitboxDebug.h"
+#include "debug/Profiler.h"
+#include "debug/ProfilerOverlay.h"
 #include <iostream>
 #include <cstring>
 #include <algorithm>
 #include <cmath>
-#include <unordered_map>
-#include <cstdint>
+#include <ctime>
+#include <chrono>
 
 Game::Game()
     : window(sf::VideoMode(Config::WINDOW_WIDTH, Config::WINDOW_HEIGHT), Config::WINDOW_TITLE)
     , gameState(GameState::TitleScreen)
     , previousState(GameState::TitleScreen)
-    , activePlayerIndex(0)
     , isRunning(true)
-    , playerWasDead(false)
     , levelCompleted(false)
     , victoryEffectsTriggered(false)
     , isTransitioning(false)
@@ -57,29 +64,40 @@ Game::Game()
     , secretRoomUnlocked(false)
     , fpsUpdateTime(0.0f)
     , frameCount(0)
+    , fpsValue(0)
+    , fpsShown(0)   // Empty text until the first measure, like before
     , activeCheckpointId("")
     , lastGlobalCheckpointLevel("")
     , lastGlobalCheckpointId("")
     , lastGlobalCheckpointPos(0.0f, 0.0f)
-    , bgWallPlain32(nullptr)
-    , bgWallCables32(nullptr)
     , bgFarTexture(nullptr)
-    , bgWallPlainVarA32(nullptr)
-    , bgWallPlainVarB32(nullptr)
-    , bgWallCablesAlt32(nullptr)
-    , doorKeyHeld(false)
-    , lastAbilityTimer(0.0f)
 {
     window.setFramerateLimit(Config::FRAMERATE_LIMIT);
 
     // Initialize logger
     Logger::init("game.log");
 
+    // Baked asset pack (optional): textures, levels and sounds are then served from one mapping.
+    // Mounted ahead of the asset directories, which are found and indexed once here
+    if (!AssetFileSystem::getInstance().mountPack(Config::ASSET_PACK_PATH)) {
+        Logger::info("No asset pack, loading loose files from assets/");
+    }
+
     // Create polish systems
-    particleSystem = std::make_unique<ParticleSystem>();
     cameraShake = std::make_unique<CameraShake>();
     audioManager = std::make_unique<AudioManager>();
     screenTransition = std::make_unique<ScreenTransition>();
+    backgroundLayer = std::make_unique<BackgroundLayer>();
+    platformRenderer = std::make_unique<PlatformRenderer>();
+    visibleSet = std::make_unique<VisibleSet>();
+    renderQueue = std::make_unique<RenderQueue>();
+    renderThread = std::make_unique<RenderThread>();
+    levelPrefetcher = std::make_unique<LevelPrefetcher>(Config::LEVEL_PREFETCH_MAX_BYTES);
+
+    // Simulation core (window-free; feedback goes through audio + camera shake)
+    world = std::make_unique<World>();
+    world->setAudioManager(audioManager.get());
+    world->setCameraShake(cameraShake.get());
 
     // Load audio files (optional - game works without them)
     audioManager->loadSound("jump", "assets/sounds/jump.wav");
@@ -138,9 +156,12 @@ Game::Game()
     // Check for existing save
     titleScreen->setCanContinue(SaveSystem::saveExists());
 
+    // Frame phases are always recorded so a spike can be dumped after it happened
+    Profiler::getInstance().setEnabled(true);
+
     // Setup FPS counter (optional, will work without font)
     if (Config::SHOW_FPS) {
-        if (!debugFont.loadFromFile("assets/fonts/arial.ttf")) {
+        if (!debugFont.loadFromFile(AssetFileSystem::getInstance().resolve("assets/fonts/arial.ttf"))) {
             std::cout << "Warning: Could not load font for FPS display\n";
         } else {
             fpsText.setFont(debugFont);
@@ -161,130 +182,122 @@ Game::Game()
 }
 
 Game::~Game() {
+    // Before anything the render thread draws from goes away
+    renderThread->stop();
+
     // Shutdown logger
     Logger::shutdown();
 }
 
 void Game::run() {
+    // Fixed-step simulation: physics cost and behaviour no longer depend on the frame rate
+    const float fixedDt = 1.0f / static_cast<float>(Config::SIMULATION_TICK_RATE);
+    float accumulator = 0.0f;
+
     while (window.isOpen() && isRunning) {
-        float dt = clock.restart().asSeconds();
+        if (Config::MENU_RENDER_ON_CHANGE && getActiveMenu()) {
+            runMenuFrame();
+            continue;
+        }
+
+        float frameTime = clock.restart().asSeconds();
+        Profiler::getInstance().beginFrame();
 
-        // Cap delta time to avoid spiral of death
-        if (dt > Config::MAX_DELTA_TIME) dt = Config::MAX_DELTA_TIME;
+        // Cap frame time to avoid spiral of death
+        if (frameTime > Config::MAX_DELTA_TIME) frameTime = Config::MAX_DELTA_TIME;
 
         processEvents();
-        update(dt);
-        render();
 
-        // FPS counter
+        accumulator += frameTime;
+        int steps = 0;
+        while (accumulator >= fixedDt && steps < Config::MAX_SIMULATION_STEPS) {
+            update(fixedDt);
+            Profiler::getInstance().countSimulationStep();
+            accumulator -= fixedDt;
+            steps++;
+        }
+
+        // Too slow to catch up: drop the backlog (game slows down instead of stalling)
+        if (accumulator >= fixedDt) {
+            accumulator = std::fmod(accumulator, fixedDt);
+        }
+
+        // Fraction of the next tick already elapsed, used to interpolate rendering
+        render(accumulator / fixedDt);
+        Profiler::getInstance().endFrame();
+
+        // FPS counter (formatted by whichever thread draws it)
         if (Config::SHOW_FPS) {
             frameCount++;
-            fpsUpdateTime += dt;
+            fpsUpdateTime += frameTime;
             if (fpsUpdateTime >= 1.0f) {
-                fpsText.setString("FPS: " + std::to_string(frameCount));
+                fpsValue = frameCount;
                 frameCount = 0;
                 fpsUpdateTime = 0.0f;
             }
         }
     }
+
+    renderThread->stop();
 }
 
-void Game::processEvents() {
-    sf::Event event;
-    while (window.pollEvent(event)) {
-        if (event.type == sf::Event::Closed) {
-            window.close();
-        }
+Menu* Game::getActiveMenu() const {
+    switch (gameState) {
+        case GameState::TitleScreen: return titleScreen.get();
+        case GameState::Paused: return pauseMenu.get();
+        case GameState::Settings: return settingsMenu.get();
+        case GameState::Controls: return keyBindingMenu.get();
+        default: return nullptr;
+    }
+}
 
-        if (event.type == sf::Event::KeyPressed) {
-            if (event.key.code == sf::Keyboard::Escape) {
-                // Only handle ESC for Playing state (open pause menu)
-                // All other states handle ESC through their menu systems
-                if (gameState == GameState::Playing) {
-                    setState(GameState::Paused);
-                    continue; // Don't pass this event to menus
-                }
-                // Note: All menu states (TitleScreen, Paused, Settings, Controls)
-                // handle ESC through their respective menu handleInput() methods
-            }
-            // Back to previous level with Backspace while playing (deprecated - use portals)
-            // if (event.key.code == sf::Keyboard::BackSpace && gameState == GameState::Playing) {
-            //     goBackOneLevel();
-            // }
-
-            // Character switch with TAB key (only during gameplay)
-            if (event.key.code == sf::Keyboard::Tab && gameState == GameState::Playing) {
-                switchCharacter();
-            }
+void Game::runMenuFrame() {
+    // Nothing moves in a menu until input arrives: sleep until then instead of redrawing 60 times a second
+    Menu* menu = getActiveMenu();
+    if (!menu->needsRedraw() && !redrawRequested && gameState == lastRenderedState) {
+        waitForEvent(sf::milliseconds(Config::MENU_IDLE_TIMEOUT_MS));
+    }
+    processEvents();
 
-            // Toggle editor mode with F1
-            if (event.key.code == sf::Keyboard::F1) {
-                if (gameState == GameState::Playing || gameState == GameState::Editor) {
-                    setState(gameState == GameState::Editor ? GameState::Playing : GameState::Editor);
-                }
-            }
-            
-            // Toggle hitbox display with F2
-            if (event.key.code == sf::Keyboard::F2) {
-                showHitboxes = !showHitboxes;
-            }
-        }
-        
-        // Attack with mouse click (only in Playing mode, not in Editor)
-        if (gameState == GameState::Playing && event.type == sf::Event::MouseButtonPressed) {
-            if (event.mouseButton.button == sf::Mouse::Left) {
-                Player* player = getActivePlayer();
-                if (player && !player->isDead() && player->canAttack()) {
-                    player->attack();
-                }
-            }
-        }
+    float frameTime = clock.restart().asSeconds();
+    if (frameTime > Config::MAX_DELTA_TIME) frameTime = Config::MAX_DELTA_TIME;
 
-        if (gameState == GameState::Editor && editorController) {
-            EditorContext editorCtx{
-                window,
-                camera.get(),
-                getActivePlayer(),
-                platforms,
-                enemies,
-                interactiveObjects,
-                checkpoints,
-                currentLevel.get(),
-                currentLevelPath,
-                [this](const std::string& path) -> LevelData* {
-                    loadLevel(path);
-                    return currentLevel.get();
-                }
-            };
-            editorController->handleEvent(event, editorCtx);
-            continue;
-        }
+    // Input may have left the menus (new game, resume): the fixed-step loop takes over
+    menu = getActiveMenu();
+    if (!menu) {
+        return;
+    }
+    update(frameTime);
 
-        // Handle mouse clicks
-        if (event.type == sf::Event::MouseButtonPressed && event.mouseButton.button == sf::Mouse::Left) {
-            sf::Vector2f mousePos(static_cast<float>(event.mouseButton.x), static_cast<float>(event.mouseButton.y));
-
-            if (gameState == GameState::TitleScreen && titleScreen) {
-                titleScreen->handleMouseClick(mousePos);
-            } else if (gameState == GameState::Paused && pauseMenu) {
-                pauseMenu->handleMouseClick(mousePos);
-            } else if (gameState == GameState::Settings && settingsMenu) {
-                settingsMenu->handleMouseClick(mousePos);
-            } else if (gameState == GameState::Controls && keyBindingMenu) {
-                keyBindingMenu->handleMouseClick(mousePos);
-            }
-        }
+    // Or opened another menu: draw whatever is active now
+    if (menu->needsRedraw() || redrawRequested || gameState != lastRenderedState) {
+        render(1.0f);
+        redrawRequested = false;
+        lastRenderedState = gameState;
+    }
+}
 
-        // Pass events to menus
-        if (gameState == GameState::TitleScreen && titleScreen) {
-            titleScreen->handleInput(event);
-        } else if (gameState == GameState::Paused && pauseMenu) {
-            pauseMenu->handleInput(event);
-        } else if (gameState == GameState::Settings && settingsMenu) {
-            settingsMenu->handleInput(event);
-        } else if (gameState == GameState::Controls && keyBindingMenu) {
-            keyBindingMenu->handleInput(event);
+bool Game::waitForEvent(sf::Time timeout) {
+    // SFML 2.5 has no waitEvent timeout: poll at a short interval, sleeping in between
+    sf::Clock waited;
+    sf::Event event;
+    while (window.isOpen()) {
+        if (window.pollEvent(event)) {
+            handleEvent(event);
+            return true;
         }
+        if (waited.getElapsedTime() >= timeout) {
+            return false;
+        }
+        sf::sleep(sf::milliseconds(Config::MENU_IDLE_POLL_MS));
+    }
+    return false;
+}
+
+void Game::processEvents() {
+    sf::Event event;
+    while (window.pollEvent(event)) {
+        handleEvent(event);
     }
 
     // Handle mouse movement (for hover effects)
@@ -303,64 +316,118 @@ void Game::processEvents() {
         }
     }
 
-    // Handle gameplay input only when playing
-    if (gameState == GameState::Playing) {
-        handleInput();
-    }
 }
 
-void Game::handleInput() {
-    const InputBindings& bindings = InputConfig::getInstance().getBindings();
-    Player* player = getActivePlayer();
-    if (!player) return;
-
-    // Disable inputs while dead (no movement or actions during death animation)
-    if (player->isDead()) {
-        // lock horizontal velocity
-        sf::Vector2f v = player->getVelocity();
-        player->setVelocity(0.0f, v.y);
-        return;
+void Game::handleEvent(const sf::Event& event) {
+    if (event.type == sf::Event::Resized || event.type == sf::Event::GainedFocus) {
+        redrawRequested = true;
     }
 
-    // Jump (check every frame for better responsiveness)
-    if (sf::Keyboard::isKeyPressed(bindings.jump)) {
-        player->jump();
+    if (event.type == sf::Event::Closed) {
+        renderThread->stop();
+        window.close();
     }
 
-    // Special ability (one-shot activation on key press)
-    static bool abilityKeyPressed = false;
-    if (sf::Keyboard::isKeyPressed(bindings.ability)) {
-        if (!abilityKeyPressed && player->canUseAbility()) {
-            player->useAbility();
-            abilityKeyPressed = true;
+    if (event.type == sf::Event::KeyPressed) {
+        if (event.key.code == sf::Keyboard::Escape) {
+            // Only handle ESC for Playing state (open pause menu)
+            // All other states handle ESC through their menu systems
+            if (gameState == GameState::Playing) {
+                setState(GameState::Paused);
+                return; // Don't pass this event to menus
+            }
+            // Note: All menu states (TitleScreen, Paused, Settings, Controls)
+            // handle ESC through their respective menu handleInput() methods
         }
-    } else {
-        abilityKeyPressed = false;
-    }
+        // Back to previous level with Backspace while playing (deprecated - use portals)
+        // if (event.key.code == sf::Keyboard::BackSpace && gameState == GameState::Playing) {
+        //     goBackOneLevel();
+        // }
 
-    // Dash (one-shot activation on key press)
-    static bool dashKeyPressed = false;
-    if (sf::Keyboard::isKeyPressed(bindings.dash)) {
-        if (!dashKeyPressed && player->canDash()) {
-            player->dash();
-            dashKeyPressed = true;
+        // Character switch with TAB key (only during gameplay)
+        if (event.key.code == sf::Keyboard::Tab && gameState == GameState::Playing) {
+            switchCharacter();
+        }
+
+        // Toggle editor mode with F1
+        if (event.key.code == sf::Keyboard::F1) {
+            if (gameState == GameState::Playing || gameState == GameState::Editor) {
+                setState(gameState == GameState::Editor ? GameState::Playing : GameState::Editor);
+            }
+        }
+        
+        // Toggle hitbox display with F2
+        if (event.key.code == sf::Keyboard::F2) {
+            showHitboxes = !showHitboxes;
+        }
+
+        // Toggle profiler overlay with F3, dump the recorded frames to CSV with F4
+        if (event.key.code == sf::Keyboard::F3) {
+            showProfiler = !showProfiler;
+        }
+        if (event.key.code == sf::Keyboard::F4) {
+            Profiler::getInstance().exportCSV("profiler_" + std::to_string(std::time(nullptr)) + ".csv");
+        }
+    }
+    
+    // Attack with mouse click (only in Playing mode, not in Editor)
+    if (gameState == GameState::Playing && event.type == sf::Event::MouseButtonPressed) {
+        if (event.mouseButton.button == sf::Mouse::Left) {
+            Player* player = getActivePlayer();
+            if (player && !player->isDead() && player->canAttack()) {
+                player->attack();
+            }
         }
-    } else {
-        dashKeyPressed = false;
     }
 
-    // Horizontal movement
-    if (sf::Keyboard::isKeyPressed(bindings.moveLeft) || sf::Keyboard::isKeyPressed(sf::Keyboard::Left)) {
-        player->moveLeft();
+    if (gameState == GameState::Editor && editorController) {
+        EditorContext editorCtx = makeEditorContext();
+        editorController->handleEvent(event, editorCtx);
+        return;
     }
-    else if (sf::Keyboard::isKeyPressed(bindings.moveRight) || sf::Keyboard::isKeyPressed(sf::Keyboard::Right)) {
-        player->moveRight();
+
+    // Handle mouse clicks
+    if (event.type == sf::Event::MouseButtonPressed && event.mouseButton.button == sf::Mouse::Left) {
+        sf::Vector2f mousePos(static_cast<float>(event.mouseButton.x), static_cast<float>(event.mouseButton.y));
+
+        if (gameState == GameState::TitleScreen && titleScreen) {
+            titleScreen->handleMouseClick(mousePos);
+        } else if (gameState == GameState::Paused && pauseMenu) {
+            pauseMenu->handleMouseClick(mousePos);
+        } else if (gameState == GameState::Settings && settingsMenu) {
+            settingsMenu->handleMouseClick(mousePos);
+        } else if (gameState == GameState::Controls && keyBindingMenu) {
+            keyBindingMenu->handleMouseClick(mousePos);
+        }
     }
-    else {
-        player->stopMoving();
+
+    // Pass events to menus
+    if (gameState == GameState::TitleScreen && titleScreen) {
+        titleScreen->handleInput(event);
+    } else if (gameState == GameState::Paused && pauseMenu) {
+        pauseMenu->handleInput(event);
+    } else if (gameState == GameState::Settings && settingsMenu) {
+        settingsMenu->handleInput(event);
+    } else if (gameState == GameState::Controls && keyBindingMenu) {
+        keyBindingMenu->handleInput(event);
     }
 }
 
+void Game::handleInput() {
+    const InputBindings& bindings = InputConfig::getInstance().getBindings();
+
+    PlayerInput input;
+    input.jump = sf::Keyboard::isKeyPressed(bindings.jump);
+    input.ability = sf::Keyboard::isKeyPressed(bindings.ability);
+    input.dash = sf::Keyboard::isKeyPressed(bindings.dash);
+    input.moveLeft = sf::Keyboard::isKeyPressed(bindings.moveLeft) || sf::Keyboard::isKeyPressed(sf::Keyboard::Left);
+    input.moveRight = sf::Keyboard::isKeyPressed(bindings.moveRight) || sf::Keyboard::isKeyPressed(sf::Keyboard::Right);
+    input.up = sf::Keyboard::isKeyPressed(sf::Keyboard::Up) || sf::Keyboard::isKeyPressed(bindings.menuUp);
+    input.down = sf::Keyboard::isKeyPressed(sf::Keyboard::Down) || sf::Keyboard::isKeyPressed(bindings.menuDown);
+
+    world->applyInput(input);
+}
+
 void Game::update(float dt) {
     if (gameState == GameState::TitleScreen && titleScreen) {
         titleScreen->update(dt);
@@ -375,21 +442,7 @@ void Game::update(float dt) {
         keyBindingMenu->update(dt);
         return;
     } else if (gameState == GameState::Editor) {
-        EditorContext editorCtx{
-            window,
-            camera.get(),
-            getActivePlayer(),
-            platforms,
-            enemies,
-            interactiveObjects,
-            checkpoints,
-            currentLevel.get(),
-            currentLevelPath,
-            [this](const std::string& path) -> LevelData* {
-                loadLevel(path);
-                return currentLevel.get();
-            }
-        };
+        EditorContext editorCtx = makeEditorContext();
         editorController->update(dt, editorCtx);
         return;
     }
@@ -421,12 +474,12 @@ void Game::update(float dt) {
                 auto it = levelCheckpoints.find(currentLevelPath);
                 if (it != levelCheckpoints.end() && !it->second.empty()) {
                     activeCheckpointId = it->second;
-                    for (auto& checkpoint : checkpoints) {
+                    for (auto& checkpoint : world->getCheckpoints()) {
                         if (checkpoint->getId() == activeCheckpointId) {
                             checkpoint->activate();
                             // Update spawn point for all players
                             sf::Vector2f cpPos = checkpoint->getSpawnPosition();
-                            for (auto& p : players) {
+                            for (auto& p : world->getPlayers()) {
                                 if (p) {
                                     p->setSpawnPoint(cpPos.x, cpPos.y);
                                 }
@@ -459,574 +512,104 @@ void Game::update(float dt) {
         postTransitionHideFrames--;
     }
 
-    player->update(dt);
-
-    sf::FloatRect playerBounds = player->getBounds();
-    sf::Vector2f playerVel = player->getVelocity();
-    bool grounded = false;
-
-    for (auto& platform : platforms) {
-        sf::FloatRect platformBounds = platform->getBounds();
-        if (CollisionSystem::resolveCollision(
-            playerBounds,
-            playerVel,
-            platformBounds,
-            grounded
-        )) {
-            player->setPosition(playerBounds.left, playerBounds.top);
-            player->setVelocity(playerVel);
-            
-        }
-    }
-
-    player->setGrounded(grounded);
+    // Gameplay input is sampled once per simulation tick
+    handleInput();
 
-    if (player->hasJustJumped()) {
-        sf::Vector2f playerPos = player->getPosition();
-        particleSystem->emitJump(sf::Vector2f(playerPos.x + 20.0f, playerPos.y + 40.0f));
-        audioManager->playSound("jump", 80.0f);
-    }
-
-    if (player->hasJustLanded()) {
-        sf::Vector2f playerPos = player->getPosition();
-        particleSystem->emitLanding(sf::Vector2f(playerPos.x + 20.0f, playerPos.y + 40.0f));
-        audioManager->playSound("land", 60.0f);
-        cameraShake->shakeLight();
-    }
-
-    player->clearEventFlags();
+    WorldEvents events = world->update(dt);
 
     gameUI->setHealth(player->getHealth(), player->getMaxHealth());
 
-    if (player->isDead() && !playerWasDead) {
+    if (events.playerDied) {
         gameUI->incrementDeaths();
-        playerWasDead = true;
-
-        // Death effects
-        sf::Vector2f playerPos = player->getPosition();
-        particleSystem->emitDeath(sf::Vector2f(playerPos.x + 20.0f, playerPos.y + 20.0f));
-        audioManager->playSound("death", 100.0f);
-        cameraShake->shakeMedium();
     }
-    else if (!player->isDead() && playerWasDead) {
-        playerWasDead = false;
+    else if (events.playerRespawned) {
         if (checkpointManager && checkpointManager->handleRespawn(
                 currentLevelPath,
                 [this](const std::string& path) { loadLevel(path); },
-                players)) {
+                world->getPlayers())) {
             return;
         }
     }
 
-    // Update checkpoints
-    for (auto& checkpoint : checkpoints) {
-        checkpoint->update(dt);
-
-        // Check if player touched checkpoint
-        if (!checkpoint->isActivated() && checkpoint->isPlayerInside(player->getBounds())) {
-            if (checkpointManager && currentLevel) {
-                checkpointManager->onCheckpointActivated(
-                    currentLevelPath,
-                    currentLevel->levelId,
-                    *checkpoint,
-                    activeCheckpointId,
-                    players,
-                    *audioManager,
-                    *particleSystem);
-            }
-        }
-    }
-
-    // Update interactive objects
-    for (auto& interactive : interactiveObjects) {
-        if (interactive) {
-            interactive->update(dt);
-        }
+    // Check if player touched checkpoint
+    if (events.reachedCheckpoint && checkpointManager && world->getLevel()) {
+        checkpointManager->onCheckpointActivated(
+            currentLevelPath,
+            world->getLevel()->levelId,
+            *events.reachedCheckpoint,
+            activeCheckpointId,
+            world->getPlayers(),
+            *audioManager,
+            world->getParticleSystem());
     }
 
-    // Portal-based level transitions (check if player is in a portal zone)
-    if (!isTransitioning && currentLevel) {
-        // Reuse playerBounds from above
-        for (const auto& portal : currentLevel->portals) {
-            sf::FloatRect portalBounds(portal.x, portal.y, portal.width, portal.height);
-            
-            // Check if player is inside portal
-            if (portalBounds.intersects(playerBounds)) {
-                // Found a portal, transition to target level
-                std::string targetPath = "assets/levels/" + portal.targetLevel + ".json";
-                
-                // Store portal info for spawn positioning
-                pendingPortalSpawnDirection = portal.spawnDirection;
-                pendingPortalCustomSpawn = portal.useCustomSpawn;
-                pendingPortalCustomSpawnPos = portal.customSpawnPos;
-                
-                nextLevelPath = targetPath;
-            isTransitioning = true;
-                screenTransition->startFadeOut(0.5f);
-            return;
-            }
-        }
+    // Portal-based level transitions (player is in a portal zone)
+    if (events.enteredPortal && !isTransitioning) {
+        const Portal& portal = *events.enteredPortal;
+        // Found a portal, transition to target level
+        std::string targetPath = "assets/levels/" + portal.targetLevel + ".json";
+
+        // Store portal info for spawn positioning
+        pendingPortalSpawnDirection = portal.spawnDirection;
+        pendingPortalCustomSpawn = portal.useCustomSpawn;
+        pendingPortalCustomSpawnPos = portal.customSpawnPos;
+
+        nextLevelPath = targetPath;
+        // Only this neighbour is needed now: the others are dropped and it gets parsed during the fade
+        levelPrefetcher->want({LevelLoader::resolveLevelPath(targetPath)});
+        isTransitioning = true;
+        screenTransition->startFadeOut(0.5f);
+        return;
     }
 
     // Door backtracking: if player presses Up/W inside a Door, go back one level
-    {
-        const bool keyPressed = sf::Keyboard::isKeyPressed(sf::Keyboard::Up) ||
-                                sf::Keyboard::isKeyPressed(sf::Keyboard::W);
-        if (!doorKeyHeld && keyPressed && !isTransitioning && player && levelHistoryPos > 0) {
-            for (auto& interactive : interactiveObjects) {
-                if (!interactive) continue;
-                if (interactive->getType() != InteractiveType::Door) continue;
-                if (player->getBounds().intersects(interactive->getBounds())) {
-                    goBackOneLevel();
-                    break;
-                }
-            }
-        }
-        doorKeyHeld = keyPressed;
-    }
-
-    // Handle Noah's Hack ability (interact with terminals, doors, etc.)
-    if (player && player->isHacking() && player->getCharacterType() == CharacterType::Noah) {
-        for (auto& interactive : interactiveObjects) {
-            if (!interactive) continue;
-            
-            // Check if player is in range
-            if (interactive->isPlayerInRange(player->getBounds())) {
-                // Activate the interactive object
-                if (!interactive->isActivated()) {
-                    interactive->activate();
-                    
-                    // Visual feedback
-                    sf::Vector2f objPos = interactive->getPosition();
-                    particleSystem->emitVictory(sf::Vector2f(objPos.x + interactive->getSize().x / 2.0f, objPos.y + interactive->getSize().y / 2.0f));
-                    audioManager->playSound("checkpoint", 70.0f);
-                    cameraShake->shakeLight();
-                    
-                    // Handle different types of interactive objects
-                    if (interactive->getType() == InteractiveType::Door) {
-                        // Door: Make platform passable or remove it
-                        // For now, just mark as activated (can be used to unlock doors later)
-                        std::cout << "Door " << interactive->getId() << " hacked!\n";
-                    } else if (interactive->getType() == InteractiveType::Terminal) {
-                        // Terminal: Activate systems, unlock paths
-                        std::cout << "Terminal " << interactive->getId() << " hacked!\n";
-                    } else if (interactive->getType() == InteractiveType::Turret) {
-                        // Turret: Disable turret
-                        std::cout << "Turret " << interactive->getId() << " disabled!\n";
-                    }
-                }
-            }
-        }
-    }
-
-    // Handle Lyra's Kinetic Wave ability - create projectile during animation
-    if (player && player->getCharacterType() == CharacterType::Lyra) {
-        float abilityTimer = player->getAbilityAnimationTimer();
-        
-        // Create projectile very late in ability animation (when projectile is actually launched)
-        // Ability animation is 0.6s total, launch projectile at the very end (almost finished)
-        // Only create once when timer crosses threshold (when animation is almost done)
-        if (abilityTimer > 0.05f && abilityTimer <= 0.1f && lastAbilityTimer > 0.1f) {
-            // Timer is very low (animation almost finished), create projectile
-            sf::Vector2f playerPos = player->getPosition();
-            sf::Vector2f waveDir = player->getKineticWaveDirection();
-            float waveRange = Config::KINETIC_WAVE_RANGE;
-            
-            // Create moving projectile that travels forward
-            // Position at hands level (chest/torso area, aligned with arms)
-            // Player hitbox center is around torso, hands are at chest level (not head)
-            // Use positive Y offset to lower projectile (closer to ground, at hands level)
-            float handsOffsetX = waveDir.x * 25.0f; // Forward in direction
-            float handsOffsetY = 20.0f; // Below center (hands level, lower than before)
-            sf::Vector2f waveStartPos = playerPos + sf::Vector2f(handsOffsetX, handsOffsetY);
-            float projectileSpeed = 800.0f; // pixels per second
-            kineticWaveProjectiles.push_back(
-                std::make_unique<KineticWaveProjectile>(waveStartPos, waveDir, projectileSpeed, waveRange)
-            );
-        }
-        lastAbilityTimer = abilityTimer;
-        
-        // Reset tracking when ability ends
-        if (abilityTimer <= 0.0f) {
-            lastAbilityTimer = 0.0f;
-        }
-    }
-    
-    // Build a simple spatial grid for enemies to reduce projectile/enemy checks
-    const float cellSize = 128.0f;
-    std::unordered_map<std::int64_t, std::vector<Enemy*>> enemyGrid;
-    enemyGrid.reserve(enemies.size() * 2);
-
-    auto makeCellKey = [](int cx, int cy) -> std::int64_t {
-        return (static_cast<std::int64_t>(cx) << 32) ^
-               (static_cast<std::int64_t>(cy) & 0xffffffffLL);
-    };
-
-    for (auto& enemyPtr : enemies) {
-        if (!enemyPtr || !enemyPtr->isAlive()) {
-            continue;
-        }
-        const sf::Vector2f& enemyPos = enemyPtr->getPosition();
-        const int cx = static_cast<int>(std::floor(enemyPos.x / cellSize));
-        const int cy = static_cast<int>(std::floor(enemyPos.y / cellSize));
-        enemyGrid[makeCellKey(cx, cy)].push_back(enemyPtr.get());
+    if (events.doorUsed && !isTransitioning && levelHistoryPos > 0) {
+        goBackOneLevel();
     }
-    
-    // Update Kinetic Wave projectiles
-    for (auto& projectile : kineticWaveProjectiles) {
-        if (!projectile || !projectile->isAlive()) {
-            continue;
-        }
-
-            projectile->update(dt);
-            
-        // Broad phase: only test enemies in neighboring grid cells
-        const sf::Vector2f& projectilePos = projectile->getPosition();
-        const int pcx = static_cast<int>(std::floor(projectilePos.x / cellSize));
-        const int pcy = static_cast<int>(std::floor(projectilePos.y / cellSize));
-
-        for (int gx = pcx - 1; gx <= pcx + 1; ++gx) {
-            for (int gy = pcy - 1; gy <= pcy + 1; ++gy) {
-                auto it = enemyGrid.find(makeCellKey(gx, gy));
-                if (it == enemyGrid.end()) {
-                    continue;
-                }
-
-                for (Enemy* enemy : it->second) {
-                if (!enemy || !enemy->isAlive()) {
-                    continue;
-                }
-                
-                    const sf::Vector2f& enemyPos = enemy->getPosition();
-                sf::Vector2f toEnemy = enemyPos - projectilePos;
-                float distance = std::sqrt(toEnemy.x * toEnemy.x + toEnemy.y * toEnemy.y);
-                
-                // Check collision (projectile radius ~15px, enemy hitbox)
-                if (distance < 40.0f) { // Slightly larger collision radius
-                    // Push enemy away with force
-                        sf::Vector2f dirToEnemy = (distance > 0.0f)
-                            ? sf::Vector2f(toEnemy.x / distance, toEnemy.y / distance)
-                            : sf::Vector2f(1.0f, 0.0f);
-                    sf::Vector2f pushForce = dirToEnemy * Config::KINETIC_WAVE_FORCE;
-                    enemy->setVelocity(pushForce.x, pushForce.y);
-                    
-                    // Visual effect at enemy position (impact)
-                    particleSystem->emitJump(enemyPos);
-                    audioManager->playSound("jump", 60.0f);
-                    cameraShake->shakeLight();
-                    
-                    // Mark projectile as dead after hitting enemy
-                    // (we'll add a hit flag later if needed to continue through enemies)
-                }
-            }
-            }
-        }
-    }
-    
-    // Update enemy projectiles
-    for (auto& projectile : enemyProjectiles) {
-        if (!projectile || !projectile->isAlive()) {
-            continue;
-        }
-        projectile->update(dt);
-        
-        // Check collision with player
-        if (player && !player->isDead() && !player->isInvincible()) {
-            if (projectile->getBounds().intersects(player->getBounds())) {
-                player->takeDamage(projectile->getDamage());
-                projectile->kill();
-                
-                if (!player->isDead()) {
-                    audioManager->playSound("jump", 60.0f);
-                    cameraShake->shakeLight();
-                }
-            }
-        }
-        
-        // Check collision with platforms
-        for (const auto& platform : platforms) {
-            if (platform && projectile->getBounds().intersects(platform->getBounds())) {
-                projectile->kill();
-                break;
-            }
-        }
-    }
-    
-    // Remove dead enemy projectiles
-    enemyProjectiles.erase(
-        std::remove_if(enemyProjectiles.begin(), enemyProjectiles.end(),
-            [](const std::unique_ptr<EnemyProjectile>& proj) -> bool {
-                return !proj || !proj->isAlive();
-            }),
-        enemyProjectiles.end()
-    );
-    
-    // Remove dead projectiles (swap-and-pop to avoid extra allocations)
-    for (std::size_t i = 0; i < kineticWaveProjectiles.size(); ) {
-        if (!kineticWaveProjectiles[i] || !kineticWaveProjectiles[i]->isAlive()) {
-            kineticWaveProjectiles[i] = std::move(kineticWaveProjectiles.back());
-            kineticWaveProjectiles.pop_back();
-        } else {
-            ++i;
-        }
-    }
-
-    // Handle player attack
-    if (player && player->getAttackCooldownRemaining() > 0.0f && 
-        player->getAttackCooldownRemaining() >= Config::ATTACK_COOLDOWN - 0.1f) {
-        // Player just attacked, check for enemies in kick range (rectangle in front)
-        sf::Vector2f playerPos = player->getPosition();
-        sf::Vector2f playerSize = player->getSize();
-        sf::Vector2f playerCenter = sf::Vector2f(
-            playerPos.x + playerSize.x / 2.0f,
-            playerPos.y + playerSize.y / 2.0f
-        );
-        
-        // Determine attack hitbox position based on facing direction
-        int facingDir = player->getFacingDirection();
-        sf::FloatRect attackHitbox;
-        
-        if (facingDir == 1) { // Facing right (east)
-            attackHitbox.left = playerCenter.x + Config::ATTACK_DISTANCE - Config::ATTACK_WIDTH / 2.0f;
-            attackHitbox.top = playerCenter.y - Config::ATTACK_HEIGHT / 2.0f;
-            attackHitbox.width = Config::ATTACK_WIDTH;
-            attackHitbox.height = Config::ATTACK_HEIGHT;
-        } else if (facingDir == -1) { // Facing left (west)
-            attackHitbox.left = playerCenter.x - Config::ATTACK_DISTANCE - Config::ATTACK_WIDTH / 2.0f;
-            attackHitbox.top = playerCenter.y - Config::ATTACK_HEIGHT / 2.0f;
-            attackHitbox.width = Config::ATTACK_WIDTH;
-            attackHitbox.height = Config::ATTACK_HEIGHT;
-        } else if (facingDir == 2) { // Facing up (north)
-            attackHitbox.left = playerCenter.x - Config::ATTACK_WIDTH / 2.0f;
-            attackHitbox.top = playerCenter.y - Config::ATTACK_DISTANCE - Config::ATTACK_HEIGHT / 2.0f;
-            attackHitbox.width = Config::ATTACK_WIDTH;
-            attackHitbox.height = Config::ATTACK_HEIGHT;
-        } else { // Facing down (south) or default
-            attackHitbox.left = playerCenter.x - Config::ATTACK_WIDTH / 2.0f;
-            attackHitbox.top = playerCenter.y + Config::ATTACK_DISTANCE - Config::ATTACK_HEIGHT / 2.0f;
-            attackHitbox.width = Config::ATTACK_WIDTH;
-            attackHitbox.height = Config::ATTACK_HEIGHT;
-        }
-        
-        for (auto& enemy : enemies) {
-            if (!enemy || !enemy->isAlive()) {
-                continue;
-            }
-            
-            // Don't attack stationary enemies (spikes/traps)
-            if (enemy->getType() == EnemyType::Stationary ||
-                enemy->getType() == EnemyType::FlameTrap ||
-                enemy->getType() == EnemyType::RotatingTrap) {
-                continue;
-            }
-            
-            sf::FloatRect enemyBounds = enemy->getBounds();
-            
-            // Check if enemy hitbox intersects with attack hitbox
-            if (attackHitbox.intersects(enemyBounds)) {
-                // Enemy is in attack range, kill it
-                sf::Vector2f enemyPos = enemy->getPosition();
-                sf::Vector2f enemySize = enemy->getSize();
-                sf::Vector2f enemyCenter = sf::Vector2f(
-                    enemyPos.x + enemySize.x / 2.0f,
-                    enemyPos.y + enemySize.y / 2.0f
-                );
-                
-                // Deal damage instead of instant kill
-                bool wasAlive = enemy->isAlive();
-                enemy->takeDamage(Config::ATTACK_DAMAGE);
-                
-                // Effects only if enemy died
-                if (wasAlive && !enemy->isAlive()) {
-                    particleSystem->emitDeath(sf::Vector2f(enemyCenter.x, enemyCenter.y));
-                    audioManager->playSound("death", 60.0f);
-                    cameraShake->shakeLight();
-                } else if (enemy->isAlive()) {
-                    // Hit effect for damage
-                    particleSystem->emitJump(sf::Vector2f(enemyCenter.x, enemyCenter.y));
-                    audioManager->playSound("jump", 40.0f);
-                }
-            }
-        }
-    }
-
-    // Update enemies (skip movement in editor mode)
-    for (auto& enemy : enemies) {
-        if (!enemy) {
-            continue; // Skip null enemies
-        }
-        
-        // In editor mode, always show enemies even if dead
-        if (gameState == GameState::Editor && !enemy->isAlive()) {
-            continue; // Skip update for dead enemies in editor, but keep them in vector
-        }
-        
-        if (!enemy->isAlive()) {
-            continue; // Skip dead enemies in playing mode (will be removed later)
-        }
-
-        // Don't update enemy movement in editor mode
-        if (gameState != GameState::Editor) {
-            enemy->update(dt);
-
-            if (auto* flameTrap = dynamic_cast<FlameTrap*>(enemy.get())) {
-                flameTrap->updateFlame(dt, enemyProjectiles);
-            }
-            
-            // Handle enemy shooting
-            if (enemy->getStats().canShoot && enemy->canShoot()) {
-                // Check if player is in range
-                if (player) {
-                    sf::Vector2f enemyPos = enemy->getPosition();
-                    sf::Vector2f enemySize = enemy->getSize();
-                    sf::Vector2f enemyCenter = sf::Vector2f(
-                        enemyPos.x + enemySize.x / 2.0f,
-                        enemyPos.y + enemySize.y / 2.0f
-                    );
-                    sf::Vector2f playerPos = player->getPosition();
-                    sf::Vector2f playerSize = player->getSize();
-                    sf::Vector2f playerCenter = sf::Vector2f(
-                        playerPos.x + playerSize.x / 2.0f,
-                        playerPos.y + playerSize.y / 2.0f
-                    );
-                    
-                    sf::Vector2f toPlayer = playerCenter - enemyCenter;
-                    float distance = std::sqrt(toPlayer.x * toPlayer.x + toPlayer.y * toPlayer.y);
-                    
-                    // Check if player is in shooting range and cooldown is ready
-                    // Access shootTimer through a getter or make it accessible
-                    // For now, we'll check if canShoot() returns true
-                    if (distance <= enemy->getStats().shootRange && enemy->canShoot()) {
-                        // Normalize direction
-                        sf::Vector2f direction = (distance > 0.0f) 
-                            ? sf::Vector2f(toPlayer.x / distance, toPlayer.y / distance)
-                            : sf::Vector2f(1.0f, 0.0f);
-                        
-                        // Create projectile
-                        enemyProjectiles.push_back(std::make_unique<EnemyProjectile>(
-                            enemyCenter,
-                            direction,
-                            enemy->getStats().projectileSpeed,
-                            enemy->getStats().projectileRange,
-                            enemy->getStats().damage
-                        ));
-                        
-                        // Reset cooldown
-                        enemy->resetShootTimer();
-                    }
-                }
-            }
-        }
-
-        // Check collision with player
-        if (player && player->getBounds().intersects(enemy->getBounds())) {
-            sf::FloatRect currentPlayerBounds = player->getBounds();
-            sf::FloatRect enemyBounds = enemy->getBounds();
-
-            // Spikes (Stationary enemies) cannot be stomped - they always deal damage
-            if (enemy->getType() == EnemyType::Stationary ||
-                enemy->getType() == EnemyType::FlameTrap ||
-                enemy->getType() == EnemyType::RotatingTrap) {
-                // Always take damage from spikes (no stomping)
-                if (!player->isInvincible()) {
-                    player->takeDamage(1);
-
-                    // Play hurt sound if player is still alive
-                    if (!player->isDead()) {
-                        audioManager->playSound("jump", 60.0f); // Temporary hurt sound
-                        cameraShake->shakeLight();
-                    }
-                }
-            } else {
-                // For other enemies: Check if player is stomping on enemy (falling and hitting from above)
-                float tolerance = Config::STOMP_TOLERANCE_BASE * player->getStompDamageMultiplier();  // Noah has bigger stomp range
-                bool playerFalling = player->getVelocity().y > 0;
-                bool hitFromAbove = currentPlayerBounds.top + currentPlayerBounds.height <= enemyBounds.top + tolerance;
-
-                if (playerFalling && hitFromAbove) {
-                    // Zone 1 Level 1: Flying enemy allows bounce without killing (for secret)
-                    if (currentLevel && currentLevel->levelId == "zone1_level1" && enemy->getType() == EnemyType::Flying) {
-                        // Don't kill flying enemy, just bounce (allows multiple uses for secret)
-                        // Bounce player up higher for secret access
-                        player->setVelocity(player->getVelocity().x, Config::FLYING_ENEMY_BOUNCE_VELOCITY);
-                        
-                        // Effects
-                        sf::Vector2f enemyPos = enemy->getPosition();
-                        particleSystem->emitJump(sf::Vector2f(enemyPos.x + 15.0f, enemyPos.y + 15.0f));
-                        audioManager->playSound("jump", 80.0f);
-                        cameraShake->shakeLight();
-                    } else {
-                        // Deal damage to enemy (normal behavior)
-                        bool wasAlive = enemy->isAlive();
-                        enemy->takeDamage(1); // Stomp deals 1 damage
-
-                        // Bounce player up
-                        player->setVelocity(player->getVelocity().x, Config::ENEMY_BOUNCE_VELOCITY);
-
-                        // Effects
-                        sf::Vector2f enemyPos = enemy->getPosition();
-                        if (wasAlive && !enemy->isAlive()) {
-                            // Enemy died
-                            particleSystem->emitDeath(sf::Vector2f(enemyPos.x + 15.0f, enemyPos.y + 15.0f));
-                            audioManager->playSound("death", 80.0f);
-                        } else {
-                            // Enemy took damage but survived
-                            particleSystem->emitJump(sf::Vector2f(enemyPos.x + 15.0f, enemyPos.y + 15.0f));
-                            audioManager->playSound("jump", 60.0f);
-                        }
-                        cameraShake->shakeLight();
-                    }
-                } else {
-                    // Side or bottom collision = player takes damage
-                    // Only play effects if player is not invincible (takeDamage will handle invincibility check)
-                    if (!player->isInvincible()) {
-                        player->takeDamage(1);
-
-                        // Play hurt sound if player is still alive
-                        if (!player->isDead()) {
-                            audioManager->playSound("jump", 60.0f); // Temporary hurt sound
-                            cameraShake->shakeLight();
-                        }
-                    }
-                }
-            }
-        }
-    }
-
-    // Keep dead enemies in vector so they remain available for the editor.
-    // (They are skipped for gameplay interactions elsewhere.)
-    enemies.erase(
-        std::remove_if(enemies.begin(), enemies.end(),
-            [](const std::unique_ptr<Enemy>& enemy) -> bool {
-                return !enemy; // remove null pointers only
-            }),
-        enemies.end()
-    );
-
 
     // Victory effects (only trigger once)
     if (levelCompleted && !victoryEffectsTriggered) {
         sf::Vector2f playerPos = player->getPosition();
-        particleSystem->emitVictory(sf::Vector2f(playerPos.x + 20.0f, playerPos.y + 20.0f));
+        world->getParticleSystem().emitVictory(sf::Vector2f(playerPos.x + 20.0f, playerPos.y + 20.0f));
         audioManager->playSound("victory", 100.0f);
         victoryEffectsTriggered = true;
     }
 
     // Update polish systems
-    particleSystem->update(dt);
     cameraShake->update(dt);
 
     // Update camera to follow player
-    camera->update(player->getPosition(), dt);
-    camera->setShakeOffset(cameraShake->getOffset());
+    {
+        PROFILE_ZONE(CameraUpdate);
+        camera->update(player->getPosition(), dt);
+        camera->setShakeOffset(cameraShake->getOffset());
+    }
 
     // Update UI
     gameUI->update(dt);
 }
 
-void Game::render() {
+void Game::render(float alpha) {
+    // Plain gameplay frames go to the render thread; menus, editor, transitions and debug
+    // overlays are drawn here, after taking the window back
+    if (Config::USE_RENDER_THREAD) {
+        if (canRenderThreaded()) {
+            if (!renderThread->isRunning()) {
+                renderThread->start(window, [this](FrameSnapshot& snapshot) { drawFrame(snapshot); });
+            }
+            publishFrame(alpha);
+            return;
+        }
+        renderThread->stop();
+    }
+
     window.clear(sf::Color(13, 27, 42));
 
+    // The world only advances while playing: anything else draws the last tick as-is
+    if (gameState != GameState::Playing || isTransitioning) {
+        alpha = 1.0f;
+    }
+
     if (gameState == GameState::TitleScreen && titleScreen) {
         titleScreen->draw(window);
         window.display();
@@ -1035,18 +618,14 @@ void Game::render() {
         Player* player = getActivePlayer();
         if (camera && player) {
             camera->apply(window);
-            for (auto& platform : platforms) platform->draw(window);
-            for (auto& checkpoint : checkpoints) checkpoint->draw(window);
-            for (auto& interactive : interactiveObjects) {
-                if (interactive) interactive->draw(window);
-            }
-            for (auto& enemy : enemies) {
-                if (enemy && enemy->isAlive()) {
-                    enemy->draw(window);
-                }
-            }
-            particleSystem->draw(window);
-            player->draw(window);
+            collectVisible();
+            drawPlatforms(window);
+            for (Checkpoint* checkpoint : visibleSet->checkpoints) checkpoint->submit(*renderQueue);
+            for (InteractiveObject* interactive : visibleSet->interactiveObjects) interactive->submit(*renderQueue);
+            for (Enemy* enemy : visibleSet->enemies) enemy->submit(*renderQueue, sf::Vector2f());
+            world->getParticleSystem().submit(*renderQueue);
+            player->submit(*renderQueue, sf::Vector2f());
+            renderQueue->flush(window);
             window.setView(window.getDefaultView());
             if (gameUI) gameUI->draw(window);
         }
@@ -1066,21 +645,7 @@ void Game::render() {
             camera->apply(window);
         }
         drawParallaxBackground(window);
-        EditorContext editorCtx{
-            window,
-            camera.get(),
-            getActivePlayer(),
-            platforms,
-            enemies,
-            interactiveObjects,
-            checkpoints,
-            currentLevel.get(),
-            currentLevelPath,
-            [this](const std::string& path) -> LevelData* {
-                loadLevel(path);
-                return currentLevel.get();
-            }
-        };
+        EditorContext editorCtx = makeEditorContext();
         editorController->render(editorCtx);
         window.display();
         return;
@@ -1091,139 +656,244 @@ void Game::render() {
                                 (isTransitioning && camera && player);
     
     if (shouldRenderGameplay) {
-        camera->apply(window);
+        camera->apply(window, alpha);
+        collectVisible();
 
-        drawParallaxBackground(window);
-
-        for (auto& platform : platforms) {
-            platform->draw(window);
+        {
+            PROFILE_ZONE(RenderBackground);
+            drawParallaxBackground(window);
         }
 
-        for (auto& checkpoint : checkpoints) {
-            checkpoint->draw(window);
+        {
+            PROFILE_ZONE(RenderPlatforms);
+            drawPlatforms(window);
         }
 
-        for (auto& interactive : interactiveObjects) {
-            if (interactive) {
-                interactive->draw(window);
-            }
-        }
+        submitWorld(*renderQueue, alpha);
 
-        for (auto& enemy : enemies) {
-            if (enemy && enemy->isAlive()) {
-                enemy->draw(window);
-            }
+        {
+            PROFILE_ZONE(RenderEntities);
+            renderQueue->flush(window);
+            const RenderQueue::Stats& stats = renderQueue->getLastStats();
+            Profiler::getInstance().setRenderCounters(stats.commands, stats.batches, stats.textureSwitches);
         }
+        
+        // Draw hitboxes if enabled
+        if (showHitboxes) {
+            LevelData* level = world->getLevel();
+            HitboxDebug::drawHitboxes(window, player, world->getEnemies(), world->getPlatforms(),
+                                      world->getCheckpoints(), world->getInteractiveObjects(),
+                                      level ? level->portals : std::vector<Portal>());
+        }
+
+        window.setView(window.getDefaultView());
 
-        for (const auto& projectile : kineticWaveProjectiles) {
-            if (projectile && projectile->isAlive()) {
-                projectile->draw(window);
+        {
+            PROFILE_ZONE(RenderUI);
+            if (gameUI) {
+                gameUI->draw(window);
             }
+
+            drawFps(window, fpsValue);
+
+            screenTransition->draw(window);
         }
-        
-        for (const auto& projectile : enemyProjectiles) {
-            if (projectile && projectile->isAlive()) {
-                projectile->draw(window);
-            }
+
+        if (showProfiler && debugFont.getInfo().family != "") {
+            ProfilerOverlay::draw(window, debugFont);
         }
+    }
+
+    window.display();
+}
 
-        particleSystem->draw(window);
 
-        if (player && !isTransitioning && postTransitionHideFrames == 0) {
-            player->draw(window);
+void Game::submitWorld(RenderQueue& queue, float alpha) {
+    Player* player = getActivePlayer();
+
+    {
+        PROFILE_ZONE(RenderEntities);
+        // Only what the view (plus margin) shows: cost follows the screen, not the level
+        // Queued, not drawn: the layers decide the order, flush() batches by texture
+        for (Checkpoint* checkpoint : visibleSet->checkpoints) {
+            checkpoint->submit(queue);
         }
-        
-        // Draw hitboxes if enabled
-        if (showHitboxes) {
-            HitboxDebug::drawHitboxes(window, player, enemies, platforms, checkpoints, interactiveObjects, 
-                                      currentLevel ? currentLevel->portals : std::vector<Portal>());
+
+        for (InteractiveObject* interactive : visibleSet->interactiveObjects) {
+            interactive->submit(queue);
         }
 
-        window.setView(window.getDefaultView());
+        for (Enemy* enemy : visibleSet->enemies) {
+            submitInterpolated(queue, *enemy, alpha);
+        }
 
-        if (gameUI) {
-            gameUI->draw(window);
+        for (KineticWaveProjectile* projectile : visibleSet->kineticWaveProjectiles) {
+            projectile->submit(queue);
         }
 
-        if (Config::SHOW_FPS && debugFont.getInfo().family != "") {
-            window.draw(fpsText);
+        for (EnemyProjectile* projectile : visibleSet->enemyProjectiles) {
+            projectile->submit(queue);
         }
 
-        screenTransition->draw(window);
+        if (player && !isTransitioning && postTransitionHideFrames == 0) {
+            submitInterpolated(queue, *player, alpha);
+        }
+    }
+
+    {
+        PROFILE_ZONE(RenderParticles);
+        world->getParticleSystem().submit(queue);
+    }
+}
+
+void Game::submitInterpolated(RenderQueue& queue, Entity& entity, float alpha) {
+    // The offset only moves the queued vertices: the simulation state stays untouched
+    entity.submit(queue, entity.getInterpolatedPosition(alpha) - entity.getPosition());
+}
+
+bool Game::canRenderThreaded() const {
+    // Debug overlays read live simulation state and the profiler, so they stay on this thread
+    return gameState == GameState::Playing && !isTransitioning && camera && getActivePlayer() &&
+           !showHitboxes && !showProfiler;
+}
+
+void Game::publishFrame(float alpha) {
+    FrameSnapshot& snapshot = renderThread->acquire();
+
+    // Draw timings of the frame last drawn from this slot, so threaded frames fill the same
+    // phases and RenderQueue counters as the direct path (two frames late)
+    const FrameSnapshot::DrawStats& drawn = snapshot.drawStats;
+    if (drawn.drawn) {
+        Profiler& profiler = Profiler::getInstance();
+        profiler.addSample(Profiler::RenderBackground, drawn.backgroundMs);
+        profiler.addSample(Profiler::RenderPlatforms, drawn.platformsMs);
+        profiler.addSample(Profiler::RenderEntities, drawn.entitiesMs);
+        profiler.addSample(Profiler::RenderUI, drawn.uiMs);
+        profiler.setRenderCounters(drawn.queue.commands, drawn.queue.batches, drawn.queue.textureSwitches);
     }
+    snapshot.drawStats = FrameSnapshot::DrawStats();
+
+    snapshot.clearColor = sf::Color(13, 27, 42);
+    snapshot.worldView = camera->getRenderView(alpha);
+
+    // Culled against the view the render thread will draw with
+    world->collectVisible(Camera::visibleArea(snapshot.worldView, Config::RENDER_CULL_MARGIN), *visibleSet);
+
+    // Chunks are (re)built here: the render thread only draws them
+    if (platformRenderer && !platformRenderer->isBuiltFor(world->getPlatforms())) {
+        PROFILE_ZONE(RenderPlatforms);
+        platformRenderer->build(world->getPlatforms());
+    }
+
+    snapshot.entities.clear();
+    submitWorld(snapshot.entities, alpha);
+    snapshot.hud = gameUI->getValues();
+    snapshot.fps = fpsValue;
+
+    // Kept apart from the draw phases: this is the render thread (and display()) pacing the loop
+    PROFILE_ZONE(RenderWait);
+    renderThread->publish();
+}
+
+void Game::drawFrame(FrameSnapshot& snapshot) {
+    // Render thread: only the snapshot and what stays fixed until the thread is stopped
+    // (level art, fonts, textures) are read here
+    using Clock = std::chrono::steady_clock;
+    FrameSnapshot::DrawStats& stats = snapshot.drawStats;
+    Clock::time_point mark = Clock::now();
+    auto lap = [&mark]() {
+        const Clock::time_point now = Clock::now();
+        const std::chrono::duration<float, std::milli> elapsed = now - mark;
+        mark = now;
+        return elapsed.count();
+    };
+
+    window.clear(snapshot.clearColor);
+    window.setView(snapshot.worldView);
+
+    if (backgroundLayer) backgroundLayer->draw(window);
+    stats.backgroundMs = lap();
+    if (platformRenderer) platformRenderer->draw(window);
+    stats.platformsMs = lap();
+    snapshot.entities.flush(window);
+    stats.queue = snapshot.entities.getLastStats();
+    stats.entitiesMs = lap();
+
+    window.setView(window.getDefaultView());
+    if (gameUI) gameUI->draw(window, snapshot.hud);
+    drawFps(window, snapshot.fps);
+    stats.uiMs = lap();
+    stats.drawn = true;
 
     window.display();
 }
 
+void Game::drawFps(sf::RenderTarget& target, int fps) {
+    if (!Config::SHOW_FPS || debugFont.getInfo().family == "") return;
+
+    if (fps != fpsShown) {
+        fpsText.setString("FPS: " + std::to_string(fps));
+        fpsShown = fps;
+    }
+    target.draw(fpsText);
+}
 
 void Game::drawParallaxBackground(sf::RenderWindow& renderWindow) {
-    if (!currentLevel || !camera) return;
-
-    if (currentLevel->zoneNumber == 1 && bgWallPlain32) {
-        sf::View view = renderWindow.getView();
-        sf::Vector2f center = view.getCenter();
-        sf::Vector2f size = view.getSize();
-
-        float left = center.x - size.x / 2.0f;
-        float right = center.x + size.x / 2.0f;
-        float top = center.y - size.y / 2.0f;
-        float bottom = center.y + size.y / 2.0f;
-
-        const float tileSize = 32.0f;
-        float startY = std::floor(top / tileSize) * tileSize;
-        float endY = std::ceil(bottom / tileSize) * tileSize;
-        float startX = std::floor(left / tileSize) * tileSize;
-        float endX = std::ceil(right / tileSize) * tileSize;
-
-        // Tuilage sans espace: on rogne automatiquement la texture pour enlever le padding transparent
-        static bool trimComputed = false;
-        static sf::IntRect trimRect(0,0,0,0);
-        if (!trimComputed) {
-            if (bgWallPlain32) {
-                sf::Image img = bgWallPlain32->copyToImage();
-                sf::Vector2u sz = img.getSize();
-                unsigned int minX = sz.x, minY = sz.y, maxX = 0, maxY = 0;
-                bool any = false;
-                for (unsigned int y = 0; y < sz.y; ++y) {
-                    for (unsigned int x = 0; x < sz.x; ++x) {
-                        if (img.getPixel(x, y).a > 0) {
-                            any = true;
-                            if (x < minX) minX = x;
-                            if (y < minY) minY = y;
-                            if (x > maxX) maxX = x;
-                            if (y > maxY) maxY = y;
-                        }
-                    }
-                }
-                if (any) {
-                    trimRect = sf::IntRect(static_cast<int>(minX), static_cast<int>(minY),
-                                           static_cast<int>(maxX - minX + 1), static_cast<int>(maxY - minY + 1));
-                } else {
-                    trimRect = sf::IntRect(0,0,static_cast<int>(tileSize), static_cast<int>(tileSize));
-                }
-            }
-            trimComputed = true;
-        }
+    if (!world->getLevel() || !camera || !backgroundLayer) return;
 
-        sf::Sprite sprite;
-        sprite.setTexture(*bgWallPlain32);
-        if (trimRect.width > 0 && trimRect.height > 0) {
-            sprite.setTextureRect(trimRect);
-            float scaleX = tileSize / static_cast<float>(trimRect.width);
-            float scaleY = tileSize / static_cast<float>(trimRect.height);
-            sprite.setScale(scaleX, scaleY);
-        } else {
-            sprite.setScale(1.0f, 1.0f);
-            sprite.setTextureRect(sf::IntRect(0, 0, static_cast<int>(tileSize), static_cast<int>(tileSize)));
-        }
+    // Baked at level load: only the chunks under the view are submitted
+    backgroundLayer->draw(renderWindow);
+}
 
-        for (float x = startX; x < endX; x += tileSize) {
-            for (float y = startY; y < endY; y += tileSize) {
-                sprite.setPosition(std::floor(x), std::floor(y));
-                renderWindow.draw(sprite);
-            }
-        }
+void Game::collectVisible() {
+    const sf::FloatRect area = Camera::visibleArea(window.getView(), Config::RENDER_CULL_MARGIN);
+    world->collectVisible(area, *visibleSet);
+}
+
+void Game::drawPlatforms(sf::RenderWindow& renderWindow) {
+    if (!platformRenderer) return;
+
+    // Baked per chunk at level load, re-baked only where the editor changed something
+    if (!platformRenderer->isBuiltFor(world->getPlatforms())) {
+        platformRenderer->build(world->getPlatforms());
     }
+    platformRenderer->draw(renderWindow);
+}
+
+void Game::rebuildBackground() {
+    LevelData* currentLevel = world->getLevel();
+    if (!backgroundLayer) return;
+    if (!currentLevel || currentLevel->zoneNumber != 1 || !bgWallPlain32.texture) {
+        backgroundLayer->clear();
+        return;
+    }
+
+    backgroundLayer->clearTextures();
+    backgroundLayer->setBaseTile(bgWallPlain32);
+    backgroundLayer->setVariant("bgWallPlain32", bgWallPlain32);
+    backgroundLayer->setVariant("bgWallPlainVarA32", bgWallPlainVarA32);
+    backgroundLayer->setVariant("bgWallPlainVarB32", bgWallPlainVarB32);
+    backgroundLayer->setVariant("bgWallCables32", bgWallCables32);
+    backgroundLayer->setVariant("bgWallCablesAlt32", bgWallCablesAlt32);
+
+    // Everything the camera can show: platforms and camera zones, plus one screen around them
+    sf::FloatRect area = world->getPlatformIndex().getBounds();
+    float left = area.left;
+    float top = area.top;
+    float right = area.left + area.width;
+    float bottom = area.top + area.height;
+    for (const auto& zone : currentLevel->cameraZones) {
+        left = std::min(left, zone.minX);
+        top = std::min(top, zone.minY);
+        right = std::max(right, zone.maxX);
+        bottom = std::max(bottom, zone.maxY);
+    }
+    const float marginX = static_cast<float>(Config::WINDOW_WIDTH);
+    const float marginY = static_cast<float>(Config::WINDOW_HEIGHT);
+    area = sf::FloatRect(left - marginX, top - marginY,
+                         right - left + marginX * 2.0f, bottom - top + marginY * 2.0f);
+
+    backgroundLayer->build(*currentLevel, area);
 }
 
 void Game::loadLevel() {
@@ -1232,34 +902,29 @@ void Game::loadLevel() {
 }
 
 void Game::loadLevel(const std::string& levelPath) {
+    // The level art and entities the render thread draws from are about to be replaced
+    renderThread->stop();
+
     std::string resolvedPath = LevelLoader::resolveLevelPath(levelPath);
 
-    // Load level from specified path
-    currentLevel = LevelLoader::loadFromFile(resolvedPath);
+    // Load level from specified path (records already parsed by the prefetcher when possible)
+    std::unique_ptr<LevelData> loadedLevel;
+    std::shared_ptr<const LevelBinary::LevelRecords> records;
+    const char* label = nullptr;
+    if (levelPrefetcher->take(resolvedPath, records, label)) {
+        loadedLevel = LevelLoader::instantiate(*records, label);
+    } else {
+        loadedLevel = LevelLoader::loadFromFile(resolvedPath);
+    }
     currentLevelPath = resolvedPath;
 
-        if (currentLevel) {
-            // Move data from LevelData to Game
-            platforms = std::move(currentLevel->platforms);
-            checkpoints = std::move(currentLevel->checkpoints);
-            interactiveObjects = std::move(currentLevel->interactiveObjects);
-
-        // Load enemies from JSON
-        enemies = std::move(currentLevel->enemies);
-        
-        kineticWaveProjectiles.clear();
+    if (loadedLevel) {
+        // Move entities from LevelData into the simulation world
+        world->setLevel(std::move(loadedLevel));
+        LevelData* currentLevel = world->getLevel();
         
         // Determine spawn position: portal spawn takes priority, then checkpoint, then first checkpoint or calculated position
-        sf::Vector2f spawnPos;
-        // Default: use first checkpoint if available, otherwise calculate from camera zone
-        if (!checkpoints.empty() && checkpoints[0]) {
-            spawnPos = checkpoints[0]->getSpawnPosition();
-        } else if (!currentLevel->cameraZones.empty()) {
-            const auto& zone = currentLevel->cameraZones[0];
-            spawnPos = sf::Vector2f(zone.minX + 100.0f, zone.minY + 400.0f);
-        } else {
-            spawnPos = sf::Vector2f(100.0f, 400.0f); // Ultimate fallback
-        }
+        sf::Vector2f spawnPos = world->getDefaultSpawnPosition();
         bool useCheckpointSpawn = false;
         
         bool portalSpawnUsed = false;
@@ -1269,8 +934,8 @@ void Game::loadLevel(const std::string& levelPath) {
                 pendingPortalSpawnDirection,
                 pendingPortalCustomSpawn,
                 pendingPortalCustomSpawnPos,
-                currentLevel.get(),
-                platforms);
+                currentLevel,
+                world->getPlatformIndex());
             if (portalResult.usedPortal) {
                 spawnPos = portalResult.position;
                 portalSpawnUsed = true;
@@ -1281,8 +946,8 @@ void Game::loadLevel(const std::string& levelPath) {
             if (checkpointManager) {
                 spawnPos = checkpointManager->resolveSpawnPosition(
                     currentLevelPath,
-                    currentLevel.get(),
-                    checkpoints,
+                    currentLevel,
+                    world->getCheckpoints(),
                     activeCheckpointId,
                     useCheckpointSpawn);
             } else {
@@ -1291,6 +956,7 @@ void Game::loadLevel(const std::string& levelPath) {
         }
         
         // Reset all players to spawn position
+        auto& players = world->getPlayers();
         if (!players.empty()) {
             for (auto& p : players) {
                 if (p) {
@@ -1302,7 +968,7 @@ void Game::loadLevel(const std::string& levelPath) {
                         p->setSpawnPoint(lastGlobalCheckpointPos.x, lastGlobalCheckpointPos.y);
                     } else {
                         // Fallback to current spawn position
-                    p->setSpawnPoint(spawnPos.x, spawnPos.y);
+                        p->setSpawnPoint(spawnPos.x, spawnPos.y);
                     }
                     p->setVelocity(sf::Vector2f(0.0f, 0.0f));
                 }
@@ -1315,16 +981,6 @@ void Game::loadLevel(const std::string& levelPath) {
         if (editorController) {
             editorController->resetState();
         }
-        
-        // Reset all enemies to alive state when loading level (for editor visibility)
-        for (auto& enemy : enemies) {
-            if (enemy) {
-                enemy->revive();
-                if (auto* flame = dynamic_cast<FlameTrap*>(enemy.get())) {
-                    flame->resetCycle();
-                }
-            }
-        }
 
         // Reset level state
         levelCompleted = false;
@@ -1359,27 +1015,56 @@ void Game::loadLevel(const std::string& levelPath) {
             } else {
                 bgFarTexture = nullptr;
             }
-            if (sm.loadTexture("zone1_bg_wall_plain_32", "assets/backgrounds/zone1/zone1_bg_wall_plain_32.png")) {
-                bgWallPlain32 = sm.getTexture("zone1_bg_wall_plain_32");
+            if (sm.loadFrame("zone1_bg_wall_plain_32", "assets/backgrounds/zone1/zone1_bg_wall_plain_32.png", true)) {
+                bgWallPlain32 = sm.getFrame("zone1_bg_wall_plain_32");
             }
-            if (sm.loadTexture("zone1_bg_wall_plain_varA_32", "assets/backgrounds/zone1/zone1_bg_wall_plain_varA_32.png")) {
-                bgWallPlainVarA32 = sm.getTexture("zone1_bg_wall_plain_varA_32");
+            if (sm.loadFrame("zone1_bg_wall_plain_varA_32", "assets/backgrounds/zone1/zone1_bg_wall_plain_varA_32.png", true)) {
+                bgWallPlainVarA32 = sm.getFrame("zone1_bg_wall_plain_varA_32");
             }
-            if (sm.loadTexture("zone1_bg_wall_plain_varB_32", "assets/backgrounds/zone1/zone1_bg_wall_plain_varB_32.png")) {
-                bgWallPlainVarB32 = sm.getTexture("zone1_bg_wall_plain_varB_32");
+            if (sm.loadFrame("zone1_bg_wall_plain_varB_32", "assets/backgrounds/zone1/zone1_bg_wall_plain_varB_32.png", true)) {
+                bgWallPlainVarB32 = sm.getFrame("zone1_bg_wall_plain_varB_32");
             }
-            if (sm.loadTexture("zone1_bg_wall_cables_32", "assets/backgrounds/zone1/zone1_bg_wall_cables_32.png")) {
-                bgWallCables32 = sm.getTexture("zone1_bg_wall_cables_32");
+            if (sm.loadFrame("zone1_bg_wall_cables_32", "assets/backgrounds/zone1/zone1_bg_wall_cables_32.png", true)) {
+                bgWallCables32 = sm.getFrame("zone1_bg_wall_cables_32");
             }
-            if (sm.loadTexture("zone1_bg_wall_cables_alt_32", "assets/backgrounds/zone1/zone1_bg_wall_cables_alt_32.png")) {
-                bgWallCablesAlt32 = sm.getTexture("zone1_bg_wall_cables_alt_32");
+            if (sm.loadFrame("zone1_bg_wall_cables_alt_32", "assets/backgrounds/zone1/zone1_bg_wall_cables_alt_32.png", true)) {
+                bgWallCablesAlt32 = sm.getFrame("zone1_bg_wall_cables_alt_32");
             }
         }
+        rebuildBackground();
+        platformRenderer->build(world->getPlatforms());
+        prefetchNeighbours();
 
         std::cout << "Level loaded: " << currentLevel->name << "\n";
     }
 }
 
+void Game::prefetchNeighbours() {
+    const LevelData* currentLevel = world->getLevel();
+    if (!currentLevel) {
+        levelPrefetcher->clear();
+        return;
+    }
+
+    // Portal targets first (the player can walk into them), then the declared progression
+    std::vector<std::string> neighbours;
+    auto addNeighbour = [&](const std::string& levelId) {
+        if (levelId.empty()) return;
+        std::string path = LevelLoader::resolveLevelPath("assets/levels/" + levelId + ".json");
+        if (path == currentLevelPath) return;
+        if (std::find(neighbours.begin(), neighbours.end(), path) == neighbours.end()) {
+            neighbours.push_back(path);
+        }
+    };
+    for (const Portal& portal : currentLevel->portals) {
+        addNeighbour(portal.targetLevel);
+    }
+    for (const std::string& levelId : currentLevel->nextLevels) {
+        addNeighbour(levelId);
+    }
+    levelPrefetcher->want(neighbours);
+}
+
 void Game::goBackOneLevel() {
     // Deprecated: Use portals instead for level navigation
     // This function is kept for backward compatibility but does nothing
@@ -1403,33 +1088,25 @@ void Game::startNewGame() {
     loadLevel();
 
     // Create all 3 characters at spawn position (first checkpoint or calculated)
-    sf::Vector2f startPos = sf::Vector2f(100.0f, 400.0f);
-    if (currentLevel) {
-        if (!checkpoints.empty() && checkpoints[0]) {
-            startPos = checkpoints[0]->getSpawnPosition();
-        } else if (!currentLevel->cameraZones.empty()) {
-            const auto& zone = currentLevel->cameraZones[0];
-            startPos = sf::Vector2f(zone.minX + 100.0f, zone.minY + 400.0f);
-        }
-    }
+    sf::Vector2f startPos = world->getDefaultSpawnPosition();
 
     // Create Lyra (Green) - Starting character
     auto lyra = std::make_unique<Player>(startPos.x, startPos.y, CharacterType::Lyra);
     lyra->setSpawnPoint(startPos.x, startPos.y);
-    players.push_back(std::move(lyra));
+    world->addPlayer(std::move(lyra));
 
     // Create Noah (Blue) - Second character at same position
     auto noah = std::make_unique<Player>(startPos.x, startPos.y, CharacterType::Noah);
     noah->setSpawnPoint(startPos.x, startPos.y);
-    players.push_back(std::move(noah));
+    world->addPlayer(std::move(noah));
 
     // Create Sera (Magenta) - Third character at same position
     auto sera = std::make_unique<Player>(startPos.x, startPos.y, CharacterType::Sera);
     sera->setSpawnPoint(startPos.x, startPos.y);
-    players.push_back(std::move(sera));
+    world->addPlayer(std::move(sera));
 
     // Start with Lyra (index 0)
-    activePlayerIndex = 0;
+    world->setActivePlayerIndex(0);
 
     // Create camera
     camera = std::make_unique<Camera>(
@@ -1438,6 +1115,7 @@ void Game::startNewGame() {
     );
 
     // Set camera limits if level has zones
+    LevelData* currentLevel = world->getLevel();
     if (currentLevel && !currentLevel->cameraZones.empty()) {
         const auto& zone = currentLevel->cameraZones[0];
         camera->setLimits(zone.minX, zone.maxX, zone.minY, zone.maxY);
@@ -1486,11 +1164,9 @@ void Game::continueGame() {
         }
     }
 
-    currentLevel = std::move(resumeInfo.levelData);
-    platforms = std::move(currentLevel->platforms);
-    checkpoints = std::move(currentLevel->checkpoints);
-    interactiveObjects = std::move(currentLevel->interactiveObjects);
-    enemies = std::move(currentLevel->enemies);
+    world->clear();
+    world->setLevel(std::move(resumeInfo.levelData));
+    LevelData* currentLevel = world->getLevel();
     currentLevelPath = resolvedResumePath;
 
     sf::Vector2f spawnPos;
@@ -1502,26 +1178,17 @@ void Game::continueGame() {
         lastGlobalCheckpointPos = resumeInfo.checkpointPos;
         levelCheckpoints[resolvedResumePath] = resumeInfo.checkpointId;
 
-        for (auto& checkpoint : checkpoints) {
+        for (auto& checkpoint : world->getCheckpoints()) {
             if (checkpoint && checkpoint->getId() == activeCheckpointId) {
                 checkpoint->activate();
                 break;
             }
         }
-    } else if (!checkpoints.empty() && checkpoints[0]) {
-        spawnPos = checkpoints[0]->getSpawnPosition();
-        activeCheckpointId.clear();
-    } else if (!currentLevel->cameraZones.empty()) {
-        const auto& zone = currentLevel->cameraZones[0];
-        spawnPos = sf::Vector2f(zone.minX + 100.0f, zone.minY + 400.0f);
-        activeCheckpointId.clear();
     } else {
-        spawnPos = sf::Vector2f(100.0f, 400.0f);
+        spawnPos = world->getDefaultSpawnPosition();
         activeCheckpointId.clear();
     }
 
-    players.clear();
-
     auto createPlayer = [&](CharacterType type) {
         auto player = std::make_unique<Player>(spawnPos.x, spawnPos.y, type);
         if (!lastGlobalCheckpointLevel.empty() && !lastGlobalCheckpointId.empty()) {
@@ -1530,13 +1197,13 @@ void Game::continueGame() {
             player->setSpawnPoint(spawnPos.x, spawnPos.y);
         }
         player->setVelocity(sf::Vector2f(0.0f, 0.0f));
-        players.push_back(std::move(player));
+        world->addPlayer(std::move(player));
     };
 
     createPlayer(CharacterType::Lyra);
     createPlayer(CharacterType::Noah);
     createPlayer(CharacterType::Sera);
-    activePlayerIndex = 0;
+    world->setActivePlayerIndex(0);
 
     camera = std::make_unique<Camera>(
         static_cast<float>(Config::WINDOW_WIDTH),
@@ -1559,28 +1226,33 @@ void Game::continueGame() {
 }
 
 void Game::switchCharacter() {
-    if (players.size() < 2) return; // Need at least 2 characters to switch
-
-    Player* currentPlayer = getActivePlayer();
-    if (!currentPlayer) return;
-
-    // Store current player position
-    sf::Vector2f currentPos = currentPlayer->getPosition();
-    sf::Vector2f currentVel = currentPlayer->getVelocity();
-    bool wasGrounded = currentPlayer->getIsGrounded();
-
-    // Switch to next character (cycle through)
-    activePlayerIndex = (activePlayerIndex + 1) % players.size();
+    world->switchCharacter();
+}
 
-    // Transfer position and velocity to new character
-    Player* newPlayer = getActivePlayer();
-    if (newPlayer) {
-        newPlayer->setPosition(currentPos.x, currentPos.y);
-        newPlayer->setVelocity(currentVel.x, currentVel.y);
-        newPlayer->setGrounded(wasGrounded);
+Player* Game::getActivePlayer() const {
+    return world->getActivePlayer();
+}
 
-        std::cout << "Switched to character: " << static_cast<int>(newPlayer->getCharacterType()) << "\n";
-    }
+EditorContext Game::makeEditorContext() {
+    return EditorContext{
+        window,
+        camera.get(),
+        getActivePlayer(),
+        world->getPlatforms(),
+        world->getPlatformIndex(),
+        *platformRenderer,
+        *renderQueue,
+        world->getEnemies(),
+        world->getInteractiveObjects(),
+        world->getCheckpoints(),
+        world->getLevel(),
+        currentLevelPath,
+        [this](const std::string& path) -> LevelData* {
+            loadLevel(path);
+            return world->getLevel();
+        },
+        [this]() { world->markEnemiesChanged(); }
+    };
 }
 
 void Game::returnToTitleScreen() {
@@ -1605,10 +1277,7 @@ void Game::returnToTitleScreen() {
     SaveSystem::save(saveData);
 
     // Clean up game objects
-    players.clear();
-    platforms.clear();
-    checkpoints.clear();
-    interactiveObjects.clear();
+    world->clear();
     camera.reset();
     gameUI.reset();
 
@@ -1623,6 +1292,8 @@ void Game::returnToTitleScreen() {
 
 void Game::setState(GameState newState) {
     if (newState != gameState) {
+        // Menus and the editor draw on this thread
+        renderThread->stop();
         previousState = gameState;
         gameState = newState;
 
@@ -1633,7 +1304,7 @@ void Game::setState(GameState newState) {
 
         // When entering editor mode, reset all enemies to alive state and restore positions
         if (newState == GameState::Editor) {
-            for (auto& enemy : enemies) {
+            for (auto& enemy : world->getEnemies()) {
                 if (enemy) {
                     enemy->revive();
                     if (auto* flame = dynamic_cast<FlameTrap*>(enemy.get())) {
@@ -1643,6 +1314,11 @@ void Game::setState(GameState newState) {
             }
         }
 
+        // Enemies placed or moved in the editor belong to the sector they now stand in
+        if (previousState == GameState::Editor) {
+            world->markEnemiesChanged();
+        }
+
         std::cout << "Game state changed to: " << static_cast<int>(gameState) << "\n";
     }
 }
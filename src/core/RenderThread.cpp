@@ -0,0 +1,79 @@
+#include "core/RenderThread.h"
+
+RenderThread::~RenderThread() {
+    stop();
+}
+
+void RenderThread::start(sf::RenderWindow& targetWindow, DrawFunction draw) {
+    if (running) return;
+
+    window = &targetWindow;
+    drawFunction = std::move(draw);
+    readyIndex = -1;
+    drawingIndex = -1;
+    stopRequested = false;
+
+    // A GL context can only be active on one thread at a time
+    window->setActive(false);
+    running = true;
+    thread = std::thread(&RenderThread::threadMain, this);
+}
+
+void RenderThread::stop() {
+    if (!running) return;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopRequested = true;
+    }
+    changed.notify_all();
+    thread.join();
+    running = false;
+
+    // Snapshots never drawn are dropped: the caller draws the next frame itself
+    for (FrameSnapshot& slot : slots) {
+        slot.entities.clear();
+        slot.drawStats = FrameSnapshot::DrawStats();
+    }
+    window->setActive(true);
+}
+
+void RenderThread::publish() {
+    std::unique_lock<std::mutex> lock(mutex);
+    changed.wait(lock, [this] { return readyIndex < 0 || stopRequested; });
+    readyIndex = writeIndex;
+    writeIndex = 1 - writeIndex;
+    lock.unlock();
+    changed.notify_all();
+
+    // The other slot may still be on screen: wait until the render thread is done with it
+    lock.lock();
+    changed.wait(lock, [this] { return drawingIndex != writeIndex || stopRequested; });
+}
+
+void RenderThread::threadMain() {
+    window->setActive(true);
+
+    while (true) {
+        int index;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            changed.wait(lock, [this] { return readyIndex >= 0 || stopRequested; });
+            if (stopRequested) break;
+            index = readyIndex;
+            readyIndex = -1;
+            drawingIndex = index;
+        }
+        changed.notify_all();
+
+        drawFunction(slots[index]);
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            drawingIndex = -1;
+        }
+        changed.notify_all();
+    }
+
+    window->setActive(false);
+}
@@ -0,0 +1,109 @@
+#include "debug/Profiler.h"
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+
+Profiler& Profiler::getInstance() {
+    static Profiler instance;
+    return instance;
+}
+
+void Profiler::beginFrame() {
+    if (!enabled) return;
+
+    current = FrameSample();
+    frameStart = std::chrono::steady_clock::now();
+    frameOpen = true;
+}
+
+void Profiler::endFrame() {
+    if (!enabled || !frameOpen) return;
+
+    std::chrono::duration<float, std::milli> elapsed = std::chrono::steady_clock::now() - frameStart;
+    current.frameMs = elapsed.count();
+
+    history[head] = current;
+    head = (head + 1) % HISTORY_SIZE;
+    if (count < HISTORY_SIZE) {
+        count++;
+    }
+    frameOpen = false;
+}
+
+void Profiler::addSample(Phase phase, float ms) {
+    if (!frameOpen || phase < 0 || phase >= PhaseCount) return;
+    current.phaseMs[phase] += ms;
+}
+
+void Profiler::countSimulationStep() {
+    if (!frameOpen) return;
+    current.simulationSteps++;
+}
+
+void Profiler::setRenderCounters(std::size_t commands, std::size_t batches, std::size_t textureSwitches) {
+    if (!frameOpen) return;
+    current.renderCommands = commands;
+    current.renderBatches = batches;
+    current.textureSwitches = textureSwitches;
+}
+
+const Profiler::FrameSample& Profiler::getFrame(std::size_t index) const {
+    static const FrameSample empty;
+    if (index >= count) return empty;
+
+    // Oldest frame sits at head once the buffer has wrapped
+    std::size_t oldest = (count < HISTORY_SIZE) ? 0 : head;
+    return history[(oldest + index) % HISTORY_SIZE];
+}
+
+const char* Profiler::getPhaseName(Phase phase) {
+    switch (phase) {
+        case PlayerCollision: return "player_collision";
+        case EnemyGrid: return "enemy_grid";
+        case KineticWave: return "kinetic_wave";
+        case EnemyProjectiles: return "enemy_projectiles";
+        case Enemies: return "enemies";
+        case Particles: return "particles";
+        case CameraUpdate: return "camera";
+        case RenderBackground: return "render_background";
+        case RenderPlatforms: return "render_platforms";
+        case RenderEntities: return "render_entities";
+        case RenderParticles: return "render_particles";
+        case RenderUI: return "render_ui";
+        case RenderWait: return "render_wait";
+        default: return "unknown";
+    }
+}
+
+bool Profiler::exportCSV(const std::string& filepath, std::size_t frames) const {
+    std::ofstream file(filepath);
+    if (!file.is_open()) {
+        std::cerr << "Warning: Could not write profiler CSV: " << filepath << "\n";
+        return false;
+    }
+
+    if (frames == 0 || frames > count) {
+        frames = count;
+    }
+
+    file << "frame,frame_ms,sim_steps,render_commands,render_batches,texture_switches";
+    for (int p = 0; p < PhaseCount; ++p) {
+        file << "," << getPhaseName(static_cast<Phase>(p)) << "_ms";
+    }
+    file << "\n";
+
+    file << std::fixed << std::setprecision(4);
+    const std::size_t first = count - frames;
+    for (std::size_t i = first; i < count; ++i) {
+        const FrameSample& sample = getFrame(i);
+        file << (i - first) << "," << sample.frameMs << "," << sample.simulationSteps << ","
+             << sample.renderCommands << "," << sample.renderBatches << "," << sample.textureSwitches;
+        for (float ms : sample.phaseMs) {
+            file << "," << ms;
+        }
+        file << "\n";
+    }
+
+    std::cout << "Profiler: wrote " << frames << " frames to " << filepath << std::endl;
+    return true;
+}
@@ -0,0 +1,133 @@
+#include "debug/ProfilerOverlay.h"
+#include "debug/Profiler.h"
+#include "core/Config.h"
+#include <algorithm>
+#include <cstdio>
+#include <string>
+
+sf::Color ProfilerOverlay::getPhaseColor(int phase) {
+    static const sf::Color colors[Profiler::PhaseCount] = {
+        sf::Color(230, 80, 80),     // PlayerCollision
+        sf::Color(230, 150, 60),    // EnemyGrid
+        sf::Color(230, 220, 70),    // KineticWave
+        sf::Color(150, 220, 70),    // EnemyProjectiles
+        sf::Color(70, 200, 120),    // Enemies
+        sf::Color(70, 210, 210),    // Particles
+        sf::Color(90, 150, 240),    // CameraUpdate
+        sf::Color(140, 100, 230),   // RenderBackground
+        sf::Color(200, 100, 220),   // RenderPlatforms
+        sf::Color(240, 120, 170),   // RenderEntities
+        sf::Color(180, 180, 240),   // RenderParticles
+        sf::Color(240, 240, 240),   // RenderUI
+        sf::Color(150, 130, 110)    // RenderWait
+    };
+    if (phase < 0 || phase >= Profiler::PhaseCount) {
+        return sf::Color(110, 110, 110);
+    }
+    return colors[phase];
+}
+
+void ProfilerOverlay::draw(sf::RenderWindow& window, const sf::Font& font) {
+    const Profiler& profiler = Profiler::getInstance();
+    const std::size_t frameCount = profiler.getFrameCount();
+
+    const float graphWidth = 360.0f;
+    const float graphHeight = 120.0f;
+    const float legendHeight = 14.0f * (Profiler::PhaseCount + 3);
+    const float panelX = static_cast<float>(window.getSize().x) - graphWidth - 10.0f;
+    const float panelY = 10.0f;
+
+    sf::RectangleShape background(sf::Vector2f(graphWidth, graphHeight + legendHeight + 10.0f));
+    background.setPosition(panelX, panelY);
+    background.setFillColor(sf::Color(0, 0, 0, 180));
+    window.draw(background);
+
+    const std::size_t graphFrames = std::min(frameCount, static_cast<std::size_t>(Config::PROFILER_GRAPH_FRAMES));
+    const std::size_t firstFrame = frameCount - graphFrames;
+    const float barWidth = graphWidth / static_cast<float>(Config::PROFILER_GRAPH_FRAMES);
+    const float msToPixels = graphHeight / Config::PROFILER_GRAPH_MAX_MS;
+    const float graphBottom = panelY + graphHeight;
+
+    // Stacked bars: one column per frame, one quad per phase + "other" on top
+    sf::VertexArray bars(sf::Quads);
+    float phaseTotals[Profiler::PhaseCount] = {};
+    float worstFrameMs = 0.0f;
+
+    auto addQuad = [&](float x, float yBottom, float height, const sf::Color& color) {
+        const float yTop = std::max(yBottom - height, panelY);
+        bars.append(sf::Vertex(sf::Vector2f(x, yTop), color));
+        bars.append(sf::Vertex(sf::Vector2f(x + barWidth, yTop), color));
+        bars.append(sf::Vertex(sf::Vector2f(x + barWidth, yBottom), color));
+        bars.append(sf::Vertex(sf::Vector2f(x, yBottom), color));
+    };
+
+    for (std::size_t i = 0; i < graphFrames; ++i) {
+        const Profiler::FrameSample& sample = profiler.getFrame(firstFrame + i);
+        const float x = panelX + static_cast<float>(i) * barWidth;
+        float y = graphBottom;
+        float tracked = 0.0f;
+
+        for (int p = 0; p < Profiler::PhaseCount; ++p) {
+            const float ms = sample.phaseMs[p];
+            phaseTotals[p] += ms;
+            tracked += ms;
+            if (ms <= 0.0f || y <= panelY) continue;
+            addQuad(x, y, ms * msToPixels, getPhaseColor(p));
+            y -= ms * msToPixels;
+        }
+
+        // Untracked time (vsync, event polling, display)
+        const float other = sample.frameMs - tracked;
+        if (other > 0.0f && y > panelY) {
+            addQuad(x, y, other * msToPixels, getPhaseColor(-1));
+        }
+        worstFrameMs = std::max(worstFrameMs, sample.frameMs);
+    }
+    window.draw(bars);
+
+    // Frame budget line (one simulation tick)
+    const float budgetMs = 1000.0f / static_cast<float>(Config::SIMULATION_TICK_RATE);
+    sf::RectangleShape budgetLine(sf::Vector2f(graphWidth, 1.0f));
+    budgetLine.setPosition(panelX, graphBottom - budgetMs * msToPixels);
+    budgetLine.setFillColor(sf::Color(255, 255, 255, 120));
+    window.draw(budgetLine);
+
+    // Legend: average per phase over the graphed frames
+    sf::Text text;
+    text.setFont(font);
+    text.setCharacterSize(11);
+    text.setFillColor(sf::Color::White);
+
+    char line[96];
+    float y = graphBottom + 6.0f;
+    const float frames = graphFrames > 0 ? static_cast<float>(graphFrames) : 1.0f;
+    const float lastMs = frameCount > 0 ? profiler.getLastFrame().frameMs : 0.0f;
+
+    std::snprintf(line, sizeof(line), "frame %.2f ms  worst %.2f ms  (F4: dump CSV)", lastMs, worstFrameMs);
+    text.setString(line);
+    text.setPosition(panelX + 6.0f, y);
+    window.draw(text);
+    y += 14.0f;
+
+    const Profiler::FrameSample& last = profiler.getLastFrame();   // Empty sample before the first frame
+    std::snprintf(line, sizeof(line), "queue %zu cmds  %zu batches  %zu tex switches",
+                  last.renderCommands, last.renderBatches, last.textureSwitches);
+    text.setString(line);
+    text.setPosition(panelX + 6.0f, y);
+    window.draw(text);
+    y += 14.0f;
+
+    sf::RectangleShape swatch(sf::Vector2f(8.0f, 8.0f));
+    for (int p = 0; p < Profiler::PhaseCount; ++p) {
+        swatch.setFillColor(getPhaseColor(p));
+        swatch.setPosition(panelX + 6.0f, y + 3.0f);
+        window.draw(swatch);
+
+        std::snprintf(line, sizeof(line), "%-18s %6.3f ms", Profiler::getPhaseName(static_cast<Profiler::Phase>(p)),
+                      phaseTotals[p] / frames);
+        text.setString(line);
+        text.setPosition(panelX + 20.0f, y);
+        window.draw(text);
+        y += 14.0f;
+    }
+}
@@ -12,12 +12,19 @@
 #include "world/Camera.h"
 #include "world/InteractiveObject.h"
 #include "world/LevelLoader.h"
+#include "world/LevelCache.h"
+#include "world/LevelBinary.h"
 #include "world/Platform.h"
+#include "core/Config.h"
+#include "core/AssetFileSystem.h"
+#include "physics/PlatformIndex.h"
+#include "graphics/PlatformRenderer.h"
+#include "graphics/RenderQueue.h"
 
 #include <SFML/Window/Keyboard.hpp>
 #include <SFML/Window/Mouse.hpp>
 #include <algorithm>
-#include <filesystem>
+#include <cmath>
 #include <fstream>
 #include <iostream>
 #include <sstream>
@@ -32,14 +39,49 @@
 #include <nlohmann/json.hpp>
 #endif
 
+namespace {
+    // TextBatch key groups of the object labels
+    enum EditorLabel : std::uint32_t { LabelPlatform, LabelEnemy, LabelInteractive, LabelCheckpoint, LabelPortal };
+
+    TextStyle labelStyle(unsigned int characterSize, const sf::Color& color) {
+        TextStyle style;
+        style.characterSize = characterSize;
+        style.fillColor = color;
+        return style;
+    }
+
+    // Area an enemy's overlay covers: its bounds plus the patrol line and markers
+    sf::FloatRect overlayBounds(Enemy& enemy) {
+        sf::FloatRect bounds = enemy.getBounds();
+        if (enemy.getType() != EnemyType::Patrol && enemy.getType() != EnemyType::Flying) {
+            return bounds;
+        }
+
+        float left = bounds.left;
+        float right = bounds.left + bounds.width;
+        float top = bounds.top;
+        float bottom = bounds.top + bounds.height;
+        FlyingEnemy* flyingEnemy = dynamic_cast<FlyingEnemy*>(&enemy);
+        if (flyingEnemy && (flyingEnemy->getTopBound() != 0.0f || flyingEnemy->getBottomBound() != 0.0f)) {
+            top = std::min(top, flyingEnemy->getTopBound());
+            bottom = std::max(bottom, flyingEnemy->getBottomBound());
+        } else {
+            left = std::min(left, enemy.getLeftBound());
+            right = std::max(right, enemy.getRightBound());
+        }
+        return sf::FloatRect(left, top, right - left, bottom - top);
+    }
+}
+
 EditorController::EditorController() {
-    if (!editorFont.loadFromFile("assets/fonts/arial.ttf")) {
+    if (!editorFont.loadFromFile(AssetFileSystem::getInstance().resolve("assets/fonts/arial.ttf"))) {
         std::cout << "Warning: Unable to load editor font assets/fonts/arial.ttf\n";
     }
 
     if (isFontLoaded()) {
         editorText.setFont(editorFont);
         saveMessageText.setFont(editorFont);
+        labels.setFont(editorFont);
     }
 
     editorText.setFillColor(sf::Color::Red);
@@ -143,6 +185,8 @@ void EditorController::handleEvent(const sf::Event& event, EditorContext& ctx) {
                     }
                     if (!clickedObject) {
                         ctx.platforms.push_back(std::make_unique<Platform>(worldPos.x, worldPos.y, 100.0f, 20.0f, Platform::Type::Floor));
+                        ctx.platformIndex.build(ctx.platforms);
+                        ctx.platformRenderer.build(ctx.platforms);
                         selectedPlatformIndex = static_cast<int>(ctx.platforms.size() - 1);
                         selectedEnemyIndex = -1;
                         selectedInteractiveIndex = -1;
@@ -359,6 +403,7 @@ void EditorController::handleEvent(const sf::Event& event, EditorContext& ctx) {
                                 break;
                         }
                         selectedEnemyIndex = static_cast<int>(ctx.enemies.size() - 1);
+                        if (ctx.enemiesChanged) ctx.enemiesChanged();
                         selectedPlatformIndex = -1;
                         selectedInteractiveIndex = -1;
                         selectedCheckpointIndex = -1;
@@ -379,6 +424,8 @@ void EditorController::handleEvent(const sf::Event& event, EditorContext& ctx) {
                 sf::FloatRect bounds = ctx.platforms[i]->getBounds();
                 if (bounds.contains(worldPos)) {
                     ctx.platforms.erase(ctx.platforms.begin() + i);
+                    ctx.platformIndex.build(ctx.platforms);
+                    ctx.platformRenderer.build(ctx.platforms);
                     if (selectedPlatformIndex == static_cast<int>(i)) {
                         selectedPlatformIndex = -1;
                     } else if (selectedPlatformIndex > static_cast<int>(i)) {
@@ -423,6 +470,7 @@ void EditorController::handleEvent(const sf::Event& event, EditorContext& ctx) {
                     sf::FloatRect bounds = ctx.enemies[i]->getBounds();
                     if (bounds.contains(worldPos)) {
                         ctx.enemies.erase(ctx.enemies.begin() + i);
+                        if (ctx.enemiesChanged) ctx.enemiesChanged();
                         if (selectedEnemyIndex == static_cast<int>(i)) {
                             selectedEnemyIndex = -1;
                         } else if (selectedEnemyIndex > static_cast<int>(i)) {
@@ -592,9 +640,12 @@ void EditorController::handleEvent(const sf::Event& event, EditorContext& ctx) {
     if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::Delete) {
         if (selectedPlatformIndex >= 0 && selectedPlatformIndex < static_cast<int>(ctx.platforms.size())) {
             ctx.platforms.erase(ctx.platforms.begin() + selectedPlatformIndex);
+            ctx.platformIndex.build(ctx.platforms);
+            ctx.platformRenderer.build(ctx.platforms);
             selectedPlatformIndex = -1;
         } else if (selectedEnemyIndex >= 0 && selectedEnemyIndex < static_cast<int>(ctx.enemies.size())) {
             ctx.enemies.erase(ctx.enemies.begin() + selectedEnemyIndex);
+            if (ctx.enemiesChanged) ctx.enemiesChanged();
             selectedEnemyIndex = -1;
         } else if (selectedInteractiveIndex >= 0 && selectedInteractiveIndex < static_cast<int>(ctx.interactiveObjects.size())) {
             ctx.interactiveObjects.erase(ctx.interactiveObjects.begin() + selectedInteractiveIndex);
@@ -645,6 +696,7 @@ void EditorController::handleEvent(const sf::Event& event, EditorContext& ctx) {
                 default: break;
             }
             ctx.platforms[selectedPlatformIndex]->setType(nextType);
+            ctx.platformRenderer.update(static_cast<std::size_t>(selectedPlatformIndex));
             std::cout << "Type de plateforme change\n";
         }
     }
@@ -661,6 +713,10 @@ void EditorController::handleEvent(const sf::Event& event, EditorContext& ctx) {
         } else if (event.key.code == sf::Keyboard::PageDown) {
             ctx.platforms[selectedPlatformIndex]->setSize(currentSize.x, std::max(10.0f, currentSize.y - resizeStep));
         }
+        if (ctx.platforms[selectedPlatformIndex]->getSize() != currentSize) {
+            ctx.platformIndex.update(static_cast<std::size_t>(selectedPlatformIndex));
+            ctx.platformRenderer.update(static_cast<std::size_t>(selectedPlatformIndex));
+        }
     }
 
     if (event.type == sf::Event::KeyPressed && selectedEnemyIndex >= 0 && selectedEnemyIndex < static_cast<int>(ctx.enemies.size())) {
@@ -695,6 +751,8 @@ void EditorController::update(float dt, EditorContext& ctx) {
         sf::Vector2i mousePixelPos = sf::Mouse::getPosition(ctx.window);
         sf::Vector2f worldPos = screenToWorld(sf::Vector2f(static_cast<float>(mousePixelPos.x), static_cast<float>(mousePixelPos.y)), ctx);
         ctx.platforms[selectedPlatformIndex]->setPosition(worldPos.x - dragOffset.x, worldPos.y - dragOffset.y);
+        ctx.platformIndex.update(static_cast<std::size_t>(selectedPlatformIndex));
+        ctx.platformRenderer.update(static_cast<std::size_t>(selectedPlatformIndex));
     }
 
     if (isDraggingEnemy && selectedEnemyIndex >= 0 && selectedEnemyIndex < static_cast<int>(ctx.enemies.size())) {
@@ -761,8 +819,29 @@ void EditorController::render(EditorContext& ctx) {
         ctx.camera->apply(ctx.window);
     }
 
-    for (size_t i = 0; i < ctx.platforms.size(); ++i) {
-        ctx.platforms[i]->draw(ctx.window);
+    // Only the view (plus margin) is drawn; labels and patrol markers are covered by the margin
+    const sf::FloatRect visible = Camera::visibleArea(ctx.window.getView(), Config::RENDER_CULL_MARGIN);
+
+    ctx.platformRenderer.draw(ctx.window);
+
+    // Limites des secteurs (mise en veille des ennemis par secteur)
+    if (ctx.currentLevel && ctx.currentLevel->sectorSize > 0.0f) {
+        const float size = ctx.currentLevel->sectorSize;
+        sf::VertexArray sectorLines(sf::Lines);
+        const sf::Color lineColor(0, 200, 255, 90);
+        for (float x = std::floor(visible.left / size) * size; x <= visible.left + visible.width; x += size) {
+            sectorLines.append(sf::Vertex(sf::Vector2f(x, visible.top), lineColor));
+            sectorLines.append(sf::Vertex(sf::Vector2f(x, visible.top + visible.height), lineColor));
+        }
+        for (float y = std::floor(visible.top / size) * size; y <= visible.top + visible.height; y += size) {
+            sectorLines.append(sf::Vertex(sf::Vector2f(visible.left, y), lineColor));
+            sectorLines.append(sf::Vertex(sf::Vector2f(visible.left + visible.width, y), lineColor));
+        }
+        ctx.window.draw(sectorLines);
+    }
+
+    ctx.platformIndex.queryIndices(visible, visiblePlatforms);
+    for (size_t i : visiblePlatforms) {
         if (static_cast<int>(i) == selectedPlatformIndex) {
             sf::FloatRect bounds = ctx.platforms[i]->getBounds();
             sf::RectangleShape outline;
@@ -774,23 +853,30 @@ void EditorController::render(EditorContext& ctx) {
             ctx.window.draw(outline);
         }
         if (isFontLoaded()) {
-            sf::Text indexText;
-            indexText.setFont(editorFont);
-            indexText.setString(std::to_string(i));
-            indexText.setCharacterSize(12);
-            indexText.setFillColor(sf::Color::White);
             sf::FloatRect bounds = ctx.platforms[i]->getBounds();
-            indexText.setPosition(bounds.left + bounds.width / 2.0f - 10.0f, bounds.top - 15.0f);
-            ctx.window.draw(indexText);
+            labels.put(TextBatch::key(LabelPlatform, static_cast<std::uint32_t>(i)), std::to_string(i),
+                       labelStyle(12, sf::Color::White),
+                       sf::Vector2f(bounds.left + bounds.width / 2.0f - 10.0f, bounds.top - 15.0f));
         }
     }
 
+    // Entities go through the game's render queue first; markers and labels end up on top
+    for (const auto& enemy : ctx.enemies) {
+        // Draw enemy even if dead (forceDraw = true for editor)
+        if (enemy && enemy->getBounds().intersects(visible)) enemy->submit(ctx.renderQueue, sf::Vector2f(), true);
+    }
+    for (const auto& interactive : ctx.interactiveObjects) {
+        if (interactive->getBounds().intersects(visible)) interactive->submit(ctx.renderQueue);
+    }
+    for (const auto& checkpoint : ctx.checkpoints) {
+        if (checkpoint->getBounds().intersects(visible)) checkpoint->submit(ctx.renderQueue);
+    }
+    ctx.renderQueue.flush(ctx.window);
+
     for (size_t i = 0; i < ctx.enemies.size(); ++i) {
         Enemy* enemy = ctx.enemies[i].get();
         if (!enemy) continue; // Skip null enemies
-        
-        // Draw enemy even if dead (forceDraw = true for editor)
-        enemy->draw(ctx.window, true);
+        if (!overlayBounds(*enemy).intersects(visible)) continue;
 
         if (enemy->getType() == EnemyType::Patrol || enemy->getType() == EnemyType::Flying) {
             sf::Vector2f pos = enemy->getPosition();
@@ -851,23 +937,19 @@ void EditorController::render(EditorContext& ctx) {
         }
 
         if (isFontLoaded()) {
-            sf::Text indexText;
-            indexText.setFont(editorFont);
             std::string info = "E" + std::to_string(i);
             if (enemy->getType() == EnemyType::Patrol || enemy->getType() == EnemyType::Flying) {
                 info += " (" + std::to_string(static_cast<int>(enemy->getPatrolDistance())) + ")";
             }
-            indexText.setString(info);
-            indexText.setCharacterSize(12);
-            indexText.setFillColor(sf::Color::Cyan);
             sf::FloatRect bounds = ctx.enemies[i]->getBounds();
-            indexText.setPosition(bounds.left + bounds.width / 2.0f - 20.0f, bounds.top - 15.0f);
-            ctx.window.draw(indexText);
+            labels.put(TextBatch::key(LabelEnemy, static_cast<std::uint32_t>(i)), info,
+                       labelStyle(12, sf::Color::Cyan),
+                       sf::Vector2f(bounds.left + bounds.width / 2.0f - 20.0f, bounds.top - 15.0f));
         }
     }
 
     for (size_t i = 0; i < ctx.interactiveObjects.size(); ++i) {
-        ctx.interactiveObjects[i]->draw(ctx.window);
+        if (!ctx.interactiveObjects[i]->getBounds().intersects(visible)) continue;
         if (static_cast<int>(i) == selectedInteractiveIndex) {
             sf::FloatRect bounds = ctx.interactiveObjects[i]->getBounds();
             sf::RectangleShape outline;
@@ -879,25 +961,21 @@ void EditorController::render(EditorContext& ctx) {
             ctx.window.draw(outline);
         }
         if (isFontLoaded()) {
-            sf::Text indexText;
-            indexText.setFont(editorFont);
             std::string typeStr = "T";
             switch (ctx.interactiveObjects[i]->getType()) {
                 case InteractiveType::Terminal: typeStr = "Term"; break;
                 case InteractiveType::Door: typeStr = "Door"; break;
                 case InteractiveType::Turret: typeStr = "Turr"; break;
             }
-            indexText.setString("I" + std::to_string(i) + " " + typeStr);
-            indexText.setCharacterSize(12);
-            indexText.setFillColor(sf::Color::Magenta);
             sf::FloatRect bounds = ctx.interactiveObjects[i]->getBounds();
-            indexText.setPosition(bounds.left + bounds.width / 2.0f - 25.0f, bounds.top - 15.0f);
-            ctx.window.draw(indexText);
+            labels.put(TextBatch::key(LabelInteractive, static_cast<std::uint32_t>(i)),
+                       "I" + std::to_string(i) + " " + typeStr, labelStyle(12, sf::Color::Magenta),
+                       sf::Vector2f(bounds.left + bounds.width / 2.0f - 25.0f, bounds.top - 15.0f));
         }
     }
 
     for (size_t i = 0; i < ctx.checkpoints.size(); ++i) {
-        ctx.checkpoints[i]->draw(ctx.window);
+        if (!ctx.checkpoints[i]->getBounds().intersects(visible)) continue;
         if (static_cast<int>(i) == selectedCheckpointIndex) {
             sf::FloatRect bounds = ctx.checkpoints[i]->getBounds();
             sf::RectangleShape outline;
@@ -909,20 +987,19 @@ void EditorController::render(EditorContext& ctx) {
             ctx.window.draw(outline);
         }
         if (isFontLoaded()) {
-            sf::Text indexText;
-            indexText.setFont(editorFont);
-            indexText.setString("CP" + std::to_string(i) + "\n" + ctx.checkpoints[i]->getId());
-            indexText.setCharacterSize(12);
-            indexText.setFillColor(sf::Color::Green);
             sf::FloatRect bounds = ctx.checkpoints[i]->getBounds();
-            indexText.setPosition(bounds.left + bounds.width / 2.0f - 30.0f, bounds.top - 30.0f);
-            ctx.window.draw(indexText);
+            labels.put(TextBatch::key(LabelCheckpoint, static_cast<std::uint32_t>(i)),
+                       "CP" + std::to_string(i) + "\n" + ctx.checkpoints[i]->getId(),
+                       labelStyle(12, sf::Color::Green),
+                       sf::Vector2f(bounds.left + bounds.width / 2.0f - 30.0f, bounds.top - 30.0f));
         }
     }
 
     if (ctx.currentLevel) {
         for (size_t i = 0; i < ctx.currentLevel->portals.size(); ++i) {
             const auto& portal = ctx.currentLevel->portals[i];
+            if (!sf::FloatRect(portal.x, portal.y, portal.width, portal.height).intersects(visible)) continue;
+
             sf::RectangleShape portalRect;
             portalRect.setSize(sf::Vector2f(portal.width, portal.height));
             portalRect.setPosition(portal.x, portal.y);
@@ -942,18 +1019,17 @@ void EditorController::render(EditorContext& ctx) {
             }
 
             if (isFontLoaded()) {
-                sf::Text indexText;
-                indexText.setFont(editorFont);
                 std::string info = "Portal" + std::to_string(i) + "\n" + portal.targetLevel + "\n" + portal.spawnDirection;
-                indexText.setString(info);
-                indexText.setCharacterSize(10);
-                indexText.setFillColor(sf::Color::Magenta);
-                indexText.setPosition(portal.x + portal.width / 2.0f - 40.0f, portal.y - 45.0f);
-                ctx.window.draw(indexText);
+                labels.put(TextBatch::key(LabelPortal, static_cast<std::uint32_t>(i)), info,
+                           labelStyle(10, sf::Color::Magenta),
+                           sf::Vector2f(portal.x + portal.width / 2.0f - 40.0f, portal.y - 45.0f));
             }
         }
     }
 
+    // All labels above the objects, in one draw call per text size
+    labels.draw(ctx.window);
+
     ctx.window.setView(ctx.window.getDefaultView());
 
     if (isFontLoaded()) {
@@ -994,7 +1070,10 @@ void EditorController::render(EditorContext& ctx) {
             "P: Changer preset ennemi (" + getPresetName(currentEnemyPreset) + ")\n"
             "Plateformes: " + std::to_string(ctx.platforms.size()) + "\n"
             "Ennemis: " + std::to_string(ctx.enemies.size()) + "\n"
-            "Objets interactifs: " + std::to_string(ctx.interactiveObjects.size()));
+            "Objets interactifs: " + std::to_string(ctx.interactiveObjects.size()) + "\n" +
+            "Secteurs: " + (ctx.currentLevel && ctx.currentLevel->sectorSize > 0.0f
+                                ? std::to_string(static_cast<int>(ctx.currentLevel->sectorSize)) + " px (\"sectorSize\")"
+                                : std::string("non (\"sectorSize\" dans le JSON)")));
 
         if (selectedEnemyIndex >= 0 && selectedEnemyIndex < static_cast<int>(ctx.enemies.size())) {
             Enemy* enemy = ctx.enemies[selectedEnemyIndex].get();
@@ -1085,56 +1164,10 @@ void EditorController::saveLevel(EditorContext& ctx) {
         filename = ctx.currentLevelPath;
     }
 
-    std::string savePath;
-    try {
-        std::filesystem::path currentDir = std::filesystem::current_path();
-        std::filesystem::path sourcePath = currentDir;
-        bool foundRoot = false;
-        for (int i = 0; i < 10; ++i) {
-            if (sourcePath.filename() == "nouveauprojet" || sourcePath.filename() == "PlatformerGame") {
-                foundRoot = true;
-                break;
-            }
-            if (sourcePath.has_parent_path()) {
-                sourcePath = sourcePath.parent_path();
-            } else {
-                break;
-            }
-        }
-        if (foundRoot) {
-            if (sourcePath.filename() == "nouveauprojet") {
-                savePath = (sourcePath / "PlatformerGame" / "assets" / "levels" / filename).string();
-            } else {
-                savePath = (sourcePath / "assets" / "levels" / filename).string();
-            }
-            std::cout << "Chemin source construit: " << savePath << "\n";
-        } else {
-            std::vector<std::string> possiblePaths = {
-                "../../../PlatformerGame/assets/levels/" + filename,
-                "../../PlatformerGame/assets/levels/" + filename,
-                "../PlatformerGame/assets/levels/" + filename,
-                "PlatformerGame/assets/levels/" + filename
-            };
-            bool found = false;
-            for (const auto& path : possiblePaths) {
-                std::ifstream test(path);
-                if (test.is_open()) {
-                    test.close();
-                    savePath = path;
-                    found = true;
-                    std::cout << "Fichier source trouve (relatif): " << savePath << "\n";
-                    break;
-                }
-            }
-            if (!found) {
-                savePath = "../../../PlatformerGame/assets/levels/" + filename;
-                std::cout << "Utilisation du chemin par defaut: " << savePath << "\n";
-            }
-        }
-    } catch (const std::exception&) {
-        savePath = "../../../PlatformerGame/assets/levels/" + filename;
-        std::cout << "Erreur filesystem, utilisation chemin par defaut: " << savePath << "\n";
-    }
+    // Copie du niveau dans les sources du projet (la copie du dossier de build est ecrasee au build suivant)
+    const std::string assetPath = "assets/levels/" + filename;
+    std::string savePath = AssetFileSystem::getInstance().getWritablePath(assetPath);
+    std::cout << "Chemin de sauvegarde: " << savePath << "\n";
 
 #if GAME_HAS_JSON
     std::ifstream file(savePath);
@@ -1319,6 +1352,8 @@ void EditorController::saveLevel(EditorContext& ctx) {
 
     outFile << j.dump(2);
     outFile.close();
+    AssetFileSystem::getInstance().addFile(assetPath, savePath);
+    compileSavedLevel(savePath);
 
     std::cout << "Niveau sauvegarde dans " << savePath << " (" << ctx.platforms.size() << " plateformes)\n";
     std::cout << "Verifie le fichier: " << savePath << "\n";
@@ -1553,6 +1588,8 @@ fallback_save:
 
     outFile << content;
     outFile.close();
+    AssetFileSystem::getInstance().addFile(assetPath, savePath);
+    compileSavedLevel(savePath);
 
     std::cout << "Niveau sauvegarde (fallback) dans " << savePath << " (" << ctx.platforms.size() << " plateformes)\n";
     std::cout << "Verifie le fichier: " << savePath << "\n";
@@ -1561,6 +1598,17 @@ fallback_save:
     setSaveMessage("Niveau sauvegarde !", sf::Color::Green);
 }
 
+void EditorController::compileSavedLevel(const std::string& savePath) {
+    // Le JSON reste le format d'edition ; le jeu charge la version compilee
+    LevelCache::getInstance().invalidate(savePath);
+    const std::string binaryPath = LevelBinary::pathFor(savePath);
+    if (LevelLoader::compileLevel(savePath, binaryPath)) {
+        std::cout << "Niveau compile dans " << binaryPath << "\n";
+    } else {
+        std::cout << "Erreur: Compilation du niveau impossible (" << binaryPath << ")\n";
+    }
+}
+
 EnemyStats EditorController::getPresetStats(EnemyPresetType preset) const {
     switch (preset) {
         case EnemyPresetType::Basic:
@@ -1,35 +1,156 @@
 #include "effects/ParticleSystem.h"
+#include "graphics/RenderQueue.h"
+#include <algorithm>
 #include <cmath>
+#include <iostream>
 
-ParticleSystem::ParticleSystem()
-    : randomEngine(std::random_device{}())
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#include <xmmintrin.h>
+#define PARTICLES_USE_SSE 1
+#endif
+
+namespace {
+    // Dot texture resolution (particles are scaled quads, the texture is filtered)
+    constexpr unsigned int DOT_TEXTURE_SIZE = 64;
+
+    // Arrays are padded to whole SIMD blocks so the kernel needs no scalar tail
+    constexpr std::size_t SIMD_BLOCK = 8;
+
+    std::size_t roundUpToBlock(std::size_t value) {
+        return (value + SIMD_BLOCK - 1) & ~(SIMD_BLOCK - 1);
+    }
+}
+
+ParticleSystem::ParticleSystem(std::size_t capacity)
+    : capacity(capacity)
+    , liveCount(0)
+    , posX(roundUpToBlock(capacity))
+    , posY(roundUpToBlock(capacity))
+    , velX(roundUpToBlock(capacity))
+    , velY(roundUpToBlock(capacity))
+    , lifetime(roundUpToBlock(capacity))
+    , alphaScale(roundUpToBlock(capacity))
+    , size(roundUpToBlock(capacity))
+    , colors(roundUpToBlock(capacity))
+    , randomEngine(std::random_device{}())
     , distribution(0.0f, 1.0f)
+    , vertices(sf::Quads)
+    , dotTextureReady(false)
+    , roundParticles(true)
 {
-    particles.reserve(1000); // Pre-allocate for performance
+    vertices.resize(std::min<std::size_t>(capacity, 1000) * 4);
 }
 
 void ParticleSystem::update(float dt) {
-    // Update all particles
-    for (auto& particle : particles) {
-        particle.update(dt);
+    // Integration kernel: independent float streams, no branches.
+    // Runs over whole blocks; padding slots past liveCount are dead and never read.
+    float* px = posX.data();
+    float* py = posY.data();
+    const float* vx = velX.data();
+    const float* vy = velY.data();
+    float* life = lifetime.data();
+    const std::size_t n = roundUpToBlock(liveCount);
+
+#ifdef PARTICLES_USE_SSE
+    const __m128 step = _mm_set1_ps(dt);
+    for (std::size_t i = 0; i < n; i += 4) {
+        _mm_storeu_ps(px + i, _mm_add_ps(_mm_loadu_ps(px + i), _mm_mul_ps(_mm_loadu_ps(vx + i), step)));
+        _mm_storeu_ps(py + i, _mm_add_ps(_mm_loadu_ps(py + i), _mm_mul_ps(_mm_loadu_ps(vy + i), step)));
+        _mm_storeu_ps(life + i, _mm_sub_ps(_mm_loadu_ps(life + i), step));
+    }
+#else
+    // Plain loop the compiler auto-vectorises (NEON / -O3)
+    for (std::size_t i = 0; i < n; ++i) {
+        px[i] += vx[i] * dt;
+        py[i] += vy[i] * dt;
+        life[i] -= dt;
     }
+#endif
 
-    // Remove dead particles
-    particles.erase(
-        std::remove_if(particles.begin(), particles.end(),
-            [](const Particle& p) { return !p.isAlive(); }),
-        particles.end()
-    );
+    removeDead();
+}
+
+void ParticleSystem::removeDead() {
+    // Swap-remove: the last live particle fills the hole (draw order is not significant)
+    std::size_t i = 0;
+    while (i < liveCount) {
+        if (lifetime[i] > 0.0f) {
+            ++i;
+            continue;
+        }
+        const std::size_t last = --liveCount;
+        posX[i] = posX[last];
+        posY[i] = posY[last];
+        velX[i] = velX[last];
+        velY[i] = velY[last];
+        lifetime[i] = lifetime[last];
+        alphaScale[i] = alphaScale[last];
+        size[i] = size[last];
+        colors[i] = colors[last];
+    }
+}
+
+void ParticleSystem::submit(RenderQueue& queue) {
+    if (liveCount == 0) {
+        return;
+    }
+
+    const bool textured = roundParticles && ensureDotTexture();
+    const float texSize = static_cast<float>(DOT_TEXTURE_SIZE);
+
+    // Grow only: the array keeps its capacity between frames
+    const std::size_t vertexCount = liveCount * 4;
+    if (vertices.getVertexCount() < vertexCount) {
+        vertices.resize(vertexCount);
+    }
+
+    for (std::size_t i = 0, v = 0; i < liveCount; ++i, v += 4) {
+        const float left = posX[i] - size[i];
+        const float top = posY[i] - size[i];
+        const float right = posX[i] + size[i];
+        const float bottom = posY[i] + size[i];
+
+        // Fade out over the lifetime
+        sf::Color tint = colors[i];
+        tint.a = static_cast<sf::Uint8>(std::max(lifetime[i] * alphaScale[i], 0.0f));
+
+        vertices[v + 0] = sf::Vertex(sf::Vector2f(left, top), tint, sf::Vector2f(0.0f, 0.0f));
+        vertices[v + 1] = sf::Vertex(sf::Vector2f(right, top), tint, sf::Vector2f(texSize, 0.0f));
+        vertices[v + 2] = sf::Vertex(sf::Vector2f(right, bottom), tint, sf::Vector2f(texSize, texSize));
+        vertices[v + 3] = sf::Vertex(sf::Vector2f(left, bottom), tint, sf::Vector2f(0.0f, texSize));
+    }
+
+    // Only the live prefix is drawn (the tail is left over from larger frames)
+    queue.submitBatch(RenderLayer::Particles, textured ? &dotTexture : nullptr,
+                      &vertices[0], vertexCount, sf::Quads);
 }
 
-void ParticleSystem::draw(sf::RenderWindow& window) {
-    for (const auto& particle : particles) {
-        sf::CircleShape shape(particle.size);
-        shape.setPosition(particle.position);
-        shape.setFillColor(particle.color);
-        shape.setOrigin(particle.size, particle.size);
-        window.draw(shape);
+bool ParticleSystem::ensureDotTexture() {
+    if (dotTextureReady) {
+        return true;
+    }
+
+    // Filled disc with a 1px anti-aliased rim (same look as the old sf::CircleShape)
+    sf::Image image;
+    image.create(DOT_TEXTURE_SIZE, DOT_TEXTURE_SIZE, sf::Color::Transparent);
+    const float radius = DOT_TEXTURE_SIZE / 2.0f;
+    for (unsigned int y = 0; y < DOT_TEXTURE_SIZE; ++y) {
+        for (unsigned int x = 0; x < DOT_TEXTURE_SIZE; ++x) {
+            const float dx = static_cast<float>(x) + 0.5f - radius;
+            const float dy = static_cast<float>(y) + 0.5f - radius;
+            const float coverage = std::clamp(radius - std::sqrt(dx * dx + dy * dy), 0.0f, 1.0f);
+            image.setPixel(x, y, sf::Color(255, 255, 255, static_cast<sf::Uint8>(coverage * 255.0f)));
+        }
+    }
+
+    if (!dotTexture.loadFromImage(image)) {
+        std::cout << "Warning: particle dot texture unavailable, drawing square particles\n";
+        roundParticles = false;
+        return false;
     }
+    dotTexture.setSmooth(true);
+    dotTextureReady = true;
+    return true;
 }
 
 void ParticleSystem::emitJump(const sf::Vector2f& position) {
@@ -175,7 +296,23 @@ void ParticleSystem::emitKineticWave(const sf::Vector2f& position, const sf::Vec
 }
 
 void ParticleSystem::clear() {
-    particles.clear();
+    liveCount = 0;
+}
+
+int ParticleSystem::emitBudget(int requested) const {
+    const std::size_t freeSlots = capacity - liveCount;
+    if (requested <= 0 || freeSlots == 0) {
+        return 0;
+    }
+
+    // Past the soft limit, scale bursts by the room left so effects thin out instead of
+    // vanishing all at once when the store is full
+    const std::size_t softLimit = static_cast<std::size_t>(capacity * Config::PARTICLE_BUDGET_SOFT_LIMIT);
+    std::size_t allowed = static_cast<std::size_t>(requested);
+    if (liveCount > softLimit && capacity > softLimit) {
+        allowed = (allowed * freeSlots + (capacity - softLimit) - 1) / (capacity - softLimit);
+    }
+    return static_cast<int>(std::min(allowed, freeSlots));
 }
 
 void ParticleSystem::emitParticles(
@@ -192,8 +329,9 @@ void ParticleSystem::emitParticles(
     float angleMax
 ) {
     const float PI = 3.14159265359f;
+    const int budget = emitBudget(count);
 
-    for (int i = 0; i < count; ++i) {
+    for (int i = 0; i < budget; ++i) {
         // Random angle in radians
         float angle = randomFloat(angleMin, angleMax) * PI / 180.0f;
         float speed = randomFloat(minSpeed, maxSpeed);
@@ -204,10 +342,18 @@ void ParticleSystem::emitParticles(
             std::sin(angle) * speed
         );
 
-        float lifetime = randomFloat(minLifetime, maxLifetime);
-        float size = randomFloat(minSize, maxSize);
+        const float life = randomFloat(minLifetime, maxLifetime);
+        const float radius = randomFloat(minSize, maxSize);
 
-        particles.emplace_back(position, velocity, color, lifetime, size);
+        const std::size_t slot = liveCount++;
+        posX[slot] = position.x;
+        posY[slot] = position.y;
+        velX[slot] = velocity.x;
+        velY[slot] = velocity.y;
+        lifetime[slot] = life;
+        alphaScale[slot] = 255.0f / life;
+        size[slot] = radius;
+        colors[slot] = color;
     }
 }
 
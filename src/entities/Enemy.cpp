@@ -1,4 +1,5 @@
 #include "entities/Enemy.h"
+#include "graphics/RenderQueue.h"
 
 Enemy::Enemy(float x, float y, EnemyType type, const EnemyStats& stats)
     : Entity(x, y, stats.sizeX, stats.sizeY)
@@ -16,13 +17,13 @@ Enemy::Enemy(float x, float y, EnemyType type, const EnemyStats& stats)
     shape.setPosition(position);
 }
 
-void Enemy::draw(sf::RenderWindow& window) {
+void Enemy::submit(RenderQueue& queue, const sf::Vector2f& offset) {
     if (alive) {
-        window.draw(shape);
+        queue.submit(RenderLayer::Enemies, shape, offset);
     }
 }
 
-void Enemy::draw(sf::RenderWindow& window, bool forceDraw) {
+void Enemy::submit(RenderQueue& queue, const sf::Vector2f& offset, bool forceDraw) {
     if (alive || forceDraw) {
         // Draw with reduced opacity if dead
         if (!alive && forceDraw) {
@@ -30,10 +31,10 @@ void Enemy::draw(sf::RenderWindow& window, bool forceDraw) {
             sf::Color drawColor = originalColor;
             drawColor.a = 128; // 50% opacity for dead enemies
             shape.setFillColor(drawColor);
-            window.draw(shape);
+            queue.submit(RenderLayer::Enemies, shape, offset);
             shape.setFillColor(originalColor); // Restore original color
         } else {
-            window.draw(shape);
+            queue.submit(RenderLayer::Enemies, shape, offset);
         }
     }
 }
@@ -1,4 +1,5 @@
 #include "entities/EnemyProjectile.h"
+#include "graphics/RenderQueue.h"
 #include <cmath>
 
 EnemyProjectile::EnemyProjectile(const sf::Vector2f& startPos, const sf::Vector2f& direction, float speed, float maxDistance, int damage)
@@ -42,10 +43,10 @@ void EnemyProjectile::update(float dt) {
     shape.setOrigin(currentSize, currentSize);
 }
 
-void EnemyProjectile::draw(sf::RenderWindow& window) {
+void EnemyProjectile::submit(RenderQueue& queue) {
     if (!alive) return;
     shape.setPosition(position);
-    window.draw(shape);
+    queue.submit(RenderLayer::Projectiles, shape);
 }
 
 sf::FloatRect EnemyProjectile::getBounds() const {
@@ -1,13 +1,27 @@
 #include "entities/Entity.h"
+#include "core/Config.h"
+#include <cmath>
 
 Entity::Entity(float x, float y, float width, float height)
     : position(x, y)
+    , previousPosition(x, y)
     , velocity(0.0f, 0.0f)
     , size(width, height)
     , isGrounded(false)
 {
 }
 
+sf::Vector2f Entity::getInterpolatedPosition(float alpha) const {
+    sf::Vector2f delta = position - previousPosition;
+
+    // Large jumps are teleports (respawn, level load): draw the new position directly
+    if (std::abs(delta.x) > Config::INTERPOLATION_SNAP_DISTANCE ||
+        std::abs(delta.y) > Config::INTERPOLATION_SNAP_DISTANCE) {
+        return position;
+    }
+    return previousPosition + delta * alpha;
+}
+
 sf::FloatRect Entity::getBounds() const {
     return sf::FloatRect(position.x, position.y, size.x, size.y);
 }
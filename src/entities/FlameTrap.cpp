@@ -1,5 +1,6 @@
 #include "entities/FlameTrap.h"
 #include "entities/EnemyProjectile.h"
+#include "graphics/RenderQueue.h"
 #include <cmath>
 #include <vector>
 
@@ -56,13 +57,13 @@ void FlameTrap::update(float dt) {
     updateFlameState(dt);
 }
 
-void FlameTrap::draw(sf::RenderWindow& window) {
+void FlameTrap::submit(RenderQueue& queue, const sf::Vector2f& offset) {
     // Change color if active
     sf::Color previous = shape.getFillColor();
     if (active) {
         shape.setFillColor(sf::Color(255, 200, 60));
     }
-    Enemy::draw(window);
+    Enemy::submit(queue, offset);
     shape.setFillColor(previous);
 }
 
@@ -1,5 +1,6 @@
 // Visual projectile used by Lyra's kinetic wave ability.
 #include "entities/KineticWaveProjectile.h"
+#include "graphics/RenderQueue.h"
 #include <cmath>
 
 KineticWaveProjectile::KineticWaveProjectile(const sf::Vector2f& startPos, const sf::Vector2f& direction, float speed, float maxDistance)
@@ -52,9 +53,9 @@ void KineticWaveProjectile::update(float dt) {
     shape.setOutlineColor(outlineColor);
 }
 
-void KineticWaveProjectile::draw(sf::RenderWindow& window) {
+void KineticWaveProjectile::submit(RenderQueue& queue) {
     if (!alive) return;
     shape.setPosition(position);
-    window.draw(shape);
+    queue.submit(RenderLayer::Projectiles, shape);
 }
 
@@ -2,9 +2,11 @@
 // for the three playable characters (Lyra / Noah / Sera).
 #include "entities/Player.h"
 #include "core/Config.h"
-#include "core/InputConfig.h"
 #include "physics/PhysicsConstants.h"
+#include "graphics/RenderQueue.h"
+#include <algorithm>
 #include <cmath>
+#include <memory>
 
 Player::Player(float x, float y, CharacterType type)
     : Entity(x, y, 
@@ -12,16 +14,6 @@ Player::Player(float x, float y, CharacterType type)
              (type == CharacterType::Noah) ? Config::PLAYER_WIDTH - 8.0f : Config::PLAYER_WIDTH,
              (type == CharacterType::Lyra) ? Config::PLAYER_HEIGHT + 15.0f : Config::PLAYER_HEIGHT)
     , characterType(type)
-    , currentAnimationFrame(0)
-    , animationTimer(0.0f)
-    , idleFrameDuration(0.133f)      // ~7.5 FPS (4 frames)
-    , runFrameDuration(0.083f)       // ~12 FPS (4 frames)
-    , jumpFrameDuration(0.1f)
-    , doubleJumpFrameDuration(0.1f)
-    , hurtFrameDuration(0.1f)
-    , deathFrameDuration(0.15f)      // un peu plus lent pour bien lire l'anim
-    , abilityFrameDuration(0.1f)
-    , kickFrameDuration(0.08f)      // Kick animation frames (rapide)
     , useSprites(false)
     , facingDirection(0)  // 0 = face caméra, 1 = droite, -1 = gauche
     , isRunning(false)
@@ -34,7 +26,10 @@ Player::Player(float x, float y, CharacterType type)
     , jumpPressed(false)
     , isJumping(false)
     , jumpReleased(true)
+    , jumpHeld(false)
     , jumpsRemaining(1)
+    , lookUp(false)
+    , lookDown(false)
     , health(3)
     , maxHealth(3)
     , invincibleTimer(0.0f)
@@ -77,21 +72,16 @@ Player::Player(float x, float y, CharacterType type)
     shape.setOutlineColor(sf::Color::Black);
     shape.setOutlineThickness(2.0f);
     
-    loadIdleAnimation();
-    loadRunAnimation();
-    loadJumpAnimation();
-    loadDoubleJumpAnimation();
-    loadHurtAnimation();
-    loadDeathAnimation();
-    loadAbilityAnimation();
-    loadKickAnimation();
-    
+    initSprite();
     sprite.setPosition(position);
 }
 
 void Player::update(float dt) {
     if (useSprites) {
         updateAnimation(dt);
+    } else {
+        // No sprites (headless or missing assets): still track facing for attacks
+        facingDirection = computeFacingDirection();
     }
     
     if (hurtAnimationTimer > 0.0f) {
@@ -204,13 +194,12 @@ void Player::update(float dt) {
         isJumping = false;
     }
 
-    const InputBindings& bindings = InputConfig::getInstance().getBindings();
-    if (!sf::Keyboard::isKeyPressed(bindings.jump)) {
+    if (!jumpHeld) {
         jumpReleased = true;
     }
 }
 
-void Player::draw(sf::RenderWindow& window) {
+void Player::submit(RenderQueue& queue, const sf::Vector2f& offset) {
     // Flicker effect when invincible (blink every 0.1 seconds)
     if (invincibleTimer > 0.0f) {
         int flicker = static_cast<int>(invincibleTimer * 10) % 2;
@@ -220,10 +209,10 @@ void Player::draw(sf::RenderWindow& window) {
     }
     
     // Draw sprite if available, otherwise fallback to rectangle
-    if (useSprites && !currentAnimationTextures.empty()) {
-        window.draw(sprite);
+    if (useSprites && sprite.hasFrame()) {
+        sprite.submit(queue, RenderLayer::Player, offset);
     } else {
-        window.draw(shape);
+        queue.submit(RenderLayer::Player, shape, offset);
     }
 }
 
@@ -376,26 +365,14 @@ void Player::die() {
         
         // Reset animation state to trigger death animation
         currentAnimationState = AnimationState::Death;
-        currentAnimationFrame = 0;
-        animationTimer = 0.0f;
-        
-        // Load death textures based on current facing direction (for all characters)
+        sprite.resetTimer();
+
+        // Death clip for the current facing direction (for all characters)
         if (useSprites) {
-            const std::vector<sf::Texture*>* deathTextures = nullptr;
-            
-            if (facingDirection == 2 && !deathTexturesNorth.empty()) {
-                deathTextures = &deathTexturesNorth;
-            } else if (facingDirection == 1 && !deathTexturesEast.empty()) {
-                deathTextures = &deathTexturesEast;
-            } else if (facingDirection == -1 && !deathTexturesWest.empty()) {
-                deathTextures = &deathTexturesWest;
-            } else if (!deathTexturesSouth.empty()) {
-                deathTextures = &deathTexturesSouth;
-            }
-            
-            if (deathTextures && !deathTextures->empty()) {
-                currentAnimationTextures = *deathTextures;
-                sprite.setTexture(*currentAnimationTextures[0]);
+            if (const AnimationClip* deathClip = findClip(AnimationState::Death)) {
+                sprite.play(deathClip);
+            } else {
+                sprite.setFrame(0);
             }
         }
     }
@@ -414,8 +391,7 @@ void Player::respawn() {
     invincibleTimer = 0.0f; // Reset invincibility
     hurtAnimationTimer = 0.0f; // Reset hurt animation
     currentAnimationState = AnimationState::Idle; // Reset animation state
-    currentAnimationFrame = 0; // Reset animation frame
-    animationTimer = 0.0f; // Reset animation timer
+    sprite.resetTimer(); // Reset animation timer
     shape.setPosition(position);
     
     // Reset color based on character type
@@ -432,9 +408,8 @@ void Player::respawn() {
     }
     
     // Reset sprite to idle if using sprites
-    if (useSprites && !idleTexturesSouth.empty()) {
-        currentAnimationTextures = idleTexturesSouth;
-        sprite.setTexture(*currentAnimationTextures[0]);
+    if (useSprites) {
+        sprite.play(&getClips(characterType)[static_cast<std::size_t>(AnimationState::Idle)][0]);
     }
 }
 
@@ -656,446 +631,124 @@ void Player::useBerserk() {
     abilityCooldownRemaining = abilityCooldown;
 }
 
-void Player::loadIdleAnimation() {
-    auto& spriteManager = SpriteManager::getInstance();
-    
-    // Load idle animation per character
-    if (characterType == CharacterType::Lyra) {
-        idleTexturesSouth.clear();
-        idleTexturesNorth.clear();
-        idleTexturesEast.clear();
-        idleTexturesWest.clear();
-        
-        // Helper lambda to load frames for a direction
-        auto loadDirection = [&](const std::string& direction, std::vector<sf::Texture*>& textures) {
-            for (int i = 0; i < 4; i++) {
-                std::string frameNum = (i < 10 ? "00" : (i < 100 ? "0" : "")) + std::to_string(i);
-                std::string id = "lyra_idle_" + direction + "_" + std::to_string(i);
-                std::string filepath = "assets/sprites/lyra_pixellab/animations/breathing-idle/" + direction + "/frame_" + frameNum + ".png";
-                
-                if (spriteManager.loadTexture(id, filepath)) {
-                    sf::Texture* tex = spriteManager.getTexture(id);
-                    if (tex) {
-                        textures.push_back(tex);
-                    }
-                }
-            }
-        };
-        
-        // Load all 4 directions
-        loadDirection("south", idleTexturesSouth);
-        loadDirection("north", idleTexturesNorth);
-        loadDirection("east", idleTexturesEast);
-        loadDirection("west", idleTexturesWest);
-        
-        // If we loaded at least one frame, use sprites
-        if (!idleTexturesSouth.empty()) {
-            useSprites = true;
-            currentAnimationTextures = idleTexturesSouth; // Default to south (face camera)
-            sprite.setTexture(*currentAnimationTextures[0]);
-            
-            // Scale sprite to make it visible (2x = 96x128, 3x = 144x192)
-            float spriteScale = 2.0f;
-            sprite.setScale(spriteScale, spriteScale);
-            
-            // Set origin to bottom-center so feet align with hitbox bottom
-            // Sprite canvas is 64x64px, but character is only ~38px tall, centered vertically
-            sprite.setOrigin(32.0f, 51.0f); // Center X, feet Y position
-        }
-    }
-    else if (characterType == CharacterType::Noah) {
-        idleTexturesSouth.clear();
-        idleTexturesNorth.clear();
-        idleTexturesEast.clear();
-        idleTexturesWest.clear();
-
-        auto& sm = spriteManager;
-        auto loadDirection = [&](const std::string& direction, std::vector<sf::Texture*>& textures) {
-            // Try up to 8 frames; stop when a frame is missing
-            for (int i = 0; i < 8; i++) {
-                std::string frameNum = (i < 10 ? "00" : (i < 100 ? "0" : "")) + std::to_string(i);
-                std::string id = "noah_idle_" + direction + "_" + std::to_string(i);
-                // Expected path for Noah v2 breathing-idle
-                std::string filepath = "assets/sprites/noah_pixellab/animations/breathing-idle/" + direction + "/frame_" + frameNum + ".png";
-                if (sm.loadTexture(id, filepath)) {
-                    if (auto* tex = sm.getTexture(id)) {
-                        textures.push_back(tex);
-                    }
-                } else {
-                    // stop at first missing frame for this direction
-                    break;
-                }
-            }
-        };
-
-        loadDirection("south", idleTexturesSouth);
-        loadDirection("north", idleTexturesNorth);
-        loadDirection("east", idleTexturesEast);
-        loadDirection("west", idleTexturesWest);
-
-        if (!idleTexturesSouth.empty()) {
-            useSprites = true;
-            currentAnimationTextures = idleTexturesSouth;
-            sprite.setTexture(*currentAnimationTextures[0]);
-            // Slightly smaller than Lyra (~-6%)
-            float spriteScale = 2.0f * 0.94f;
-            sprite.setScale(spriteScale, spriteScale);
-            sprite.setOrigin(24.0f, 42.0f);
+namespace {
+    // Same order as the ClipTable direction index
+    const char* const DIRECTION_NAMES[] = {"south", "north", "east", "west"};
+
+    const char* characterId(CharacterType type) {
+        switch (type) {
+            case CharacterType::Lyra: return "lyra";
+            case CharacterType::Noah: return "noah";
+            case CharacterType::Sera: return "sera";
         }
+        return "";
     }
 }
 
-void Player::loadRunAnimation() {
+const Player::ClipTable& Player::getClips(CharacterType type) {
+    // One clip per row: frames live in <folder>/<direction>/frame_NNN.png
+    struct ClipSpec {
+        CharacterType character;
+        AnimationState state;
+        const char* id;            // Sprite id prefix: <character>_<id>_<direction>_<i>
+        const char* folder;
+        int maxFrames;
+        float frameDuration;
+        bool stopAtMissingFrame;   // false: skip the missing frame and keep going
+    };
+    using S = AnimationState;
+    static const ClipSpec specs[] = {
+        // Idle ~7.5 FPS, run ~12 FPS, death un peu plus lent pour bien lire l'anim, kick rapide
+        {CharacterType::Lyra, S::Idle, "idle", "assets/sprites/lyra_pixellab/animations/breathing-idle", 4, 0.133f, false},
+        {CharacterType::Lyra, S::Run, "run", "assets/sprites/lyra_pixellab/animations/running-4-frames", 4, 0.083f, false},
+        {CharacterType::Lyra, S::Jump, "jump", "assets/sprites/lyra_pixellab/animations/jumping-1", 9, 0.1f, false},
+        {CharacterType::Lyra, S::DoubleJump, "doublejump", "assets/sprites/lyra_pixellab/animations/two-footed-jump", 7, 0.1f, false},
+        {CharacterType::Lyra, S::Hurt, "hurt", "assets/sprites/lyra_pixellab/animations/taking-punch", 6, 0.1f, true},
+        {CharacterType::Lyra, S::Death, "death", "assets/sprites/lyra_pixellab/animations/falling-back-death", 7, 0.15f, false},
+        {CharacterType::Lyra, S::Ability, "ability", "assets/sprites/lyra_pixellab/animations/fireball", 6, 0.1f, false},
+        {CharacterType::Lyra, S::Attack, "kick", "assets/sprites/lyra_pixellab/animations/high-kick", 7, 0.08f, true},
+        {CharacterType::Noah, S::Idle, "idle", "assets/sprites/noah_pixellab/animations/breathing-idle", 8, 0.133f, true},
+        {CharacterType::Noah, S::Run, "run", "assets/sprites/noah_pixellab/animations/running-6-frames", 6, 0.083f, true},
+        {CharacterType::Noah, S::Jump, "jump", "assets/sprites/noah_pixellab/animations/jumping-1", 9, 0.1f, true},
+        {CharacterType::Noah, S::Hurt, "hurt", "assets/sprites/noah_pixellab/animations/taking-punch", 6, 0.1f, true},
+        {CharacterType::Noah, S::Death, "death", "assets/sprites/noah_pixellab/animations/falling-back-death", 7, 0.15f, true},
+    };
+
+    static std::array<std::unique_ptr<ClipTable>, 3> tables;
+    std::unique_ptr<ClipTable>& table = tables[static_cast<std::size_t>(type)];
+    if (table) {
+        return *table;
+    }
+
+    table = std::make_unique<ClipTable>();
     auto& spriteManager = SpriteManager::getInstance();
-    
-    // Load run animation per character
-    if (characterType == CharacterType::Lyra) {
-        runTexturesSouth.clear();
-        runTexturesNorth.clear();
-        runTexturesEast.clear();
-        runTexturesWest.clear();
-        
-        // Helper lambda to load frames for a direction
-        auto loadDirection = [&](const std::string& direction, std::vector<sf::Texture*>& textures) {
-            for (int i = 0; i < 4; i++) {
-                std::string frameNum = (i < 10 ? "00" : (i < 100 ? "0" : "")) + std::to_string(i);
-                std::string id = "lyra_run_" + direction + "_" + std::to_string(i);
-                std::string filepath = "assets/sprites/lyra_pixellab/animations/running-4-frames/" + direction + "/frame_" + frameNum + ".png";
-                
-                if (spriteManager.loadTexture(id, filepath)) {
-                    sf::Texture* tex = spriteManager.getTexture(id);
-                    if (tex) {
-                        textures.push_back(tex);
-                    }
-                }
-            }
-        };
-        
-        // Load all 4 directions
-        loadDirection("south", runTexturesSouth);
-        loadDirection("north", runTexturesNorth);
-        loadDirection("east", runTexturesEast);
-        loadDirection("west", runTexturesWest);
-    }
-    else if (characterType == CharacterType::Noah) {
-        runTexturesSouth.clear();
-        runTexturesNorth.clear();
-        runTexturesEast.clear();
-        runTexturesWest.clear();
-        
-        auto loadDirection = [&](const std::string& direction, std::vector<sf::Texture*>& textures) {
-            // running-6-frames has 6 frames
-            for (int i = 0; i < 6; i++) {
-                std::string frameNum = (i < 10 ? "00" : (i < 100 ? "0" : "")) + std::to_string(i);
-                std::string id = "noah_run_" + direction + "_" + std::to_string(i);
-                std::string filepath = "assets/sprites/noah_pixellab/animations/running-6-frames/" + direction + "/frame_" + frameNum + ".png";
-                if (spriteManager.loadTexture(id, filepath)) {
-                    if (auto* tex = spriteManager.getTexture(id)) {
-                        textures.push_back(tex);
-                    }
-                } else {
-                    break;
-                }
-            }
-        };
-        loadDirection("south", runTexturesSouth);
-        loadDirection("north", runTexturesNorth);
-        loadDirection("east", runTexturesEast);
-        loadDirection("west", runTexturesWest);
-    }
-}
+    for (const ClipSpec& spec : specs) {
+        if (spec.character != type) continue;
 
-void Player::loadJumpAnimation() {
-    auto& spriteManager = SpriteManager::getInstance();
-    
-    // Load jump animation per character
-    if (characterType == CharacterType::Lyra) {
-        jumpTexturesSouth.clear();
-        jumpTexturesNorth.clear();
-        jumpTexturesEast.clear();
-        jumpTexturesWest.clear();
-        
-        // Helper lambda to load frames for a direction
-        auto loadDirection = [&](const std::string& direction, std::vector<sf::Texture*>& textures) {
-            // jumping-1 has 9 frames (frame_000 to frame_008)
-            for (int i = 0; i < 9; i++) {
-                std::string frameNum = (i < 10 ? "00" : (i < 100 ? "0" : "")) + std::to_string(i);
-                std::string id = "lyra_jump_" + direction + "_" + std::to_string(i);
-                std::string filepath = "assets/sprites/lyra_pixellab/animations/jumping-1/" + direction + "/frame_" + frameNum + ".png";
-                
-                if (spriteManager.loadTexture(id, filepath)) {
-                    sf::Texture* tex = spriteManager.getTexture(id);
-                    if (tex) {
-                        textures.push_back(tex);
-                    }
-                }
-            }
-        };
-        
-        // Load all 4 directions
-        loadDirection("south", jumpTexturesSouth);
-        loadDirection("north", jumpTexturesNorth);
-        loadDirection("east", jumpTexturesEast);
-        loadDirection("west", jumpTexturesWest);
-    }
-    else if (characterType == CharacterType::Noah) {
-        jumpTexturesSouth.clear();
-        jumpTexturesNorth.clear();
-        jumpTexturesEast.clear();
-        jumpTexturesWest.clear();
-        
-        auto loadDirection = [&](const std::string& direction, std::vector<sf::Texture*>& textures) {
-            // jumping-1 has up to 9 frames
-            for (int i = 0; i < 9; i++) {
-                std::string frameNum = (i < 10 ? "00" : (i < 100 ? "0" : "")) + std::to_string(i);
-                std::string id = "noah_jump_" + direction + "_" + std::to_string(i);
-                std::string filepath = "assets/sprites/noah_pixellab/animations/jumping-1/" + direction + "/frame_" + frameNum + ".png";
-                if (spriteManager.loadTexture(id, filepath)) {
-                    if (auto* tex = spriteManager.getTexture(id)) {
-                        textures.push_back(tex);
-                    }
-                } else {
-                    break;
-                }
-            }
-        };
-        loadDirection("south", jumpTexturesSouth);
-        loadDirection("north", jumpTexturesNorth);
-        loadDirection("east", jumpTexturesEast);
-        loadDirection("west", jumpTexturesWest);
-    }
-}
+        for (std::size_t direction = 0; direction < DIRECTION_COUNT; ++direction) {
+            AnimationClip& clip = (*table)[static_cast<std::size_t>(spec.state)][direction];
+            clip.frameDuration = spec.frameDuration;
+            clip.loop = spec.state != S::Death;   // Death: play once, stay on last frame
 
-void Player::loadDoubleJumpAnimation() {
-    auto& spriteManager = SpriteManager::getInstance();
-    
-    // Load double jump animation for Lyra only for now
-    if (characterType == CharacterType::Lyra) {
-        doubleJumpTexturesSouth.clear();
-        doubleJumpTexturesNorth.clear();
-        doubleJumpTexturesEast.clear();
-        doubleJumpTexturesWest.clear();
-        
-        // Helper lambda to load frames for a direction
-        auto loadDirection = [&](const std::string& direction, std::vector<sf::Texture*>& textures) {
-            // two-footed-jump has 7 frames (frame_000 to frame_006)
-            for (int i = 0; i < 7; i++) {
+            const std::string directionName = DIRECTION_NAMES[direction];
+            for (int i = 0; i < spec.maxFrames; i++) {
                 std::string frameNum = (i < 10 ? "00" : (i < 100 ? "0" : "")) + std::to_string(i);
-                std::string id = "lyra_doublejump_" + direction + "_" + std::to_string(i);
-                std::string filepath = "assets/sprites/lyra_pixellab/animations/two-footed-jump/" + direction + "/frame_" + frameNum + ".png";
-                
-                if (spriteManager.loadTexture(id, filepath)) {
-                    sf::Texture* tex = spriteManager.getTexture(id);
-                    if (tex) {
-                        textures.push_back(tex);
-                    }
-                }
-            }
-        };
-        
-        // Load all 4 directions
-        loadDirection("south", doubleJumpTexturesSouth);
-        loadDirection("north", doubleJumpTexturesNorth);
-        loadDirection("east", doubleJumpTexturesEast);
-        loadDirection("west", doubleJumpTexturesWest);
-    }
-}
+                std::string id = std::string(characterId(type)) + "_" + spec.id + "_" + directionName + "_" + std::to_string(i);
+                std::string filepath = std::string(spec.folder) + "/" + directionName + "/frame_" + frameNum + ".png";
 
-void Player::loadHurtAnimation() {
-    auto& spriteManager = SpriteManager::getInstance();
-    
-    // Load hurt animation per character
-    if (characterType == CharacterType::Lyra) {
-        hurtTexturesSouth.clear();
-        hurtTexturesNorth.clear();
-        hurtTexturesEast.clear();
-        hurtTexturesWest.clear();
-        
-        // Helper lambda to load frames for a direction
-        auto loadDirection = [&](const std::string& direction, std::vector<sf::Texture*>& textures) {
-            // taking-punch has 6 frames (frame_000 to frame_005)
-            for (int i = 0; i < 6; i++) {
-                std::string frameNum = (i < 10 ? "00" : (i < 100 ? "0" : "")) + std::to_string(i);
-                std::string id = "lyra_hurt_" + direction + "_" + std::to_string(i);
-                std::string filepath = "assets/sprites/lyra_pixellab/animations/taking-punch/" + direction + "/frame_" + frameNum + ".png";
-                
-                if (spriteManager.loadTexture(id, filepath)) {
-                    sf::Texture* tex = spriteManager.getTexture(id);
-                    if (tex) {
-                        textures.push_back(tex);
-                    }
-                } else {
-                    // If frame doesn't exist, stop loading (likely end of animation)
-                    break;
-                }
-            }
-        };
-        
-        // Load all 4 directions
-        loadDirection("south", hurtTexturesSouth);
-        loadDirection("north", hurtTexturesNorth);
-        loadDirection("east", hurtTexturesEast);
-        loadDirection("west", hurtTexturesWest);
-    }
-    else if (characterType == CharacterType::Noah) {
-        hurtTexturesSouth.clear();
-        hurtTexturesNorth.clear();
-        hurtTexturesEast.clear();
-        hurtTexturesWest.clear();
-        
-        auto loadDirection = [&](const std::string& direction, std::vector<sf::Texture*>& textures) {
-            // taking-punch up to 6 frames
-            for (int i = 0; i < 6; i++) {
-                std::string frameNum = (i < 10 ? "00" : (i < 100 ? "0" : "")) + std::to_string(i);
-                std::string id = "noah_hurt_" + direction + "_" + std::to_string(i);
-                std::string filepath = "assets/sprites/noah_pixellab/animations/taking-punch/" + direction + "/frame_" + frameNum + ".png";
-                if (spriteManager.loadTexture(id, filepath)) {
-                    if (auto* tex = spriteManager.getTexture(id)) {
-                        textures.push_back(tex);
-                    }
-                } else {
+                if (spriteManager.loadFrame(id, filepath)) {
+                    clip.frames.push_back(spriteManager.getFrame(id));
+                } else if (spec.stopAtMissingFrame) {
                     break;
                 }
             }
-        };
-        loadDirection("south", hurtTexturesSouth);
-        loadDirection("north", hurtTexturesNorth);
-        loadDirection("east", hurtTexturesEast);
-        loadDirection("west", hurtTexturesWest);
+        }
     }
+    return *table;
 }
 
-void Player::loadDeathAnimation() {
-    auto& spriteManager = SpriteManager::getInstance();
-    
-    // Load death animation per character
-    if (characterType == CharacterType::Lyra) {
-        deathTexturesSouth.clear();
-        deathTexturesNorth.clear();
-        deathTexturesEast.clear();
-        deathTexturesWest.clear();
-        
-        // Helper lambda to load frames for a direction
-        auto loadDirection = [&](const std::string& direction, std::vector<sf::Texture*>& textures) {
-            // falling-back-death has 7 frames (frame_000 to frame_006)
-            for (int i = 0; i < 7; i++) {
-                std::string frameNum = (i < 10 ? "00" : (i < 100 ? "0" : "")) + std::to_string(i);
-                std::string id = "lyra_death_" + direction + "_" + std::to_string(i);
-                std::string filepath = "assets/sprites/lyra_pixellab/animations/falling-back-death/" + direction + "/frame_" + frameNum + ".png";
-                
-                if (spriteManager.loadTexture(id, filepath)) {
-                    sf::Texture* tex = spriteManager.getTexture(id);
-                    if (tex) {
-                        textures.push_back(tex);
-                    }
-                }
-            }
-        };
-        
-        // Load all 4 directions
-        loadDirection("south", deathTexturesSouth);
-        loadDirection("north", deathTexturesNorth);
-        loadDirection("east", deathTexturesEast);
-        loadDirection("west", deathTexturesWest);
-    }
-    else if (characterType == CharacterType::Noah) {
-        deathTexturesSouth.clear();
-        deathTexturesNorth.clear();
-        deathTexturesEast.clear();
-        deathTexturesWest.clear();
-        
-        auto loadDirection = [&](const std::string& direction, std::vector<sf::Texture*>& textures) {
-            // falling-back-death up to 7 frames
-            for (int i = 0; i < 7; i++) {
-                std::string frameNum = (i < 10 ? "00" : (i < 100 ? "0" : "")) + std::to_string(i);
-                std::string id = "noah_death_" + direction + "_" + std::to_string(i);
-                std::string filepath = "assets/sprites/noah_pixellab/animations/falling-back-death/" + direction + "/frame_" + frameNum + ".png";
-                if (spriteManager.loadTexture(id, filepath)) {
-                    if (auto* tex = spriteManager.getTexture(id)) {
-                        textures.push_back(tex);
-                    }
-                } else {
-                    break;
-                }
-            }
-        };
-        loadDirection("south", deathTexturesSouth);
-        loadDirection("north", deathTexturesNorth);
-        loadDirection("east", deathTexturesEast);
-        loadDirection("west", deathTexturesWest);
+void Player::initSprite() {
+    const AnimationClip& idleSouth = getClips(characterType)[static_cast<std::size_t>(AnimationState::Idle)][0];
+
+    // If we loaded at least one idle frame, use sprites
+    if (idleSouth.empty()) {
+        return;
     }
-}
+    useSprites = true;
+    sprite.play(&idleSouth); // Default to south (face camera)
 
-void Player::loadAbilityAnimation() {
-    auto& spriteManager = SpriteManager::getInstance();
-    
-    // Load ability animation (Kinetic Wave) for Lyra only for now
     if (characterType == CharacterType::Lyra) {
-        abilityTexturesSouth.clear();
-        abilityTexturesNorth.clear();
-        abilityTexturesEast.clear();
-        abilityTexturesWest.clear();
-        
-        // Helper lambda to load frames for a direction
-        auto loadDirection = [&](const std::string& direction, std::vector<sf::Texture*>& textures) {
-            // fireball has 6 frames (frame_000 to frame_005)
-            for (int i = 0; i < 6; i++) {
-                std::string frameNum = (i < 10 ? "00" : (i < 100 ? "0" : "")) + std::to_string(i);
-                std::string id = "lyra_ability_" + direction + "_" + std::to_string(i);
-                std::string filepath = "assets/sprites/lyra_pixellab/animations/fireball/" + direction + "/frame_" + frameNum + ".png";
-                
-                if (spriteManager.loadTexture(id, filepath)) {
-                    sf::Texture* tex = spriteManager.getTexture(id);
-                    if (tex) {
-                        textures.push_back(tex);
-                    }
-                }
-            }
-        };
-        
-        // Load all 4 directions
-        loadDirection("south", abilityTexturesSouth);
-        loadDirection("north", abilityTexturesNorth);
-        loadDirection("east", abilityTexturesEast);
-        loadDirection("west", abilityTexturesWest);
+        // Scale sprite to make it visible (2x = 96x128, 3x = 144x192)
+        float spriteScale = 2.0f;
+        sprite.setScale(spriteScale, spriteScale);
+
+        // Set origin to bottom-center so feet align with hitbox bottom
+        // Sprite canvas is 64x64px, but character is only ~38px tall, centered vertically
+        sprite.setOrigin(32.0f, 51.0f); // Center X, feet Y position
+    } else if (characterType == CharacterType::Noah) {
+        // Slightly smaller than Lyra (~-6%)
+        float spriteScale = 2.0f * 0.94f;
+        sprite.setScale(spriteScale, spriteScale);
+        sprite.setOrigin(24.0f, 42.0f);
     }
 }
 
-void Player::loadKickAnimation() {
-    auto& spriteManager = SpriteManager::getInstance();
-    
-    if (characterType == CharacterType::Lyra) {
-        kickTexturesSouth.clear();
-        kickTexturesNorth.clear();
-        kickTexturesEast.clear();
-        kickTexturesWest.clear();
-        
-        auto loadDirection = [&](const std::string& direction, std::vector<sf::Texture*>& textures) {
-            for (int i = 0; i < 7; i++) {
-                std::string frameNum = (i < 10 ? "00" : (i < 100 ? "0" : "")) + std::to_string(i);
-                std::string id = "lyra_kick_" + direction + "_" + std::to_string(i);
-                std::string filepath = "assets/sprites/lyra_pixellab/animations/high-kick/" + direction + "/frame_" + frameNum + ".png";
-                
-                if (spriteManager.loadTexture(id, filepath)) {
-                    sf::Texture* tex = spriteManager.getTexture(id);
-                    if (tex) {
-                        textures.push_back(tex);
-                    }
-                } else {
-                    break;
-                }
-            }
-        };
-        
-        loadDirection("south", kickTexturesSouth);
-        loadDirection("north", kickTexturesNorth);
-        loadDirection("east", kickTexturesEast);
-        loadDirection("west", kickTexturesWest);
-    }
+const AnimationClip* Player::findClip(AnimationState state) const {
+    const auto& directions = getClips(characterType)[static_cast<std::size_t>(state)];
+
+    // facingDirection: 0 = south, 2 = north, 1 = east, -1 = west
+    std::size_t direction = 0;
+    if (facingDirection == 2) direction = 1;
+    else if (facingDirection == 1) direction = 2;
+    else if (facingDirection == -1) direction = 3;
+
+    if (!directions[direction].empty()) return &directions[direction];
+    if (!directions[0].empty()) return &directions[0];
+    return nullptr;
 }
 
 void Player::updateAnimation(float dt) {
-    if (currentAnimationTextures.empty()) {
+    if (!sprite.hasFrame()) {
         return;
     }
     
@@ -1136,10 +789,47 @@ void Player::updateAnimation(float dt) {
     // If neither condition is met, keep current state (transition state)
     
     // Update facing direction based on movement and input
-    int newFacingDirection = facingDirection; // Keep last direction by default
+    int newFacingDirection = computeFacingDirection();
     
-    // Get input bindings for keys
-    const InputBindings& bindings = InputConfig::getInstance().getBindings();
+    // Switch direction or animation state if changed
+    if (newFacingDirection != facingDirection || newState != currentAnimationState) {
+        facingDirection = newFacingDirection;
+        currentAnimationState = newState;
+
+        // Restart on the clip of the new state and direction (keep the current one if it has none)
+        if (const AnimationClip* clip = findClip(currentAnimationState)) {
+            sprite.play(clip);
+        } else {
+            sprite.setFrame(0);
+        }
+    }
+
+    // Jump animations: sync frame with velocity (height), not with time
+    if ((currentAnimationState == AnimationState::Jump || currentAnimationState == AnimationState::DoubleJump) && !isGrounded) {
+        int totalFrames = sprite.getClip()->size();
+
+        // Map velocity to frame:
+        // High negative (ascending) -> early frames (0-2)
+        // Near 0 (apex) -> middle frames (3-5)
+        // High positive (descending) -> late frames (6-8)
+        float normalizedVelocity = (velocity.y + 500.0f) / 1000.0f; // Normalize between -500 (max up) and 500 (max down)
+        normalizedVelocity = std::max(0.0f, std::min(1.0f, normalizedVelocity)); // Clamp 0-1
+
+        // Invert: high negative (going up) should be early frames
+        float frameProgress = 1.0f - normalizedVelocity;
+
+        int newFrame = static_cast<int>(frameProgress * (totalFrames - 1));
+        if (newFrame != sprite.getFrame()) {
+            sprite.setFrame(newFrame);
+        }
+    } else {
+        // Everything else runs on the clip timing (death plays once and stays on its last frame)
+        sprite.update(dt);
+    }
+}
+
+int Player::computeFacingDirection() const {
+    int newFacingDirection = facingDirection; // Keep last direction by default
     
     // Check horizontal input (gauche/droite) - priority when moving
     if (velocity.x > 0.1f) {
@@ -1149,183 +839,12 @@ void Player::updateAnimation(float dt) {
     }
     // Check vertical input (haut/bas) - only when not moving horizontally and on ground
     else if (isGrounded) {
-        if (sf::Keyboard::isKeyPressed(sf::Keyboard::Up) || 
-            sf::Keyboard::isKeyPressed(bindings.menuUp)) {
+        if (lookUp) {
             newFacingDirection = 2;  // North (dos/haut)
-        } else if (sf::Keyboard::isKeyPressed(sf::Keyboard::Down) || 
-                   sf::Keyboard::isKeyPressed(bindings.menuDown)) {
+        } else if (lookDown) {
             newFacingDirection = 0;  // South (face/bas)
         }
     }
     
-    // Switch direction or animation state if changed
-    if (newFacingDirection != facingDirection || newState != currentAnimationState) {
-        facingDirection = newFacingDirection;
-        currentAnimationState = newState;
-        currentAnimationFrame = 0; // Reset to first frame when changing direction or animation
-        
-        // Update current textures based on state and direction
-        const std::vector<sf::Texture*>* texturesToUse = nullptr;
-        
-        // Helper lambda to get textures for a direction
-        auto getDirectionTextures = [&](const std::vector<sf::Texture*>& south, 
-                                        const std::vector<sf::Texture*>& north,
-                                        const std::vector<sf::Texture*>& east,
-                                        const std::vector<sf::Texture*>& west) -> const std::vector<sf::Texture*>* {
-            if (facingDirection == 2 && !north.empty()) return &north;
-            else if (facingDirection == 1 && !east.empty()) return &east;
-            else if (facingDirection == -1 && !west.empty()) return &west;
-            else if (!south.empty()) return &south;
-            return nullptr;
-        };
-        
-        // Select textures based on animation state
-        switch (currentAnimationState) {
-            case AnimationState::Death:
-                texturesToUse = getDirectionTextures(deathTexturesSouth, deathTexturesNorth,
-                                                     deathTexturesEast, deathTexturesWest);
-                break;
-            case AnimationState::Attack:
-                texturesToUse = getDirectionTextures(kickTexturesSouth, kickTexturesNorth,
-                                                     kickTexturesEast, kickTexturesWest);
-                break;
-            case AnimationState::Ability:
-                texturesToUse = getDirectionTextures(abilityTexturesSouth, abilityTexturesNorth,
-                                                     abilityTexturesEast, abilityTexturesWest);
-                break;
-            case AnimationState::Hurt:
-                texturesToUse = getDirectionTextures(hurtTexturesSouth, hurtTexturesNorth,
-                                                     hurtTexturesEast, hurtTexturesWest);
-                break;
-            case AnimationState::Jump:
-                texturesToUse = getDirectionTextures(jumpTexturesSouth, jumpTexturesNorth, 
-                                                     jumpTexturesEast, jumpTexturesWest);
-                break;
-            case AnimationState::DoubleJump:
-                texturesToUse = getDirectionTextures(doubleJumpTexturesSouth, doubleJumpTexturesNorth,
-                                                     doubleJumpTexturesEast, doubleJumpTexturesWest);
-                break;
-            case AnimationState::Run:
-                texturesToUse = getDirectionTextures(runTexturesSouth, runTexturesNorth,
-                                                     runTexturesEast, runTexturesWest);
-                break;
-            case AnimationState::Idle:
-            default:
-                texturesToUse = getDirectionTextures(idleTexturesSouth, idleTexturesNorth,
-                                                     idleTexturesEast, idleTexturesWest);
-                break;
-        }
-        
-        if (texturesToUse && !texturesToUse->empty()) {
-            currentAnimationTextures = *texturesToUse;
-            sprite.setTexture(*currentAnimationTextures[0]);
-        }
-    }
-    
-    // Update animation based on state
-    // Death animation: play once, stay on last frame
-    if (currentAnimationState == AnimationState::Death) {
-        if (!currentAnimationTextures.empty()) {
-            animationTimer += dt;
-            
-            // Play death animation once, then stay on last frame
-            if (animationTimer >= deathFrameDuration) {
-                animationTimer -= deathFrameDuration;
-                if (currentAnimationFrame < static_cast<int>(currentAnimationTextures.size()) - 1) {
-                    currentAnimationFrame++;
-                    sprite.setTexture(*currentAnimationTextures[currentAnimationFrame]);
-                }
-                // Otherwise, stay on last frame
-            }
-        }
-    }
-    // Attack animation: play once during attack timer
-    else if (currentAnimationState == AnimationState::Attack) {
-        if (!currentAnimationTextures.empty()) {
-            animationTimer += dt;
-            
-            // Play attack animation once, loop if timer still active
-            if (animationTimer >= kickFrameDuration) {
-                animationTimer -= kickFrameDuration;
-                currentAnimationFrame = (currentAnimationFrame + 1) % currentAnimationTextures.size();
-                sprite.setTexture(*currentAnimationTextures[currentAnimationFrame]);
-            }
-        }
-    }
-    // Ability animation: play once during ability timer
-    else if (currentAnimationState == AnimationState::Ability) {
-        if (!currentAnimationTextures.empty()) {
-            animationTimer += dt;
-            
-            // Play ability animation once, loop if timer still active
-            if (animationTimer >= abilityFrameDuration) {
-                animationTimer -= abilityFrameDuration;
-                currentAnimationFrame = (currentAnimationFrame + 1) % currentAnimationTextures.size();
-                sprite.setTexture(*currentAnimationTextures[currentAnimationFrame]);
-            }
-        }
-    }
-    // Hurt animation: play once during hurt timer
-    else if (currentAnimationState == AnimationState::Hurt) {
-        if (!currentAnimationTextures.empty()) {
-            animationTimer += dt;
-            
-            // Play hurt animation, loop if timer still active
-            if (animationTimer >= hurtFrameDuration) {
-                animationTimer -= hurtFrameDuration;
-                currentAnimationFrame = (currentAnimationFrame + 1) % currentAnimationTextures.size();
-                sprite.setTexture(*currentAnimationTextures[currentAnimationFrame]);
-            }
-        }
-    }
-    // Jump animations: sync with velocity (height)
-    else if ((currentAnimationState == AnimationState::Jump || currentAnimationState == AnimationState::DoubleJump) && !isGrounded) {
-        // For jump animations, sync frame with velocity.y (height of jump)
-        // Negative velocity = going up, positive = going down
-        if (!currentAnimationTextures.empty()) {
-            int totalFrames = static_cast<int>(currentAnimationTextures.size());
-            
-            // Map velocity to frame: 
-            // High negative (ascending) -> early frames (0-2)
-            // Near 0 (apex) -> middle frames (3-5)
-            // High positive (descending) -> late frames (6-8)
-            
-            float normalizedVelocity = (velocity.y + 500.0f) / 1000.0f; // Normalize between -500 (max up) and 500 (max down)
-            normalizedVelocity = std::max(0.0f, std::min(1.0f, normalizedVelocity)); // Clamp 0-1
-            
-            // Invert: high negative (going up) should be early frames
-            float frameProgress = 1.0f - normalizedVelocity;
-            
-            int newFrame = static_cast<int>(frameProgress * (totalFrames - 1));
-            newFrame = std::max(0, std::min(totalFrames - 1, newFrame));
-            
-            if (newFrame != currentAnimationFrame) {
-                currentAnimationFrame = newFrame;
-                sprite.setTexture(*currentAnimationTextures[currentAnimationFrame]);
-            }
-        }
-    } else {
-        // For idle/run, use normal frame-by-frame animation
-        float frameDuration;
-        switch (currentAnimationState) {
-            case AnimationState::Run:
-                frameDuration = runFrameDuration;
-                break;
-            case AnimationState::Idle:
-            default:
-                frameDuration = idleFrameDuration;
-                break;
-        }
-        
-        animationTimer += dt;
-        
-        // Check if we should advance to next frame
-        if (animationTimer >= frameDuration && !currentAnimationTextures.empty()) {
-            animationTimer -= frameDuration;
-            currentAnimationFrame = (currentAnimationFrame + 1) % currentAnimationTextures.size();
-            
-            // Update sprite texture
-            sprite.setTexture(*currentAnimationTextures[currentAnimationFrame]);
-        }
-    }
+    return newFacingDirection;
 }
@@ -1,4 +1,5 @@
 #include "entities/RotatingTrap.h"
+#include "graphics/RenderQueue.h"
 #include <cmath>
 #include <algorithm>
 
@@ -58,7 +59,7 @@ void RotatingTrap::update(float dt) {
     shape.setRotation(angle);
 }
 
-void RotatingTrap::draw(sf::RenderWindow& window) {
+void RotatingTrap::submit(RenderQueue& queue, const sf::Vector2f& offset) {
     // Draw base (pivot)
     sf::CircleShape pivotCircle(8.0f);
     pivotCircle.setOrigin(8.0f, 8.0f);
@@ -66,9 +67,9 @@ void RotatingTrap::draw(sf::RenderWindow& window) {
     pivotCircle.setFillColor(sf::Color(100, 100, 100));
     pivotCircle.setOutlineThickness(2.0f);
     pivotCircle.setOutlineColor(sf::Color::Black);
-    window.draw(pivotCircle);
+    queue.submit(RenderLayer::Enemies, pivotCircle, offset);
 
-    Enemy::draw(window);
+    Enemy::submit(queue, offset);
 }
 
 void RotatingTrap::updateShape() {
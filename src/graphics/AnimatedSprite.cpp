@@ -1,103 +1,70 @@
 #include "graphics/AnimatedSprite.h"
-#include "core/Logger.h"
+#include <algorithm>
 
 AnimatedSprite::AnimatedSprite()
-    : texture(nullptr)
-    , currentAnimation(nullptr)
-    , currentFrameIndex(0)
+    : clip(nullptr)
+    , frameIndex(0)
     , frameTimer(0.0f)
-    , playing(false)
-    , paused(false)
-    , finished(false)
 {}
 
-void AnimatedSprite::setTexture(sf::Texture* tex) {
-    texture = tex;
-    if (texture) {
-        sprite.setTexture(*texture);
-    }
-}
-
-void AnimatedSprite::addAnimation(const Animation& animation) {
-    animations[animation.name] = animation;
+void AnimatedSprite::play(const AnimationClip* newClip) {
+    clip = newClip;
+    frameIndex = 0;
+    applyFrame();
 }
 
-void AnimatedSprite::play(const std::string& animationName, bool forceRestart) {
-    // Check if animation exists
-    auto it = animations.find(animationName);
-    if (it == animations.end()) {
-        Logger::warning("Animation '" + animationName + "' not found");
-        return;
+bool AnimatedSprite::update(float dt) {
+    if (!hasFrame()) {
+        return false;
     }
 
-    // If same animation and already playing, don't restart unless forced
-    if (currentAnimationName == animationName && playing && !forceRestart) {
-        return;
+    frameTimer += dt;
+    if (frameTimer < clip->frameDuration) {
+        return false;
     }
-
-    // Set new animation
-    currentAnimationName = animationName;
-    currentAnimation = &it->second;
-    currentFrameIndex = 0;
-    frameTimer = 0.0f;
-    playing = true;
-    paused = false;
-    finished = false;
-
-    // Set first frame
-    if (!currentAnimation->frames.empty()) {
-        sprite.setTextureRect(currentAnimation->frames[0]);
+    frameTimer -= clip->frameDuration;
+
+    if (clip->loop) {
+        frameIndex = (frameIndex + 1) % clip->size();
+    } else if (frameIndex < clip->size() - 1) {
+        frameIndex++;
+    } else {
+        return false;   // Stay on last frame
     }
+
+    applyFrame();
+    return true;
 }
 
-void AnimatedSprite::stop() {
-    playing = false;
-    paused = false;
-    currentFrameIndex = 0;
-    frameTimer = 0.0f;
+void AnimatedSprite::setFrame(int index) {
+    if (!hasFrame()) {
+        return;
+    }
+    frameIndex = std::max(0, std::min(clip->size() - 1, index));
+    applyFrame();
 }
 
-void AnimatedSprite::pause() {
-    paused = true;
+bool AnimatedSprite::isFinished() const {
+    return hasFrame() && !clip->loop && frameIndex == clip->size() - 1;
 }
 
-void AnimatedSprite::resume() {
-    paused = false;
+void AnimatedSprite::submit(RenderQueue& queue, RenderLayer layer, const sf::Vector2f& offset) const {
+    if (hasFrame()) {
+        queue.submit(layer, sprite, offset);
+    }
 }
 
-void AnimatedSprite::update(float dt) {
-    if (!playing || paused || !currentAnimation || currentAnimation->frames.empty()) {
+void AnimatedSprite::applyFrame() {
+    if (!hasFrame()) {
         return;
     }
-
-    // Update timer
-    frameTimer += dt;
-
-    // Check if we should advance to next frame
-    if (frameTimer >= currentAnimation->frameDuration) {
-        frameTimer -= currentAnimation->frameDuration;
-        currentFrameIndex++;
-
-        // Check if animation finished
-        if (currentFrameIndex >= currentAnimation->frames.size()) {
-            if (currentAnimation->loop) {
-                // Loop back to start
-                currentFrameIndex = 0;
-            } else {
-                // Stay on last frame
-                currentFrameIndex = currentAnimation->frames.size() - 1;
-                finished = true;
-                playing = false;
-            }
-        }
-
-        // Update sprite texture rect
-        sprite.setTextureRect(currentAnimation->frames[currentFrameIndex]);
+    const SpriteFrame& frame = clip->frames[static_cast<std::size_t>(frameIndex)];
+    if (!frame.texture) {
+        return;
     }
-}
-
-void AnimatedSprite::draw(sf::RenderWindow& window) {
-    window.draw(sprite);
+    // Frames share atlas pages: rebinding is a no-op unless the page changes
+    sprite.setTexture(*frame.texture);
+    sprite.setTextureRect(frame.rect);
 }
 
 void AnimatedSprite::setPosition(float x, float y) {
@@ -116,39 +83,14 @@ void AnimatedSprite::setScale(float x, float y) {
     sprite.setScale(x, y);
 }
 
-void AnimatedSprite::setScale(const sf::Vector2f& scale) {
-    sprite.setScale(scale);
-}
-
 void AnimatedSprite::setOrigin(float x, float y) {
     sprite.setOrigin(x, y);
 }
 
-void AnimatedSprite::setOrigin(const sf::Vector2f& origin) {
-    sprite.setOrigin(origin);
-}
-
-void AnimatedSprite::setRotation(float angle) {
-    sprite.setRotation(angle);
-}
-
 void AnimatedSprite::setColor(const sf::Color& color) {
     sprite.setColor(color);
 }
 
-std::string AnimatedSprite::getCurrentAnimation() const {
-    return currentAnimationName;
-}
-
-bool AnimatedSprite::isFinished() const {
-    return finished;
-}
-
 sf::FloatRect AnimatedSprite::getGlobalBounds() const {
     return sprite.getGlobalBounds();
 }
-
-sf::FloatRect AnimatedSprite::getLocalBounds() const {
-    return sprite.getLocalBounds();
-}
-
@@ -0,0 +1,121 @@
+#include "graphics/BackgroundLayer.h"
+#include "world/LevelLoader.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+BackgroundLayer::BackgroundLayer(float tileSize, int chunkTiles)
+    : tileSize(tileSize)
+    , chunkTiles(chunkTiles)
+{
+}
+
+void BackgroundLayer::setBaseTile(const SpriteFrame& frame) {
+    baseTile = frame;
+}
+
+void BackgroundLayer::setVariant(const std::string& name, const SpriteFrame& frame) {
+    if (!frame.texture) {
+        variants.erase(name);
+        return;
+    }
+    variants[name] = frame;
+}
+
+void BackgroundLayer::clearTextures() {
+    baseTile = SpriteFrame();
+    variants.clear();
+}
+
+void BackgroundLayer::clear() {
+    chunks.clear();
+}
+
+void BackgroundLayer::build(const LevelData& level, const sf::FloatRect& area) {
+    clear();
+    if (!baseTile.texture || area.width <= 0.0f || area.height <= 0.0f) {
+        return;
+    }
+
+    // Variant zones resolved to frames once; unknown names are reported and skipped
+    struct VariantZone {
+        sf::FloatRect bounds;
+        SpriteFrame frame;
+    };
+    std::vector<VariantZone> zones;
+    for (const BackgroundTile& tile : level.backgroundTiles) {
+        auto it = variants.find(tile.tile);
+        if (it == variants.end()) {
+            std::cout << "Warning: unknown background tile '" << tile.tile << "'\n";
+            continue;
+        }
+        zones.push_back(VariantZone{sf::FloatRect(tile.x, tile.y, tile.width, tile.height), it->second});
+    }
+
+    const int startX = static_cast<int>(std::floor(area.left / tileSize));
+    const int startY = static_cast<int>(std::floor(area.top / tileSize));
+    const int endX = static_cast<int>(std::ceil((area.left + area.width) / tileSize));
+    const int endY = static_cast<int>(std::ceil((area.top + area.height) / tileSize));
+
+    for (int chunkY = startY; chunkY < endY; chunkY += chunkTiles) {
+        for (int chunkX = startX; chunkX < endX; chunkX += chunkTiles) {
+            Chunk chunk;
+            const int lastX = std::min(chunkX + chunkTiles, endX);
+            const int lastY = std::min(chunkY + chunkTiles, endY);
+            chunk.bounds = sf::FloatRect(chunkX * tileSize, chunkY * tileSize,
+                                         (lastX - chunkX) * tileSize, (lastY - chunkY) * tileSize);
+
+            for (int ty = chunkY; ty < lastY; ++ty) {
+                for (int tx = chunkX; tx < lastX; ++tx) {
+                    const float x = tx * tileSize;
+                    const float y = ty * tileSize;
+                    const sf::Vector2f center(x + tileSize * 0.5f, y + tileSize * 0.5f);
+
+                    // Last declared zone wins where zones overlap
+                    const SpriteFrame* frame = &baseTile;
+                    for (const VariantZone& zone : zones) {
+                        if (zone.bounds.contains(center)) {
+                            frame = &zone.frame;
+                        }
+                    }
+                    appendTile(chunk, *frame, x, y);
+                }
+            }
+            chunks.push_back(std::move(chunk));
+        }
+    }
+}
+
+void BackgroundLayer::appendTile(Chunk& chunk, const SpriteFrame& frame, float x, float y) {
+    const sf::Texture* texture = frame.texture;
+    auto it = std::find_if(chunk.batches.begin(), chunk.batches.end(),
+                           [texture](const Batch& batch) { return batch.texture == texture; });
+    if (it == chunk.batches.end()) {
+        chunk.batches.push_back(Batch{texture, sf::VertexArray(sf::Quads)});
+        it = chunk.batches.end() - 1;
+    }
+
+    const sf::IntRect& rect = frame.rect;
+    const float u0 = static_cast<float>(rect.left);
+    const float v0 = static_cast<float>(rect.top);
+    const float u1 = static_cast<float>(rect.left + rect.width);
+    const float v1 = static_cast<float>(rect.top + rect.height);
+
+    // Same texel-to-tile scaling the per-tile sprites used
+    it->vertices.append(sf::Vertex(sf::Vector2f(x, y), sf::Vector2f(u0, v0)));
+    it->vertices.append(sf::Vertex(sf::Vector2f(x + tileSize, y), sf::Vector2f(u1, v0)));
+    it->vertices.append(sf::Vertex(sf::Vector2f(x + tileSize, y + tileSize), sf::Vector2f(u1, v1)));
+    it->vertices.append(sf::Vertex(sf::Vector2f(x, y + tileSize), sf::Vector2f(u0, v1)));
+}
+
+void BackgroundLayer::draw(sf::RenderTarget& target) const {
+    const sf::View& view = target.getView();
+    const sf::FloatRect visible(view.getCenter() - view.getSize() / 2.0f, view.getSize());
+
+    for (const Chunk& chunk : chunks) {
+        if (!chunk.bounds.intersects(visible)) continue;
+        for (const Batch& batch : chunk.batches) {
+            target.draw(batch.vertices, sf::RenderStates(batch.texture));
+        }
+    }
+}
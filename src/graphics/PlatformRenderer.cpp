@@ -0,0 +1,152 @@
+#include "graphics/PlatformRenderer.h"
+#include "world/Platform.h"
+#include "physics/CellKey.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    sf::FloatRect unite(const sf::FloatRect& a, const sf::FloatRect& b) {
+        const float left = std::min(a.left, b.left);
+        const float top = std::min(a.top, b.top);
+        const float right = std::max(a.left + a.width, b.left + b.width);
+        const float bottom = std::max(a.top + a.height, b.top + b.height);
+        return sf::FloatRect(left, top, right - left, bottom - top);
+    }
+}
+
+PlatformRenderer::PlatformRenderer(float chunkSize)
+    : chunkSize(chunkSize)
+    , source(nullptr)
+    , sourceSize(0)
+    , lastDrawCalls(0)
+{
+}
+
+void PlatformRenderer::clear() {
+    chunks.clear();
+    chunkLookup.clear();
+    platformChunk.clear();
+    source = nullptr;
+    sourceSize = 0;
+}
+
+bool PlatformRenderer::isBuiltFor(const std::vector<std::unique_ptr<Platform>>& platforms) const {
+    return source == &platforms && sourceSize == platforms.size();
+}
+
+void PlatformRenderer::build(const std::vector<std::unique_ptr<Platform>>& platforms) {
+    clear();
+    source = &platforms;
+    sourceSize = platforms.size();
+
+    platformChunk.assign(platforms.size(), NONE);
+    for (std::size_t i = 0; i < platforms.size(); ++i) {
+        if (!platforms[i]) continue;
+        const std::size_t chunk = chunkFor(platforms[i]->getBounds());
+        chunks[chunk].members.push_back(i);   // Indices ascend: level order for free
+        platformChunk[i] = chunk;
+    }
+
+    for (Chunk& chunk : chunks) {
+        bake(chunk);
+    }
+}
+
+void PlatformRenderer::update(std::size_t index) {
+    if (!source || index >= platformChunk.size() || !(*source)[index]) {
+        return;
+    }
+
+    const std::size_t oldChunk = platformChunk[index];
+    const std::size_t newChunk = chunkFor((*source)[index]->getBounds());
+    if (oldChunk != newChunk) {
+        if (oldChunk != NONE) {
+            removeMember(oldChunk, index);
+        }
+        addMember(newChunk, index);
+        platformChunk[index] = newChunk;
+    }
+    chunks[newChunk].dirty = true;
+}
+
+std::size_t PlatformRenderer::chunkFor(const sf::FloatRect& bounds) {
+    const int cx = static_cast<int>(std::floor(bounds.left / chunkSize));
+    const int cy = static_cast<int>(std::floor(bounds.top / chunkSize));
+    const std::int64_t key = CellKey::pack(cx, cy);
+
+    auto it = chunkLookup.find(key);
+    if (it != chunkLookup.end()) {
+        return it->second;
+    }
+
+    chunks.push_back(Chunk{sf::FloatRect(), {}, {}, true});
+    chunkLookup.emplace(key, chunks.size() - 1);
+    return chunks.size() - 1;
+}
+
+void PlatformRenderer::removeMember(std::size_t chunk, std::size_t index) {
+    std::vector<std::size_t>& members = chunks[chunk].members;
+    auto it = std::lower_bound(members.begin(), members.end(), index);
+    if (it != members.end() && *it == index) {
+        members.erase(it);
+    }
+    chunks[chunk].dirty = true;
+}
+
+void PlatformRenderer::addMember(std::size_t chunk, std::size_t index) {
+    std::vector<std::size_t>& members = chunks[chunk].members;
+    members.insert(std::lower_bound(members.begin(), members.end(), index), index);
+    chunks[chunk].dirty = true;
+}
+
+void PlatformRenderer::bake(Chunk& chunk) {
+    // Keep the arrays' storage: a dragged platform re-bakes its chunk every frame
+    for (Batch& batch : chunk.batches) {
+        batch.vertices.clear();
+    }
+
+    bool first = true;
+    for (std::size_t index : chunk.members) {
+        const Platform& platform = *(*source)[index];
+        const sf::Texture* texture = platform.getTexture();
+
+        auto it = std::find_if(chunk.batches.begin(), chunk.batches.end(),
+                               [texture](const Batch& batch) { return batch.texture == texture; });
+        if (it == chunk.batches.end()) {
+            chunk.batches.push_back(Batch{texture, sf::VertexArray(sf::Quads)});
+            it = chunk.batches.end() - 1;
+        }
+        platform.appendVertices(it->vertices);
+
+        chunk.bounds = first ? platform.getBounds() : unite(chunk.bounds, platform.getBounds());
+        first = false;
+    }
+
+    // Drop batches whose texture no longer appears in the chunk
+    chunk.batches.erase(std::remove_if(chunk.batches.begin(), chunk.batches.end(),
+                                       [](const Batch& batch) { return batch.vertices.getVertexCount() == 0; }),
+                        chunk.batches.end());
+    chunk.dirty = false;
+}
+
+void PlatformRenderer::draw(sf::RenderTarget& target) {
+    lastDrawCalls = 0;
+    if (!source) {
+        return;
+    }
+
+    const sf::View& view = target.getView();
+    const sf::FloatRect visible(view.getCenter() - view.getSize() / 2.0f, view.getSize());
+
+    for (Chunk& chunk : chunks) {
+        if (chunk.dirty) {
+            bake(chunk);
+        }
+        if (chunk.members.empty() || !chunk.bounds.intersects(visible)) continue;
+
+        for (const Batch& batch : chunk.batches) {
+            target.draw(batch.vertices, sf::RenderStates(batch.texture));
+            lastDrawCalls++;
+        }
+    }
+}
@@ -0,0 +1,228 @@
+#include "graphics/RenderQueue.h"
+#include <algorithm>
+#include <cmath>
+#include <functional>
+
+namespace {
+    sf::Vector2f computeNormal(const sf::Vector2f& p1, const sf::Vector2f& p2) {
+        sf::Vector2f normal(p1.y - p2.y, p2.x - p1.x);
+        const float length = std::sqrt(normal.x * normal.x + normal.y * normal.y);
+        if (length != 0.0f) {
+            normal /= length;
+        }
+        return normal;
+    }
+
+    float dot(const sf::Vector2f& a, const sf::Vector2f& b) {
+        return a.x * b.x + a.y * b.y;
+    }
+
+    sf::FloatRect pointBounds(const std::vector<sf::Vector2f>& points) {
+        float left = points[0].x, top = points[0].y;
+        float right = left, bottom = top;
+        for (const sf::Vector2f& p : points) {
+            left = std::min(left, p.x);
+            top = std::min(top, p.y);
+            right = std::max(right, p.x);
+            bottom = std::max(bottom, p.y);
+        }
+        return sf::FloatRect(left, top, right - left, bottom - top);
+    }
+
+    sf::Transform withOffset(const sf::Transform& transform, const sf::Vector2f& offset) {
+        sf::Transform shifted;
+        shifted.translate(offset);
+        shifted.combine(transform);
+        return shifted;
+    }
+}
+
+void RenderQueue::pushCommand(RenderLayer layer, const sf::Texture* texture, std::size_t firstVertex) {
+    commands.push_back(Command{layer, texture, static_cast<std::uint32_t>(commands.size()),
+                               firstVertex, vertices.size() - firstVertex, false, sf::Triangles});
+}
+
+void RenderQueue::appendTriangle(const sf::Vertex& a, const sf::Vertex& b, const sf::Vertex& c) {
+    vertices.push_back(a);
+    vertices.push_back(b);
+    vertices.push_back(c);
+}
+
+void RenderQueue::submitQuad(RenderLayer layer, const sf::Texture* texture, const sf::Vertex (&quad)[4]) {
+    const std::size_t first = vertices.size();
+    appendTriangle(quad[0], quad[1], quad[2]);
+    appendTriangle(quad[0], quad[2], quad[3]);
+    pushCommand(layer, texture, first);
+}
+
+void RenderQueue::submit(RenderLayer layer, const sf::Sprite& sprite, const sf::Vector2f& offset) {
+    const sf::Texture* texture = sprite.getTexture();
+    if (!texture) return;
+
+    // Same geometry as sf::Sprite: local quad of the texture rect, mapped by the transform
+    const sf::Transform transform = withOffset(sprite.getTransform(), offset);
+    const sf::IntRect& rect = sprite.getTextureRect();
+    const sf::FloatRect local = sprite.getLocalBounds();
+
+    const float u0 = static_cast<float>(rect.left);
+    const float u1 = u0 + static_cast<float>(rect.width);
+    const float v0 = static_cast<float>(rect.top);
+    const float v1 = v0 + static_cast<float>(rect.height);
+    const sf::Color color = sprite.getColor();
+
+    const sf::Vertex quad[4] = {
+        sf::Vertex(transform.transformPoint(0.0f, 0.0f), color, sf::Vector2f(u0, v0)),
+        sf::Vertex(transform.transformPoint(local.width, 0.0f), color, sf::Vector2f(u1, v0)),
+        sf::Vertex(transform.transformPoint(local.width, local.height), color, sf::Vector2f(u1, v1)),
+        sf::Vertex(transform.transformPoint(0.0f, local.height), color, sf::Vector2f(u0, v1))
+    };
+    submitQuad(layer, texture, quad);
+}
+
+void RenderQueue::submit(RenderLayer layer, const sf::Shape& shape, const sf::Vector2f& offset) {
+    const std::size_t count = shape.getPointCount();
+    if (count < 3) return;
+
+    points.clear();
+    for (std::size_t i = 0; i < count; ++i) {
+        points.push_back(shape.getPoint(i));
+    }
+    const sf::Transform transform = withOffset(shape.getTransform(), offset);
+
+    // Fill: convex fan from the first point (textured like sf::Shape, over the points' bounds)
+    const sf::Texture* texture = shape.getTexture();
+    const sf::FloatRect bounds = pointBounds(points);
+    const sf::IntRect texRect = shape.getTextureRect();
+    const sf::Color fill = shape.getFillColor();
+
+    auto fillVertex = [&](const sf::Vector2f& p) {
+        sf::Vector2f uv;
+        if (texture) {
+            const float xRatio = bounds.width > 0.0f ? (p.x - bounds.left) / bounds.width : 0.0f;
+            const float yRatio = bounds.height > 0.0f ? (p.y - bounds.top) / bounds.height : 0.0f;
+            uv.x = static_cast<float>(texRect.left) + static_cast<float>(texRect.width) * xRatio;
+            uv.y = static_cast<float>(texRect.top) + static_cast<float>(texRect.height) * yRatio;
+        }
+        return sf::Vertex(transform.transformPoint(p), fill, uv);
+    };
+
+    if (fill.a > 0 || texture) {
+        const std::size_t first = vertices.size();
+        const sf::Vertex origin = fillVertex(points[0]);
+        for (std::size_t i = 1; i + 1 < count; ++i) {
+            appendTriangle(origin, fillVertex(points[i]), fillVertex(points[i + 1]));
+        }
+        pushCommand(layer, texture, first);
+    }
+
+    if (shape.getOutlineThickness() != 0.0f && shape.getOutlineColor().a > 0) {
+        const std::size_t first = vertices.size();
+        appendOutline(shape, transform);
+        pushCommand(layer, nullptr, first);
+    }
+}
+
+void RenderQueue::appendOutline(const sf::Shape& shape, const sf::Transform& transform) {
+    // Same extrusion as sf::Shape: each point moves along the mean of its edge normals
+    const std::size_t count = points.size();
+    const float thickness = shape.getOutlineThickness();
+    const sf::Color color = shape.getOutlineColor();
+    const sf::FloatRect bounds = pointBounds(points);
+    const sf::Vector2f center(bounds.left + bounds.width / 2.0f, bounds.top + bounds.height / 2.0f);
+
+    auto ring = [&](std::size_t i, sf::Vertex& inner, sf::Vertex& outer) {
+        const sf::Vector2f& p0 = points[(i + count - 1) % count];
+        const sf::Vector2f& p1 = points[i];
+        const sf::Vector2f& p2 = points[(i + 1) % count];
+
+        sf::Vector2f n1 = computeNormal(p0, p1);
+        sf::Vector2f n2 = computeNormal(p1, p2);
+        if (dot(n1, center - p1) > 0.0f) n1 = -n1;
+        if (dot(n2, center - p1) > 0.0f) n2 = -n2;
+
+        const float factor = 1.0f + dot(n1, n2);
+        const sf::Vector2f normal = factor != 0.0f ? (n1 + n2) / factor : n1;
+
+        inner = sf::Vertex(transform.transformPoint(p1), color);
+        outer = sf::Vertex(transform.transformPoint(p1 + normal * thickness), color);
+    };
+
+    sf::Vertex firstInner, firstOuter;
+    ring(0, firstInner, firstOuter);
+    sf::Vertex inner = firstInner, outer = firstOuter;
+    for (std::size_t i = 1; i <= count; ++i) {
+        sf::Vertex nextInner = firstInner, nextOuter = firstOuter;
+        if (i < count) {
+            ring(i, nextInner, nextOuter);
+        }
+        appendTriangle(inner, outer, nextInner);
+        appendTriangle(outer, nextOuter, nextInner);
+        inner = nextInner;
+        outer = nextOuter;
+    }
+}
+
+void RenderQueue::submitBatch(RenderLayer layer, const sf::Texture* texture, const sf::Vertex* batchVertices,
+                              std::size_t count, sf::PrimitiveType type) {
+    if (!batchVertices || count == 0) return;
+    const std::size_t first = vertices.size();
+    vertices.insert(vertices.end(), batchVertices, batchVertices + count);
+    commands.push_back(Command{layer, texture, static_cast<std::uint32_t>(commands.size()),
+                               first, count, true, type});
+}
+
+void RenderQueue::flush(sf::RenderTarget& target) {
+    Stats stats;
+    stats.commands = commands.size();
+
+    std::sort(commands.begin(), commands.end(), [](const Command& a, const Command& b) {
+        if (a.layer != b.layer) return a.layer < b.layer;
+        if (a.texture != b.texture) return std::less<const sf::Texture*>()(a.texture, b.texture);
+        return a.order < b.order;
+    });
+
+    const sf::Texture* bound = nullptr;
+    bool anyBound = false;
+    auto draw = [&](const sf::Vertex* data, std::size_t count, sf::PrimitiveType type, const sf::Texture* texture) {
+        target.draw(data, count, type, sf::RenderStates(texture));
+        stats.batches++;
+        if (!anyBound || texture != bound) {
+            stats.textureSwitches++;
+        }
+        bound = texture;
+        anyBound = true;
+    };
+
+    // Consecutive commands sharing a texture (across layers too) merge into one array
+    const sf::Texture* batchTexture = nullptr;
+    auto flushBatch = [&]() {
+        if (batch.empty()) return;
+        draw(batch.data(), batch.size(), sf::Triangles, batchTexture);
+        batch.clear();
+    };
+
+    for (const Command& command : commands) {
+        if (command.prebatched) {
+            flushBatch();
+            draw(vertices.data() + command.firstVertex, command.vertexCount, command.type, command.texture);
+            continue;
+        }
+        if (!batch.empty() && command.texture != batchTexture) {
+            flushBatch();
+        }
+        batchTexture = command.texture;
+        batch.insert(batch.end(), vertices.begin() + static_cast<std::ptrdiff_t>(command.firstVertex),
+                     vertices.begin() + static_cast<std::ptrdiff_t>(command.firstVertex + command.vertexCount));
+    }
+    flushBatch();
+
+    lastStats = stats;
+    clear();
+}
+
+void RenderQueue::clear() {
+    // Keep the storage: the queue refills with about the same amount every frame
+    commands.clear();
+    vertices.clear();
+    batch.clear();
+}
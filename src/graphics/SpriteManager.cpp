@@ -1,5 +1,35 @@
 #include "graphics/SpriteManager.h"
+#include "core/AssetFileSystem.h"
 #include "core/Logger.h"
+#include <algorithm>
+
+namespace {
+    constexpr unsigned int ATLAS_PAGE_SIZE = 2048;   // Clamped to the GPU limit
+    constexpr unsigned int ATLAS_PADDING = 2;        // Empty texels between slots (no bleeding when scaled)
+
+    // Opaque bounding box of an image (whole image when fully transparent)
+    sf::IntRect opaqueBounds(const AssetPack::ImageView& image) {
+        unsigned int minX = image.width, minY = image.height, maxX = 0, maxY = 0;
+        bool any = false;
+        for (unsigned int y = 0; y < image.height; ++y) {
+            const sf::Uint8* row = image.pixels + static_cast<std::size_t>(y) * image.width * 4;
+            for (unsigned int x = 0; x < image.width; ++x) {
+                if (row[x * 4 + 3] > 0) {
+                    any = true;
+                    minX = std::min(minX, x);
+                    minY = std::min(minY, y);
+                    maxX = std::max(maxX, x);
+                    maxY = std::max(maxY, y);
+                }
+            }
+        }
+        if (!any) {
+            return sf::IntRect(0, 0, static_cast<int>(image.width), static_cast<int>(image.height));
+        }
+        return sf::IntRect(static_cast<int>(minX), static_cast<int>(minY),
+                           static_cast<int>(maxX - minX + 1), static_cast<int>(maxY - minY + 1));
+    }
+}
 
 SpriteManager& SpriteManager::getInstance() {
     static SpriteManager instance;
@@ -7,6 +37,11 @@ SpriteManager& SpriteManager::getInstance() {
 }
 
 bool SpriteManager::loadTexture(const std::string& id, const std::string& filepath) {
+    // No GL context in headless mode: never touch sf::Texture
+    if (headless) {
+        return false;
+    }
+
     // Check if already loaded
     if (hasTexture(id)) {
         Logger::warning("Texture '" + id + "' already loaded");
@@ -15,8 +50,16 @@ bool SpriteManager::loadTexture(const std::string& id, const std::string& filepa
 
     // Create new texture
     auto texture = std::make_unique<sf::Texture>();
-    
-    if (!texture->loadFromFile(filepath)) {
+
+    // Baked pack: upload straight from the mapped pixels, no PNG decode
+    AssetPack::ImageView packed;
+    if (AssetPack::getInstance().findImage(filepath, packed)) {
+        if (!texture->create(packed.width, packed.height)) {
+            Logger::error("Failed to create texture: " + filepath);
+            return false;
+        }
+        texture->update(packed.pixels);
+    } else if (!texture->loadFromFile(AssetFileSystem::getInstance().resolve(filepath))) {
         Logger::error("Failed to load texture: " + filepath);
         return false;
     }
@@ -49,8 +92,132 @@ void SpriteManager::unloadTexture(const std::string& id) {
     }
 }
 
+bool SpriteManager::loadFrame(const std::string& id, const std::string& filepath, bool trim) {
+    if (headless) {
+        return false;
+    }
+
+    if (hasFrame(id)) {
+        return true;
+    }
+
+    // Pixels from the pack mapping, or decoded from the loose PNG
+    AssetPack::ImageView pixels;
+    sf::Image image;
+    if (!AssetPack::getInstance().findImage(filepath, pixels)) {
+        if (!image.loadFromFile(AssetFileSystem::getInstance().resolve(filepath))) {
+            Logger::error("Failed to load frame: " + filepath);
+            return false;
+        }
+        pixels.pixels = image.getPixelsPtr();
+        pixels.width = image.getSize().x;
+        pixels.height = image.getSize().y;
+    }
+
+    const sf::IntRect area = trim ? opaqueBounds(pixels)
+                                  : sf::IntRect(0, 0, static_cast<int>(pixels.width), static_cast<int>(pixels.height));
+
+    SpriteFrame frame;
+    if (!packImage(pixels, area, frame)) {
+        // Too big for a page: keep it as a standalone texture
+        auto texture = std::make_unique<sf::Texture>();
+        if (!texture->create(static_cast<unsigned int>(area.width), static_cast<unsigned int>(area.height))) {
+            Logger::error("Failed to create texture for frame: " + filepath);
+            return false;
+        }
+        texture->update(regionPixels(pixels, area));
+        texture->setSmooth(false);
+        frame.texture = texture.get();
+        frame.rect = sf::IntRect(0, 0, area.width, area.height);
+        textures[id] = std::move(texture);
+    }
+
+    frames[id] = frame;
+    return true;
+}
+
+unsigned int SpriteManager::atlasPageSize() const {
+    return std::min(ATLAS_PAGE_SIZE, sf::Texture::getMaximumSize());
+}
+
+bool SpriteManager::packImage(const AssetPack::ImageView& image, const sf::IntRect& area, SpriteFrame& out) {
+    const unsigned int pageSize = atlasPageSize();
+    const unsigned int width = static_cast<unsigned int>(area.width);
+    const unsigned int height = static_cast<unsigned int>(area.height);
+    if (width + ATLAS_PADDING > pageSize || height + ATLAS_PADDING > pageSize) {
+        return false;
+    }
+
+    // Shelf packing: fill the current row, open a new row, then a new page
+    AtlasPage* page = atlasPages.empty() ? nullptr : &atlasPages.back();
+    if (page && page->cursorX + width + ATLAS_PADDING > pageSize) {
+        page->cursorX = 0;
+        page->cursorY += page->shelfHeight;
+        page->shelfHeight = 0;
+    }
+    if (!page || page->cursorY + height + ATLAS_PADDING > pageSize) {
+        AtlasPage newPage;
+        // Start fully transparent so the padding between slots samples as empty
+        sf::Image blank;
+        blank.create(pageSize, pageSize, sf::Color::Transparent);
+        newPage.texture = std::make_unique<sf::Texture>();
+        if (!newPage.texture->loadFromImage(blank)) {
+            Logger::error("Failed to create atlas page");
+            return false;
+        }
+        // CRITICAL: Disable smoothing for pixel art
+        newPage.texture->setSmooth(false);
+        atlasPages.push_back(std::move(newPage));
+        page = &atlasPages.back();
+        Logger::info("Atlas page " + std::to_string(atlasPages.size()) + " created");
+    }
+
+    page->texture->update(regionPixels(image, area), width, height, page->cursorX, page->cursorY);
+
+    out.texture = page->texture.get();
+    out.rect = sf::IntRect(static_cast<int>(page->cursorX), static_cast<int>(page->cursorY),
+                           static_cast<int>(width), static_cast<int>(height));
+
+    page->cursorX += width + ATLAS_PADDING;
+    page->shelfHeight = std::max(page->shelfHeight, height + ATLAS_PADDING);
+    return true;
+}
+
+const sf::Uint8* SpriteManager::regionPixels(const AssetPack::ImageView& image, const sf::IntRect& area) {
+    const unsigned int width = static_cast<unsigned int>(area.width);
+    const unsigned int height = static_cast<unsigned int>(area.height);
+    if (area.left == 0 && area.top == 0 && width == image.width && height == image.height) {
+        return image.pixels;
+    }
+
+    regionScratch.resize(static_cast<std::size_t>(width) * height * 4);
+    for (unsigned int y = 0; y < height; ++y) {
+        const sf::Uint8* source = image.pixels +
+            (static_cast<std::size_t>(area.top + y) * image.width + static_cast<std::size_t>(area.left)) * 4;
+        std::copy(source, source + static_cast<std::size_t>(width) * 4,
+                  regionScratch.begin() + static_cast<std::ptrdiff_t>(y) * width * 4);
+    }
+    return regionScratch.data();
+}
+
+SpriteFrame SpriteManager::getFrame(const std::string& id) const {
+    auto it = frames.find(id);
+    if (it != frames.end()) {
+        return it->second;
+    }
+
+    Logger::warning("Frame '" + id + "' not found");
+    return SpriteFrame();
+}
+
+bool SpriteManager::hasFrame(const std::string& id) const {
+    return frames.find(id) != frames.end();
+}
+
 void SpriteManager::unloadAll() {
     textures.clear();
+    frames.clear();
+    atlasPages.clear();
     Logger::info("Unloaded all textures");
 }
 
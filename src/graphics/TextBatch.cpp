@@ -0,0 +1,225 @@
+#include "graphics/TextBatch.h"
+#include <algorithm>
+
+namespace {
+    // Same quad as sf::Text: glyph bounds padded by one pixel, shifted back by the outline
+    void appendGlyph(std::vector<sf::Vertex>& out, float x, float y, const sf::Color& color,
+                     const sf::Glyph& glyph, float outlineThickness) {
+        const float padding = 1.0f;
+
+        const float left = glyph.bounds.left - padding - outlineThickness;
+        const float top = glyph.bounds.top - padding - outlineThickness;
+        const float right = glyph.bounds.left + glyph.bounds.width + padding - outlineThickness;
+        const float bottom = glyph.bounds.top + glyph.bounds.height + padding - outlineThickness;
+
+        const float u1 = static_cast<float>(glyph.textureRect.left) - padding;
+        const float v1 = static_cast<float>(glyph.textureRect.top) - padding;
+        const float u2 = static_cast<float>(glyph.textureRect.left + glyph.textureRect.width) + padding;
+        const float v2 = static_cast<float>(glyph.textureRect.top + glyph.textureRect.height) + padding;
+
+        out.emplace_back(sf::Vector2f(x + left, y + top), color, sf::Vector2f(u1, v1));
+        out.emplace_back(sf::Vector2f(x + right, y + top), color, sf::Vector2f(u2, v1));
+        out.emplace_back(sf::Vector2f(x + left, y + bottom), color, sf::Vector2f(u1, v2));
+        out.emplace_back(sf::Vector2f(x + left, y + bottom), color, sf::Vector2f(u1, v2));
+        out.emplace_back(sf::Vector2f(x + right, y + top), color, sf::Vector2f(u2, v1));
+        out.emplace_back(sf::Vector2f(x + right, y + bottom), color, sf::Vector2f(u2, v2));
+    }
+}
+
+TextBatch::TextBatch()
+    : font(nullptr)
+    , layoutChanged(false)
+    , frame(0)
+    , lastDrawCalls(0)
+{
+}
+
+void TextBatch::setFont(const sf::Font& newFont) {
+    if (font == &newFont) return;
+    clear();
+    font = &newFont;
+}
+
+void TextBatch::clear() {
+    entries.clear();
+    placements.clear();
+    lastPlacements.clear();
+    groups.clear();
+    layoutChanged = false;
+}
+
+const sf::FloatRect& TextBatch::layout(std::uint64_t key, const std::string& text, const TextStyle& style) {
+    auto it = entries.find(key);
+    if (it == entries.end()) {
+        it = entries.emplace(key, Entry()).first;
+    } else if (it->second.text == text && it->second.style == style) {
+        return it->second.bounds;
+    }
+
+    Entry& entry = it->second;
+    entry.text = text;
+    entry.style = style;
+    build(entry);
+    layoutChanged = true;
+    return entry.bounds;
+}
+
+void TextBatch::put(std::uint64_t key, const sf::Vector2f& position) {
+    auto it = entries.find(key);
+    if (it == entries.end()) return;
+
+    it->second.lastFrame = frame;
+    placements.push_back(Placement{key, &it->second, position});
+}
+
+void TextBatch::put(std::uint64_t key, const std::string& text, const TextStyle& style,
+                    const sf::Vector2f& position) {
+    layout(key, text, style);
+    put(key, position);
+}
+
+float TextBatch::getAdvance(std::uint64_t key) const {
+    auto it = entries.find(key);
+    return it != entries.end() ? it->second.advance : 0.0f;
+}
+
+void TextBatch::build(Entry& entry) const {
+    entry.outline.clear();
+    entry.fill.clear();
+    entry.bounds = sf::FloatRect();
+    entry.advance = 0.0f;
+    if (!font) return;
+
+    const TextStyle& style = entry.style;
+    const unsigned int size = style.characterSize;
+    const float thickness = style.outlineThickness;
+    const float whitespaceWidth = font->getGlyph(U' ', size, false).advance;
+    const float lineSpacing = font->getLineSpacing(size);
+
+    // Pen starts on the first baseline, like sf::Text
+    float x = 0.0f;
+    float y = static_cast<float>(size);
+    float minX = static_cast<float>(size);
+    float minY = static_cast<float>(size);
+    float maxX = 0.0f;
+    float maxY = 0.0f;
+
+    const sf::String string(entry.text);
+    sf::Uint32 previous = 0;
+    for (std::size_t i = 0; i < string.getSize(); ++i) {
+        const sf::Uint32 current = string[i];
+        if (current == U'\r') continue;
+
+        x += font->getKerning(previous, current, size);
+        previous = current;
+
+        if (current == U' ' || current == U'\n' || current == U'\t') {
+            minX = std::min(minX, x);
+            minY = std::min(minY, y);
+            if (current == U' ') {
+                x += whitespaceWidth;
+            } else if (current == U'\t') {
+                x += whitespaceWidth * 4.0f;
+            } else {
+                y += lineSpacing;
+                x = 0.0f;
+            }
+            maxX = std::max(maxX, x);
+            maxY = std::max(maxY, y);
+            continue;
+        }
+
+        if (thickness != 0.0f) {
+            const sf::Glyph& glyph = font->getGlyph(current, size, false, thickness);
+            appendGlyph(entry.outline, x, y, style.outlineColor, glyph, thickness);
+
+            minX = std::min(minX, x + glyph.bounds.left - thickness);
+            maxX = std::max(maxX, x + glyph.bounds.left + glyph.bounds.width - thickness);
+            minY = std::min(minY, y + glyph.bounds.top - thickness);
+            maxY = std::max(maxY, y + glyph.bounds.top + glyph.bounds.height - thickness);
+        }
+
+        const sf::Glyph& glyph = font->getGlyph(current, size, false);
+        appendGlyph(entry.fill, x, y, style.fillColor, glyph, 0.0f);
+
+        if (thickness == 0.0f) {
+            minX = std::min(minX, x + glyph.bounds.left);
+            maxX = std::max(maxX, x + glyph.bounds.left + glyph.bounds.width);
+            minY = std::min(minY, y + glyph.bounds.top);
+            maxY = std::max(maxY, y + glyph.bounds.top + glyph.bounds.height);
+        }
+
+        x += glyph.advance;
+    }
+
+    entry.advance = x;
+    if (!entry.text.empty()) {
+        entry.bounds = sf::FloatRect(minX, minY, maxX - minX, maxY - minY);
+    }
+}
+
+void TextBatch::merge() {
+    auto append = [](sf::VertexArray& out, const std::vector<sf::Vertex>& vertices, const sf::Vector2f& position) {
+        for (const sf::Vertex& vertex : vertices) {
+            out.append(sf::Vertex(vertex.position + position, vertex.color, vertex.texCoords));
+        }
+    };
+
+    // Consecutive entries of the same size share a draw call; a size change starts a new
+    // group, so overlapping labels stack in put() order like sequential sf::Text draws
+    std::size_t used = 0;
+    for (const Placement& placement : placements) {
+        const Entry& entry = *placement.entry;
+        if (entry.outline.empty() && entry.fill.empty()) continue;
+
+        const unsigned int characterSize = entry.style.characterSize;
+        if (used == 0 || groups[used - 1].characterSize != characterSize) {
+            if (used == groups.size()) {
+                groups.push_back(Group{characterSize, sf::VertexArray(sf::Triangles)});
+            }
+            groups[used].characterSize = characterSize;
+            groups[used].vertices.clear();
+            used++;
+        }
+
+        // Outline then fill per entry, as sf::Text draws them
+        sf::VertexArray& out = groups[used - 1].vertices;
+        append(out, entry.outline, placement.position);
+        append(out, entry.fill, placement.position);
+    }
+    groups.erase(groups.begin() + static_cast<std::ptrdiff_t>(used), groups.end());
+}
+
+void TextBatch::draw(sf::RenderTarget& target) {
+    lastDrawCalls = 0;
+
+    if (font) {
+        // Same strings at the same places as last frame: the merged arrays are still valid
+        if (layoutChanged || placements != lastPlacements) {
+            merge();
+            lastPlacements = placements;
+        }
+
+        for (const Group& group : groups) {
+            target.draw(group.vertices, sf::RenderStates(&font->getTexture(group.characterSize)));
+            lastDrawCalls++;
+        }
+    }
+
+    placements.clear();
+    layoutChanged = false;
+    frame++;
+    if (frame % EVICT_FRAMES == 0) {
+        evict();
+    }
+}
+
+void TextBatch::evict() {
+    for (auto it = entries.begin(); it != entries.end();) {
+        if (frame - it->second.lastFrame >= EVICT_FRAMES) {
+            it = entries.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
@@ -1,6 +1,8 @@
 #include "physics/CollisionSystem.h"
 #include "physics/PhysicsConstants.h"
+#include <algorithm>
 #include <cmath>
+#include <limits>
 
 namespace CollisionSystem {
 
@@ -53,4 +55,151 @@ bool resolveCollision(sf::FloatRect& movingRect, sf::Vector2f& velocity,
     return true;
 }
 
+SweepHit sweepAABB(const sf::FloatRect& movingRect, const sf::Vector2f& displacement,
+                   const sf::FloatRect& staticRect)
+{
+    SweepHit result;
+    const float infinity = std::numeric_limits<float>::infinity();
+
+    // Entry / exit times on each axis (slab test on the Minkowski difference)
+    float entryX, exitX, entryY, exitY;
+    if (displacement.x > 0.0f) {
+        entryX = (staticRect.left - (movingRect.left + movingRect.width)) / displacement.x;
+        exitX = (staticRect.left + staticRect.width - movingRect.left) / displacement.x;
+    } else if (displacement.x < 0.0f) {
+        entryX = (staticRect.left + staticRect.width - movingRect.left) / displacement.x;
+        exitX = (staticRect.left - (movingRect.left + movingRect.width)) / displacement.x;
+    } else {
+        // Not moving on X: must already overlap on X to ever touch
+        if (movingRect.left >= staticRect.left + staticRect.width ||
+            movingRect.left + movingRect.width <= staticRect.left) {
+            return result;
+        }
+        entryX = -infinity;
+        exitX = infinity;
+    }
+
+    if (displacement.y > 0.0f) {
+        entryY = (staticRect.top - (movingRect.top + movingRect.height)) / displacement.y;
+        exitY = (staticRect.top + staticRect.height - movingRect.top) / displacement.y;
+    } else if (displacement.y < 0.0f) {
+        entryY = (staticRect.top + staticRect.height - movingRect.top) / displacement.y;
+        exitY = (staticRect.top - (movingRect.top + movingRect.height)) / displacement.y;
+    } else {
+        if (movingRect.top >= staticRect.top + staticRect.height ||
+            movingRect.top + movingRect.height <= staticRect.top) {
+            return result;
+        }
+        entryY = -infinity;
+        exitY = infinity;
+    }
+
+    const float entry = std::max(entryX, entryY);
+    const float exit = std::min(exitX, exitY);
+
+    // No contact during this step, or overlapping from the start
+    if (entry >= exit || entry < 0.0f || entry > 1.0f) {
+        return result;
+    }
+
+    result.hit = true;
+    result.time = entry;
+    if (entryX > entryY) {
+        result.normal.x = (displacement.x > 0.0f) ? -1.0f : 1.0f;
+    } else {
+        result.normal.y = (displacement.y > 0.0f) ? -1.0f : 1.0f;
+    }
+    return result;
+}
+
+bool sweepTunnels(const sf::FloatRect& movingRect, const sf::Vector2f& displacement,
+                  const sf::FloatRect& staticRect)
+{
+    const SweepHit hit = sweepAABB(movingRect, displacement, staticRect);
+    if (!hit.hit) {
+        return false;
+    }
+
+    // End position beyond the far side of the contact face
+    const float endLeft = movingRect.left + displacement.x;
+    const float endTop = movingRect.top + displacement.y;
+    if (hit.normal.x < 0.0f) return endLeft >= staticRect.left + staticRect.width;
+    if (hit.normal.x > 0.0f) return endLeft + movingRect.width <= staticRect.left;
+    if (hit.normal.y < 0.0f) return endTop >= staticRect.top + staticRect.height;
+    return endTop + movingRect.height <= staticRect.top;
+}
+
+bool moveAndSlide(sf::FloatRect& movingRect, sf::Vector2f& velocity, const sf::Vector2f& displacement,
+                  const std::vector<sf::FloatRect>& obstacles, bool& isGrounded)
+{
+    sf::Vector2f remaining = displacement;
+    bool collided = false;
+
+    for (int iteration = 0; iteration < Physics::MAX_SLIDE_ITERATIONS; ++iteration) {
+        if (remaining.x == 0.0f && remaining.y == 0.0f) {
+            break;
+        }
+
+        // Earliest contact along the remaining displacement
+        SweepHit earliest;
+        const sf::FloatRect* blocker = nullptr;
+        for (const sf::FloatRect& obstacle : obstacles) {
+            SweepHit hit = sweepAABB(movingRect, remaining, obstacle);
+            if (hit.hit && hit.time < earliest.time) {
+                earliest = hit;
+                blocker = &obstacle;
+            }
+        }
+
+        if (!blocker) {
+            movingRect.left += remaining.x;
+            movingRect.top += remaining.y;
+            break;
+        }
+
+        collided = true;
+        movingRect.left += remaining.x * earliest.time;
+        movingRect.top += remaining.y * earliest.time;
+
+        // Rest against the surface (same gap as resolveCollision) and slide along it
+        if (earliest.normal.x != 0.0f) {
+            movingRect.left = (earliest.normal.x < 0.0f)
+                ? blocker->left - movingRect.width - Physics::EPSILON
+                : blocker->left + blocker->width + Physics::EPSILON;
+            velocity.x = 0.0f;
+            remaining = sf::Vector2f(0.0f, remaining.y * (1.0f - earliest.time));
+        } else {
+            movingRect.top = (earliest.normal.y < 0.0f)
+                ? blocker->top - movingRect.height - Physics::EPSILON
+                : blocker->top + blocker->height + Physics::EPSILON;
+            if (earliest.normal.y < 0.0f) {
+                isGrounded = true;
+            }
+            velocity.y = 0.0f;
+            remaining = sf::Vector2f(remaining.x * (1.0f - earliest.time), 0.0f);
+        }
+    }
+
+    return collided;
+}
+
+float distanceToSegment(const sf::Vector2f& point, const sf::Vector2f& a, const sf::Vector2f& b,
+                        sf::Vector2f* closestPoint)
+{
+    const sf::Vector2f ab = b - a;
+    const float lengthSq = ab.x * ab.x + ab.y * ab.y;
+    float t = 0.0f;
+    if (lengthSq > 0.0f) {
+        const sf::Vector2f ap = point - a;
+        t = std::clamp((ap.x * ab.x + ap.y * ab.y) / lengthSq, 0.0f, 1.0f);
+    }
+
+    const sf::Vector2f closest = a + ab * t;
+    if (closestPoint) {
+        *closestPoint = closest;
+    }
+    const sf::Vector2f delta = point - closest;
+    return std::sqrt(delta.x * delta.x + delta.y * delta.y);
+}
+
 } // namespace CollisionSystem
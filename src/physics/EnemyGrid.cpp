@@ -0,0 +1,238 @@
+#include "physics/EnemyGrid.h"
+#include "entities/Enemy.h"
+#include "physics/CellKey.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    constexpr std::size_t INITIAL_CELL_CAPACITY = 256;
+}
+
+EnemyGrid::EnemyGrid(float cellSize)
+    : cellSize(cellSize)
+    , maxExtent(0.0f)
+    , cellCount(0)
+{
+}
+
+void EnemyGrid::clear() {
+    slots.clear();
+    cellKeys.clear();
+    cellHeads.clear();
+    cellUsed.clear();
+    cellCount = 0;
+    maxExtent = 0.0f;
+}
+
+bool EnemyGrid::matches(const std::vector<std::unique_ptr<Enemy>>& enemies) const {
+    if (slots.size() != enemies.size()) {
+        return false;
+    }
+    for (std::size_t i = 0; i < enemies.size(); ++i) {
+        if (slots[i].enemy != enemies[i].get()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void EnemyGrid::rebuildSlots(const std::vector<std::unique_ptr<Enemy>>& enemies) {
+    // Keep the cell table (same level area), only empty its lists
+    std::fill(cellHeads.begin(), cellHeads.end(), NONE);
+    maxExtent = 0.0f;
+
+    slots.resize(enemies.size());
+    for (std::size_t i = 0; i < enemies.size(); ++i) {
+        slots[i] = Slot{enemies[i].get(), NONE, NONE, NONE, 0, 0};
+    }
+}
+
+void EnemyGrid::sync(const std::vector<std::unique_ptr<Enemy>>& enemies) {
+    if (!matches(enemies)) {
+        rebuildSlots(enemies);
+    }
+
+    for (std::size_t i = 0; i < slots.size(); ++i) {
+        syncSlot(static_cast<std::int32_t>(i));
+    }
+}
+
+void EnemyGrid::syncSlots(const std::vector<std::int32_t>& indices) {
+    for (std::int32_t slotIndex : indices) {
+        if (slotIndex >= 0 && static_cast<std::size_t>(slotIndex) < slots.size()) {
+            syncSlot(slotIndex);
+        }
+    }
+}
+
+void EnemyGrid::syncSlot(std::int32_t slotIndex) {
+    Slot& slot = slots[slotIndex];
+
+    if (!slot.enemy || !slot.enemy->isAlive()) {
+        if (slot.cell != NONE) {
+            unlink(slotIndex);
+        }
+        return;
+    }
+
+    const sf::FloatRect bounds = slot.enemy->getBounds();
+    maxExtent = std::max(maxExtent, std::max(bounds.width, bounds.height));
+
+    const int cx = cellCoord(bounds.left);
+    const int cy = cellCoord(bounds.top);
+    if (slot.cell != NONE && slot.cellX == cx && slot.cellY == cy) {
+        return;   // Still in the same cell: nothing to do
+    }
+
+    const std::int32_t target = findOrCreateCell(cx, cy);
+    if (slot.cell != NONE) {
+        unlink(slotIndex);
+    }
+    slot.cellX = cx;
+    slot.cellY = cy;
+    link(slotIndex, target);
+}
+
+void EnemyGrid::query(const sf::FloatRect& area, std::vector<Enemy*>& out) const {
+    out.clear();
+    if (slots.empty() || cellCount == 0) {
+        return;
+    }
+
+    // Enemies are keyed by their top-left corner: look back by the largest enemy size
+    const int minX = cellCoord(area.left - maxExtent);
+    const int minY = cellCoord(area.top - maxExtent);
+    const int maxX = cellCoord(area.left + area.width);
+    const int maxY = cellCoord(area.top + area.height);
+
+    candidates.clear();
+    const long long queryCells = static_cast<long long>(maxX - minX + 1) * static_cast<long long>(maxY - minY + 1);
+    if (queryCells > static_cast<long long>(cellCount)) {
+        // Huge area: walking the slots is cheaper than probing empty cells
+        for (std::size_t i = 0; i < slots.size(); ++i) {
+            if (slots[i].cell != NONE) {
+                candidates.push_back(static_cast<std::int32_t>(i));
+            }
+        }
+    } else {
+        for (int cy = minY; cy <= maxY; ++cy) {
+            for (int cx = minX; cx <= maxX; ++cx) {
+                const std::int32_t cell = findCell(cx, cy);
+                if (cell == NONE) continue;
+                for (std::int32_t s = cellHeads[cell]; s != NONE; s = slots[s].next) {
+                    candidates.push_back(s);
+                }
+            }
+        }
+        // Enemy-list order, like the linear scans this replaces
+        std::sort(candidates.begin(), candidates.end());
+    }
+
+    for (std::int32_t s : candidates) {
+        Enemy* enemy = slots[s].enemy;
+        if (enemy->isAlive() && enemy->getBounds().intersects(area)) {
+            out.push_back(enemy);
+        }
+    }
+}
+
+void EnemyGrid::link(std::int32_t slot, std::int32_t cell) {
+    Slot& entry = slots[slot];
+    entry.cell = cell;
+    entry.prev = NONE;
+    entry.next = cellHeads[cell];
+    if (entry.next != NONE) {
+        slots[entry.next].prev = slot;
+    }
+    cellHeads[cell] = slot;
+}
+
+void EnemyGrid::unlink(std::int32_t slot) {
+    Slot& entry = slots[slot];
+    if (entry.prev != NONE) {
+        slots[entry.prev].next = entry.next;
+    } else {
+        cellHeads[entry.cell] = entry.next;
+    }
+    if (entry.next != NONE) {
+        slots[entry.next].prev = entry.prev;
+    }
+    entry.cell = NONE;
+    entry.prev = NONE;
+    entry.next = NONE;
+}
+
+int EnemyGrid::cellCoord(float value) const {
+    return static_cast<int>(std::floor(value / cellSize));
+}
+
+std::uint64_t EnemyGrid::hashCell(int cx, int cy) {
+    // Large odd multipliers spread neighbouring cells across the table
+    return static_cast<std::uint64_t>(static_cast<std::uint32_t>(cx)) * 0x9E3779B97F4A7C15ULL ^
+           static_cast<std::uint64_t>(static_cast<std::uint32_t>(cy)) * 0xC2B2AE3D27D4EB4FULL;
+}
+
+std::int32_t EnemyGrid::findCell(int cx, int cy) const {
+    if (cellKeys.empty()) return NONE;
+
+    const std::int64_t key = CellKey::pack(cx, cy);
+    const std::size_t mask = cellKeys.size() - 1;
+    for (std::size_t i = hashCell(cx, cy) & mask; ; i = (i + 1) & mask) {
+        if (!cellUsed[i]) return NONE;
+        if (cellKeys[i] == key) return static_cast<std::int32_t>(i);
+    }
+}
+
+std::int32_t EnemyGrid::findOrCreateCell(int cx, int cy) {
+    const std::int32_t existing = findCell(cx, cy);
+    if (existing != NONE) return existing;
+
+    // Keep the load factor under 1/2 so probes stay short
+    if ((cellCount + 1) * 2 > cellKeys.size()) {
+        growCellTable();
+    }
+
+    const std::int64_t key = CellKey::pack(cx, cy);
+    const std::size_t mask = cellKeys.size() - 1;
+    std::size_t i = hashCell(cx, cy) & mask;
+    while (cellUsed[i]) {
+        i = (i + 1) & mask;
+    }
+    cellUsed[i] = 1;
+    cellKeys[i] = key;
+    cellHeads[i] = NONE;
+    cellCount++;
+    return static_cast<std::int32_t>(i);
+}
+
+void EnemyGrid::growCellTable() {
+    const std::size_t newCapacity = cellKeys.empty() ? INITIAL_CELL_CAPACITY : cellKeys.size() * 2;
+
+    std::vector<std::int64_t> newKeys(newCapacity, 0);
+    std::vector<std::int32_t> newHeads(newCapacity, NONE);
+    std::vector<std::uint8_t> newUsed(newCapacity, 0);
+    const std::size_t mask = newCapacity - 1;
+
+    // Reinsert cells; slots point at cell indices, so patch them as cells move
+    for (std::size_t old = 0; old < cellKeys.size(); ++old) {
+        if (!cellUsed[old]) continue;
+
+        const std::int64_t key = cellKeys[old];
+        const int cx = CellKey::unpackX(key);
+        const int cy = CellKey::unpackY(key);
+        std::size_t i = hashCell(cx, cy) & mask;
+        while (newUsed[i]) {
+            i = (i + 1) & mask;
+        }
+        newUsed[i] = 1;
+        newKeys[i] = key;
+        newHeads[i] = cellHeads[old];
+        for (std::int32_t s = cellHeads[old]; s != NONE; s = slots[s].next) {
+            slots[s].cell = static_cast<std::int32_t>(i);
+        }
+    }
+
+    cellKeys.swap(newKeys);
+    cellHeads.swap(newHeads);
+    cellUsed.swap(newUsed);
+}
@@ -0,0 +1,188 @@
+#include "physics/PlatformIndex.h"
+#include "world/Platform.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    // Platforms covering more cells than this skip the grid (huge floors, kill zones)
+    constexpr long long MAX_CELLS_PER_PLATFORM = 256;
+}
+
+PlatformIndex::PlatformIndex(float cellSize)
+    : cellSize(cellSize)
+    , totalBounds(0.0f, 0.0f, 0.0f, 0.0f)
+    , occupiedCells{0, 0, -1, -1}
+{
+}
+
+void PlatformIndex::build(const std::vector<std::unique_ptr<Platform>>& platforms) {
+    clear();
+
+    entries.reserve(platforms.size());
+    for (const auto& platform : platforms) {
+        if (!platform) continue;
+        entries.push_back(Entry{platform.get(), platform->getBounds(), false});
+    }
+
+    visitStamps.assign(entries.size(), 0);
+    for (std::uint32_t i = 0; i < entries.size(); ++i) {
+        insert(i);
+    }
+    recomputeBounds();
+}
+
+void PlatformIndex::update(std::size_t index) {
+    if (index >= entries.size()) return;
+
+    const std::uint32_t i = static_cast<std::uint32_t>(index);
+    remove(i);
+    entries[i].bounds = entries[i].platform->getBounds();
+    insert(i);
+    recomputeBounds();
+}
+
+void PlatformIndex::clear() {
+    entries.clear();
+    cells.clear();
+    oversizedEntries.clear();
+    visitStamps.clear();
+    currentStamp = 0;
+    totalBounds = sf::FloatRect(0.0f, 0.0f, 0.0f, 0.0f);
+    occupiedCells = CellRange{0, 0, -1, -1};
+}
+
+bool PlatformIndex::isBuiltFor(const std::vector<std::unique_ptr<Platform>>& platforms) const {
+    std::size_t entry = 0;
+    for (const auto& platform : platforms) {
+        if (!platform) continue;
+        if (entry >= entries.size() || entries[entry].platform != platform.get()) {
+            return false;
+        }
+        entry++;
+    }
+    return entry == entries.size();
+}
+
+PlatformIndex::CellRange PlatformIndex::cellRange(const sf::FloatRect& bounds) const {
+    CellRange range;
+    range.minX = static_cast<int>(std::floor(bounds.left / cellSize));
+    range.minY = static_cast<int>(std::floor(bounds.top / cellSize));
+    range.maxX = static_cast<int>(std::floor((bounds.left + bounds.width) / cellSize));
+    range.maxY = static_cast<int>(std::floor((bounds.top + bounds.height) / cellSize));
+    return range;
+}
+
+void PlatformIndex::insert(std::uint32_t index) {
+    Entry& entry = entries[index];
+    const CellRange range = cellRange(entry.bounds);
+    const long long cellCount = static_cast<long long>(range.maxX - range.minX + 1) *
+                                static_cast<long long>(range.maxY - range.minY + 1);
+
+    entry.oversized = cellCount > MAX_CELLS_PER_PLATFORM;
+    if (entry.oversized) {
+        oversizedEntries.push_back(index);
+        return;
+    }
+
+    for (int cy = range.minY; cy <= range.maxY; ++cy) {
+        for (int cx = range.minX; cx <= range.maxX; ++cx) {
+            cells[makeCellKey(cx, cy)].push_back(index);
+        }
+    }
+}
+
+void PlatformIndex::remove(std::uint32_t index) {
+    const Entry& entry = entries[index];
+    if (entry.oversized) {
+        oversizedEntries.erase(std::remove(oversizedEntries.begin(), oversizedEntries.end(), index),
+                               oversizedEntries.end());
+        return;
+    }
+
+    const CellRange range = cellRange(entry.bounds);
+    for (int cy = range.minY; cy <= range.maxY; ++cy) {
+        for (int cx = range.minX; cx <= range.maxX; ++cx) {
+            auto it = cells.find(makeCellKey(cx, cy));
+            if (it == cells.end()) continue;
+            auto& cell = it->second;
+            cell.erase(std::remove(cell.begin(), cell.end(), index), cell.end());
+        }
+    }
+}
+
+void PlatformIndex::recomputeBounds() {
+    if (entries.empty()) {
+        totalBounds = sf::FloatRect(0.0f, 0.0f, 0.0f, 0.0f);
+        occupiedCells = CellRange{0, 0, -1, -1};
+        return;
+    }
+
+    float left = entries[0].bounds.left;
+    float top = entries[0].bounds.top;
+    float right = left + entries[0].bounds.width;
+    float bottom = top + entries[0].bounds.height;
+    for (const Entry& entry : entries) {
+        left = std::min(left, entry.bounds.left);
+        top = std::min(top, entry.bounds.top);
+        right = std::max(right, entry.bounds.left + entry.bounds.width);
+        bottom = std::max(bottom, entry.bounds.top + entry.bounds.height);
+    }
+    totalBounds = sf::FloatRect(left, top, right - left, bottom - top);
+    occupiedCells = cellRange(totalBounds);
+}
+
+void PlatformIndex::query(const sf::FloatRect& area, std::vector<Platform*>& out) const {
+    out.clear();
+    if (entries.empty()) return;
+
+    gatherCandidates(area);
+    for (std::uint32_t index : candidates) {
+        if (entries[index].bounds.intersects(area)) {
+            out.push_back(entries[index].platform);
+        }
+    }
+}
+
+void PlatformIndex::queryIndices(const sf::FloatRect& area, std::vector<std::size_t>& out) const {
+    out.clear();
+    if (entries.empty()) return;
+
+    gatherCandidates(area);
+    for (std::uint32_t index : candidates) {
+        if (entries[index].bounds.intersects(area)) {
+            out.push_back(index);
+        }
+    }
+}
+
+void PlatformIndex::gatherCandidates(const sf::FloatRect& area) const {
+    // Stamps tell whether a platform was already collected by a previous cell
+    if (++currentStamp == 0) {
+        std::fill(visitStamps.begin(), visitStamps.end(), 0);
+        currentStamp = 1;
+    }
+
+    candidates.clear();
+    CellRange range = cellRange(area);
+    range.minX = std::max(range.minX, occupiedCells.minX);
+    range.minY = std::max(range.minY, occupiedCells.minY);
+    range.maxX = std::min(range.maxX, occupiedCells.maxX);
+    range.maxY = std::min(range.maxY, occupiedCells.maxY);
+
+    for (int cy = range.minY; cy <= range.maxY; ++cy) {
+        for (int cx = range.minX; cx <= range.maxX; ++cx) {
+            auto it = cells.find(makeCellKey(cx, cy));
+            if (it == cells.end()) continue;
+            for (std::uint32_t index : it->second) {
+                if (visitStamps[index] != currentStamp) {
+                    visitStamps[index] = currentStamp;
+                    candidates.push_back(index);
+                }
+            }
+        }
+    }
+    candidates.insert(candidates.end(), oversizedEntries.begin(), oversizedEntries.end());
+
+    // Level order, like the linear loops this replaces
+    std::sort(candidates.begin(), candidates.end());
+}
@@ -2,10 +2,12 @@
 
 #include "world/LevelLoader.h"
 #include "world/Platform.h"
+#include "physics/PlatformIndex.h"
 #include "core/Config.h"
 
 #include <algorithm>
 #include <cctype>
+#include <vector>
 
 namespace {
 
@@ -28,6 +30,14 @@ std::string cleanDirectionString(const std::string& direction) {
     return cleaned;
 }
 
+// Platforms overlapping the vertical band [minX, maxX] (whole level height)
+std::vector<Platform*> platformsInColumn(const PlatformIndex& platforms, float minX, float maxX) {
+    const sf::FloatRect& levelBounds = platforms.getBounds();
+    std::vector<Platform*> result;
+    platforms.query(sf::FloatRect(minX, levelBounds.top - 1.0f, maxX - minX, levelBounds.height + 2.0f), result);
+    return result;
+}
+
 sf::Vector2f defaultSpawnFromLevel(const LevelData* level) {
     if (!level) {
         return sf::Vector2f(100.0f, 400.0f);
@@ -47,7 +57,7 @@ PortalSpawnResult PortalSpawner::computeSpawn(const std::string& pendingDirectio
                                               bool useCustomSpawn,
                                               const sf::Vector2f& customSpawnPos,
                                               const LevelData* level,
-                                              const std::vector<std::unique_ptr<Platform>>& platforms) {
+                                              const PlatformIndex& platforms) {
     PortalSpawnResult result;
 
     if (useCustomSpawn) {
@@ -75,8 +85,7 @@ PortalSpawnResult PortalSpawner::computeSpawn(const std::string& pendingDirectio
         float bestY = (direction == "lefttop") ? 10000.0f : -10000.0f;
         bool foundPlatform = false;
 
-        for (const auto& platform : platforms) {
-            if (!platform) continue;
+        for (Platform* platform : platformsInColumn(platforms, spawnPos.x - 51.0f, spawnPos.x + 51.0f)) {
             sf::FloatRect bounds = platform->getBounds();
             if (spawnPos.x >= bounds.left - 50.0f && spawnPos.x <= bounds.left + bounds.width + 50.0f) {
                 float platformTop = bounds.top;
@@ -113,15 +122,16 @@ PortalSpawnResult PortalSpawner::computeSpawn(const std::string& pendingDirectio
         float chosenRight = zone.minX;
         float chosenTop = zone.maxY;
 
-        for (const auto& platform : platforms) {
-            if (!platform) continue;
+        if (platforms.size() > 0) {
+            const sf::FloatRect& levelBounds = platforms.getBounds();
+            rightmostPlatform = std::max(rightmostPlatform, levelBounds.left + levelBounds.width);
+        }
+
+        // Only platforms reaching the right edge of the zone can be picked
+        for (Platform* platform : platformsInColumn(platforms, zone.maxX - 201.0f, rightmostPlatform + 1.0f)) {
             sf::FloatRect bounds = platform->getBounds();
             float platformRight = bounds.left + bounds.width;
 
-            if (platformRight > rightmostPlatform) {
-                rightmostPlatform = platformRight;
-            }
-
             if (platformRight >= zone.maxX - 200.0f) {
                 float platformTop = bounds.top;
                 if (direction == "righttop") {
@@ -150,8 +160,7 @@ PortalSpawnResult PortalSpawner::computeSpawn(const std::string& pendingDirectio
         }
 
         if (!foundPlatform) {
-            for (const auto& platform : platforms) {
-                if (!platform) continue;
+            for (Platform* platform : platformsInColumn(platforms, spawnPos.x - 51.0f, spawnPos.x + 51.0f)) {
                 sf::FloatRect bounds = platform->getBounds();
                 float platformRight = bounds.left + bounds.width;
 
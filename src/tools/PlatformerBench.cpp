@@ -0,0 +1,526 @@
+// PlatformerBench: micro and macro benchmarks on synthetic worlds.
+// Prints one JSON document on stdout (fixed key order) so runs can be diffed
+// between commits; progress goes to stderr.
+#include "world/World.h"
+#include "world/LevelLoader.h"
+#include "world/LevelCache.h"
+#include "world/LevelBinary.h"
+#include "world/Platform.h"
+#include "entities/Player.h"
+#include "entities/PatrolEnemy.h"
+#include "entities/FlyingEnemy.h"
+#include "entities/Spike.h"
+#include "entities/FlameTrap.h"
+#include "entities/RotatingTrap.h"
+#include "entities/EnemyProjectile.h"
+#include "entities/EnemyStatsPresets.h"
+#include "effects/ParticleSystem.h"
+#include "physics/CollisionSystem.h"
+#include "physics/EnemyGrid.h"
+#include "graphics/SpriteManager.h"
+#include "core/Config.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+struct BenchOptions {
+    std::string levelPath = "assets/levels/zone1_level1.json";
+    std::string filter;
+    std::string outPath;
+    unsigned int seed = 1;
+    int iterations = 30;
+    // Synthetic world size
+    int platforms = 10000;
+    int enemies = 1000;
+    int projectiles = 5000;
+    int particles = 50000;
+};
+
+// Keeps the optimizer from discarding benchmark bodies
+volatile long long benchSink = 0;
+
+struct BenchResult {
+    std::string name;
+    int iterations = 0;
+    long long opsPerIteration = 0;
+    double medianNs = 0.0;   // Median wall time of one iteration
+    double minNs = 0.0;
+};
+
+void printUsage() {
+    std::cout << "Usage: PlatformerBench [options]\n"
+              << "  --filter <text>      Only run benchmarks whose name contains <text>\n"
+              << "  --iterations <n>     Timed iterations per benchmark (default 30)\n"
+              << "  --quick              Smaller worlds and fewer iterations (smoke test)\n"
+              << "  --particles <n>      Live particles for particle_update / world_update (default 50000)\n"
+              << "  --level <path>       Level JSON for the loader benchmarks\n"
+              << "  --seed <n>           Seed for the synthetic worlds (default 1)\n"
+              << "  --out <file>         Also write the JSON report to <file>\n";
+}
+
+bool parseArgs(int argc, char** argv, BenchOptions& options) {
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        auto next = [&](std::string& out) -> bool {
+            if (i + 1 >= argc) {
+                std::cerr << "Missing value for " << arg << "\n";
+                return false;
+            }
+            out = argv[++i];
+            return true;
+        };
+
+        std::string value;
+        if (arg == "--help" || arg == "-h") {
+            printUsage();
+            std::exit(EXIT_SUCCESS);
+        } else if (arg == "--quick") {
+            options.iterations = 5;
+            options.platforms = 1000;
+            options.enemies = 100;
+            options.projectiles = 500;
+            options.particles = 5000;
+        } else if (arg == "--filter") {
+            if (!next(options.filter)) return false;
+        } else if (arg == "--iterations") {
+            if (!next(value)) return false;
+            options.iterations = std::atoi(value.c_str());
+        } else if (arg == "--particles") {
+            if (!next(value)) return false;
+            options.particles = std::atoi(value.c_str());
+        } else if (arg == "--level") {
+            if (!next(options.levelPath)) return false;
+        } else if (arg == "--seed") {
+            if (!next(value)) return false;
+            options.seed = static_cast<unsigned int>(std::strtoul(value.c_str(), nullptr, 10));
+        } else if (arg == "--out") {
+            if (!next(options.outPath)) return false;
+        } else {
+            std::cerr << "Unknown option: " << arg << "\n";
+            printUsage();
+            return false;
+        }
+    }
+
+    if (options.iterations <= 0) {
+        std::cerr << "--iterations must be positive\n";
+        return false;
+    }
+    if (options.particles <= 0) {
+        std::cerr << "--particles must be positive\n";
+        return false;
+    }
+    return true;
+}
+
+// Times `body` once per iteration after one untimed warm-up.
+// `setup` runs before each iteration and is not timed.
+BenchResult measure(const std::string& name, int iterations, long long opsPerIteration,
+                    const std::function<void()>& setup, const std::function<void()>& body) {
+    BenchResult result;
+    result.name = name;
+    result.iterations = iterations;
+    result.opsPerIteration = opsPerIteration;
+
+    if (setup) setup();
+    body();
+
+    std::vector<double> samples;
+    samples.reserve(static_cast<std::size_t>(iterations));
+    for (int i = 0; i < iterations; ++i) {
+        if (setup) setup();
+        auto start = std::chrono::steady_clock::now();
+        body();
+        auto end = std::chrono::steady_clock::now();
+        samples.push_back(std::chrono::duration<double, std::nano>(end - start).count());
+    }
+
+    std::sort(samples.begin(), samples.end());
+    result.medianNs = samples[samples.size() / 2];
+    result.minNs = samples.front();
+    return result;
+}
+
+// Synthetic level: rows of platforms with enemies scattered over the same area
+std::vector<std::unique_ptr<Platform>> makePlatforms(int count, std::mt19937& rng) {
+    std::uniform_real_distribution<float> width(64.0f, 256.0f);
+    std::vector<std::unique_ptr<Platform>> platforms;
+    platforms.reserve(static_cast<std::size_t>(count));
+
+    const int perRow = 100;
+    for (int i = 0; i < count; ++i) {
+        const float x = static_cast<float>(i % perRow) * 320.0f;
+        const float y = static_cast<float>(i / perRow) * 160.0f;
+        platforms.push_back(std::make_unique<Platform>(x, y, width(rng), Config::PLATFORM_HEIGHT));
+    }
+    return platforms;
+}
+
+std::vector<std::unique_ptr<Enemy>> makeEnemies(int count, std::mt19937& rng) {
+    std::uniform_real_distribution<float> posX(0.0f, 32000.0f);
+    std::uniform_real_distribution<float> posY(0.0f, 16000.0f);
+    std::vector<std::unique_ptr<Enemy>> enemies;
+    enemies.reserve(static_cast<std::size_t>(count));
+
+    for (int i = 0; i < count; ++i) {
+        const float x = posX(rng);
+        const float y = posY(rng);
+        switch (i % 5) {
+            case 0: enemies.push_back(std::make_unique<PatrolEnemy>(x, y, 150.0f, EnemyPresets::Basic())); break;
+            case 1: enemies.push_back(std::make_unique<FlyingEnemy>(x, y, 150.0f, (i % 2) == 0, EnemyPresets::Medium())); break;
+            case 2: enemies.push_back(std::make_unique<Spike>(x, y)); break;
+            case 3: enemies.push_back(std::make_unique<FlameTrap>(x, y, EnemyPresets::Basic())); break;
+            default: enemies.push_back(std::make_unique<RotatingTrap>(x, y, EnemyPresets::Basic())); break;
+        }
+    }
+    return enemies;
+}
+
+void fillParticles(ParticleSystem& particles, int count, std::mt19937& rng) {
+    std::uniform_real_distribution<float> pos(0.0f, 2000.0f);
+    // emitDeath spawns 50 particles per call
+    for (int emitted = 0; emitted < count; emitted += 50) {
+        particles.emitDeath(sf::Vector2f(pos(rng), pos(rng)));
+    }
+}
+
+// Live count after a fill, on stderr with the progress lines (once per case)
+void reportParticleFill(const std::string& name, const ParticleSystem& particles, int requested) {
+    static std::string reported;
+    if (reported == name) return;
+    reported = name;
+    std::cerr << name << ": " << particles.getParticleCount() << " live particles (requested " << requested
+              << ", capacity " << particles.getCapacity() << ")\n";
+}
+
+BenchResult benchCollisionSweep(const BenchOptions& options) {
+    std::mt19937 rng(options.seed);
+    std::vector<sf::FloatRect> rects;
+    for (const auto& platform : makePlatforms(options.platforms, rng)) {
+        rects.push_back(platform->getBounds());
+    }
+
+    // One sweep = the player's AABB tested against every platform, as World does each tick
+    int hits = 0;
+    auto body = [&]() {
+        for (const sf::FloatRect& rect : rects) {
+            sf::FloatRect player(rect.left + 8.0f, rect.top - Config::PLAYER_HEIGHT + 4.0f,
+                                 Config::PLAYER_WIDTH, Config::PLAYER_HEIGHT);
+            sf::Vector2f velocity(0.0f, 200.0f);
+            bool grounded = false;
+            if (CollisionSystem::resolveCollision(player, velocity, rect, grounded)) {
+                hits++;
+            }
+        }
+    };
+    BenchResult result = measure("collision_sweep", options.iterations, static_cast<long long>(rects.size()), nullptr, body);
+    if (hits == 0) std::cerr << "collision_sweep: no contacts (unexpected)\n";
+    return result;
+}
+
+// Fast movers (dash / long fall at 60 Hz) over a stack of thin platforms.
+// Substepping needs several discrete passes per tick and still misses contacts the sweep finds.
+BenchResult benchFastMovers(const BenchOptions& options, int substeps, const std::string& name) {
+    std::mt19937 rng(options.seed);
+    std::vector<sf::FloatRect> obstacles;
+    for (int i = 0; i < 8; ++i) {
+        obstacles.emplace_back(0.0f, 200.0f * static_cast<float>(i + 1), 2000.0f, 8.0f);
+    }
+
+    struct Mover {
+        sf::FloatRect start;
+        sf::Vector2f displacement;
+    };
+    std::uniform_real_distribution<float> posX(100.0f, 1800.0f);
+    std::uniform_real_distribution<float> posY(0.0f, 1500.0f);
+    std::uniform_real_distribution<float> dispX(-60.0f, 60.0f);
+    std::uniform_real_distribution<float> dispY(60.0f, 180.0f);
+    std::vector<Mover> movers(static_cast<std::size_t>(options.projectiles));
+    for (Mover& mover : movers) {
+        // Start in free space: only contacts made during the move count
+        bool overlapping = true;
+        while (overlapping) {
+            mover.start = sf::FloatRect(posX(rng), posY(rng), Config::PLAYER_WIDTH, Config::PLAYER_HEIGHT);
+            overlapping = std::any_of(obstacles.begin(), obstacles.end(),
+                [&](const sf::FloatRect& obstacle) { return obstacle.intersects(mover.start); });
+        }
+        mover.displacement = sf::Vector2f(dispX(rng), dispY(rng));
+    }
+
+    long long contacts = 0;
+    auto body = [&]() {
+        contacts = 0;
+        for (const Mover& mover : movers) {
+            sf::FloatRect rect = mover.start;
+            sf::Vector2f velocity = mover.displacement * static_cast<float>(Config::SIMULATION_TICK_RATE);
+            bool grounded = false;
+            if (substeps == 0) {
+                CollisionSystem::moveAndSlide(rect, velocity, mover.displacement, obstacles, grounded);
+            } else {
+                const sf::Vector2f step = mover.displacement / static_cast<float>(substeps);
+                for (int i = 0; i < substeps; ++i) {
+                    rect.left += step.x;
+                    rect.top += step.y;
+                    for (const sf::FloatRect& obstacle : obstacles) {
+                        CollisionSystem::resolveCollision(rect, velocity, obstacle, grounded);
+                    }
+                }
+            }
+            if (grounded) contacts++;
+        }
+        benchSink = benchSink + contacts;
+    };
+    BenchResult result = measure(name, options.iterations, static_cast<long long>(movers.size()), nullptr, body);
+    std::cerr << name << ": " << contacts << " landings out of " << movers.size() << "\n";
+    return result;
+}
+
+BenchResult benchEnemyGridSync(const BenchOptions& options) {
+    std::mt19937 rng(options.seed);
+    std::vector<std::unique_ptr<Enemy>> enemies = makeEnemies(options.enemies, rng);
+    EnemyGrid grid;
+    grid.sync(enemies);
+
+    // Each iteration moves every enemy by one tick of walking speed, like a real frame
+    const float step = 100.0f / static_cast<float>(Config::SIMULATION_TICK_RATE);
+    return measure("enemy_grid_sync", options.iterations, static_cast<long long>(enemies.size()),
+        [&]() {
+            for (auto& enemy : enemies) {
+                enemy->setPosition(enemy->getPosition().x + step, enemy->getPosition().y);
+            }
+        },
+        [&]() {
+            grid.sync(enemies);
+        });
+}
+
+BenchResult benchEnemyGridQuery(const BenchOptions& options) {
+    std::mt19937 rng(options.seed);
+    std::vector<std::unique_ptr<Enemy>> enemies = makeEnemies(options.enemies, rng);
+    EnemyGrid grid;
+    grid.sync(enemies);
+    std::vector<Enemy*> nearby;
+
+    std::uniform_real_distribution<float> posX(0.0f, 32000.0f);
+    std::uniform_real_distribution<float> posY(0.0f, 16000.0f);
+    std::vector<sf::Vector2f> queries;
+    for (int i = 0; i < options.projectiles; ++i) {
+        queries.emplace_back(posX(rng), posY(rng));
+    }
+
+    BenchResult result = measure("enemy_grid_query", options.iterations, static_cast<long long>(queries.size()), nullptr, [&]() {
+        for (const sf::Vector2f& query : queries) {
+            grid.query(sf::FloatRect(query.x - 41.0f, query.y - 41.0f, 82.0f, 82.0f), nearby);
+            benchSink = benchSink + static_cast<long long>(nearby.size());
+        }
+    });
+    return result;
+}
+
+BenchResult benchParticleUpdate(const BenchOptions& options) {
+    std::mt19937 rng(options.seed);
+    // Room for the whole fill without hitting the emitter budget
+    ParticleSystem particles(static_cast<std::size_t>(options.particles) * 2);
+    const float dt = 1.0f / static_cast<float>(Config::SIMULATION_TICK_RATE);
+
+    return measure("particle_update", options.iterations, options.particles,
+        [&]() {
+            particles.clear();
+            fillParticles(particles, options.particles, rng);
+            reportParticleFill("particle_update", particles, options.particles);
+        },
+        [&]() {
+            particles.update(dt);
+        });
+}
+
+BenchResult benchWorldUpdate(const BenchOptions& options) {
+    std::mt19937 rng(options.seed);
+    // Same headroom as particle_update: the default PARTICLE_CAPACITY would cap the fill
+    World world(static_cast<std::size_t>(options.particles) * 2);
+
+    auto level = std::make_unique<LevelData>();
+    level->name = "bench";
+    level->zoneNumber = 1;
+    level->isBossLevel = false;
+    level->startPosition = sf::Vector2f(100.0f, -200.0f);
+    level->platforms = makePlatforms(options.platforms, rng);
+    level->enemies = makeEnemies(options.enemies, rng);
+    world.setLevel(std::move(level));
+
+    world.addPlayer(std::make_unique<Player>(100.0f, -200.0f, CharacterType::Lyra));
+    world.setActivePlayerIndex(0);
+
+    // Enemy projectiles fly above the level so they stay alive for the whole run
+    std::uniform_real_distribution<float> posX(0.0f, 32000.0f);
+    for (int i = 0; i < options.projectiles; ++i) {
+        world.getEnemyProjectiles().push_back(std::make_unique<EnemyProjectile>(
+            sf::Vector2f(posX(rng), -4000.0f - static_cast<float>(i % 50) * 20.0f),
+            sf::Vector2f(1.0f, 0.0f), 50.0f, 1.0e9f));
+    }
+
+    const float dt = 1.0f / static_cast<float>(Config::SIMULATION_TICK_RATE);
+    return measure("world_update", options.iterations, 1,
+        [&]() {
+            world.getParticleSystem().clear();
+            fillParticles(world.getParticleSystem(), options.particles, rng);
+            reportParticleFill("world_update", world.getParticleSystem(), options.particles);
+        },
+        [&]() {
+            world.update(dt);
+        });
+}
+
+// `cached`: Parser::Auto loads after the first one come from LevelCache (revisits, respawns)
+BenchResult benchLevelLoad(const BenchOptions& options, const std::string& path, LevelLoader::Parser parser,
+                           const std::string& name, bool cached = false) {
+    std::function<void()> setup;
+    if (!cached) {
+        setup = []() { LevelCache::getInstance().clear(); };
+    }
+    return measure(name, options.iterations, 1, setup, [&]() {
+        std::unique_ptr<LevelData> level = LevelLoader::loadFromFile(path, parser);
+        if (!level) std::cerr << name << ": load failed\n";
+    });
+}
+
+// Same level compiled to .lvlb (in the temp directory, next to a copy of its JSON)
+BenchResult benchLevelLoadBinary(const BenchOptions& options) {
+    namespace fs = std::filesystem;
+    const fs::path source = LevelLoader::resolveLevelPath(options.levelPath);
+    const fs::path copy = fs::temp_directory_path() / ("platformer_bench_" + source.filename().string());
+    std::error_code ec;
+    fs::copy_file(source, copy, fs::copy_options::overwrite_existing, ec);
+    if (ec || !LevelLoader::compileLevel(copy.string(), LevelBinary::pathFor(copy.string()))) {
+        throw std::runtime_error("could not compile " + source.string());
+    }
+
+    // The copy must really come from its .lvlb, not from the JSON next to it
+    LevelCache::getInstance().clear();
+    const char* label = nullptr;
+    if (!LevelLoader::loadTemplate(copy.string(), LevelLoader::Parser::Auto, label) ||
+        !label || std::string(label) != "binary") {
+        fs::remove(copy, ec);
+        fs::remove(LevelBinary::pathFor(copy.string()), ec);
+        throw std::runtime_error("compiled level not loaded for " + copy.string() +
+                                 " (source: " + (label ? label : "built-in reader") + ")");
+    }
+
+    BenchResult result = benchLevelLoad(options, copy.string(), LevelLoader::Parser::Auto, "level_load_binary");
+    fs::remove(copy, ec);
+    fs::remove(LevelBinary::pathFor(copy.string()), ec);
+    return result;
+}
+
+void writeReport(std::ostream& out, const BenchOptions& options, const std::vector<BenchResult>& results) {
+    out << std::fixed;
+    out << "{\n";
+    out << "  \"schema\": 1,\n";
+    out << "  \"config\": {\n";
+    out << "    \"seed\": " << options.seed << ",\n";
+    out << "    \"iterations\": " << options.iterations << ",\n";
+    out << "    \"platforms\": " << options.platforms << ",\n";
+    out << "    \"enemies\": " << options.enemies << ",\n";
+    out << "    \"projectiles\": " << options.projectiles << ",\n";
+    out << "    \"particles\": " << options.particles << ",\n";
+    out << "    \"json_library\": " << (LevelLoader::hasJsonLibrary() ? "true" : "false") << "\n";
+    out << "  },\n";
+    out << "  \"benchmarks\": [\n";
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        const BenchResult& r = results[i];
+        const double nsPerOp = r.opsPerIteration > 0 ? r.medianNs / static_cast<double>(r.opsPerIteration) : 0.0;
+        const double fps = r.medianNs > 0.0 ? 1.0e9 / r.medianNs : 0.0;
+        out << "    {\"name\": \"" << r.name << "\""
+            << ", \"iterations\": " << r.iterations
+            << ", \"ops_per_iteration\": " << r.opsPerIteration
+            << ", \"ns_per_op\": " << std::setprecision(2) << nsPerOp
+            << ", \"median_ms\": " << std::setprecision(4) << r.medianNs / 1.0e6
+            << ", \"min_ms\": " << r.minNs / 1.0e6
+            << ", \"fps\": " << std::setprecision(1) << fps << "}"
+            << (i + 1 < results.size() ? ",\n" : "\n");
+    }
+    out << "  ]\n";
+    out << "}\n";
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    BenchOptions options;
+    if (!parseArgs(argc, argv, options)) {
+        return EXIT_FAILURE;
+    }
+
+    // No window means no GL context: never create textures
+    SpriteManager::getInstance().setHeadless(true);
+
+    const std::string levelPath = LevelLoader::resolveLevelPath(options.levelPath);
+    struct Entry {
+        std::string name;
+        std::function<BenchResult()> run;
+    };
+    std::vector<Entry> entries = {
+        {"collision_sweep", [&]() { return benchCollisionSweep(options); }},
+        {"fast_movers_move_and_slide", [&]() { return benchFastMovers(options, 0, "fast_movers_move_and_slide"); }},
+        {"fast_movers_substep_x8", [&]() { return benchFastMovers(options, 8, "fast_movers_substep_x8"); }},
+        {"enemy_grid_sync", [&]() { return benchEnemyGridSync(options); }},
+        {"enemy_grid_query", [&]() { return benchEnemyGridQuery(options); }},
+        {"particle_update", [&]() { return benchParticleUpdate(options); }},
+        {"world_update", [&]() { return benchWorldUpdate(options); }},
+        {"level_load_legacy", [&]() { return benchLevelLoad(options, levelPath, LevelLoader::Parser::Legacy, "level_load_legacy"); }},
+        {"level_load_binary", [&]() { return benchLevelLoadBinary(options); }},
+        {"level_load_cached", [&]() { return benchLevelLoad(options, levelPath, LevelLoader::Parser::Auto, "level_load_cached", true); }},
+    };
+    if (LevelLoader::hasJsonLibrary()) {
+        entries.push_back({"level_load_json", [&]() { return benchLevelLoad(options, levelPath, LevelLoader::Parser::Json, "level_load_json"); }});
+    }
+
+    // Level loading and entities print to std::cout; keep stdout for the report only
+    std::ostringstream discarded;
+    std::streambuf* consoleBuffer = std::cout.rdbuf();
+
+    std::vector<BenchResult> results;
+    try {
+        for (const Entry& entry : entries) {
+            if (!options.filter.empty() && entry.name.find(options.filter) == std::string::npos) {
+                continue;
+            }
+            std::cerr << "running " << entry.name << "...\n";
+            std::cout.rdbuf(discarded.rdbuf());
+            results.push_back(entry.run());
+            std::cout.rdbuf(consoleBuffer);
+            discarded.str("");
+        }
+    }
+    catch (const std::exception& e) {
+        std::cout.rdbuf(consoleBuffer);
+        std::cerr << "Error: " << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    writeReport(std::cout, options, results);
+
+    if (!options.outPath.empty()) {
+        std::ofstream file(options.outPath);
+        if (!file.is_open()) {
+            std::cerr << "Error: could not write " << options.outPath << "\n";
+            return EXIT_FAILURE;
+        }
+        writeReport(file, options, results);
+    }
+
+    return EXIT_SUCCESS;
+}
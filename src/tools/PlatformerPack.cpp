@@ -0,0 +1,265 @@
+// PlatformerPack: offline asset baker.
+// Walks the assets directory, decodes every PNG to RGBA8 and writes one pack file
+// (header, index, aligned data blobs) that the game memory-maps at startup (AssetPack).
+// Level JSON files are first compiled to .lvlb next to their source (LevelBinary); levels
+// (both forms) and sounds are stored as-is; source files (.ase, .gpl, .zip, .md) are skipped.
+#include "core/AssetPack.h"
+#include "world/LevelBinary.h"
+#include "world/LevelLoader.h"
+#include <SFML/Graphics.hpp>
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+namespace fs = std::filesystem;
+
+struct PackOptions {
+    std::string assetsDir = "assets";
+    std::string outputPath = "assets.pack";
+    bool levelsOnly = false;   // Compile the levels, write no pack
+};
+
+struct PackItem {
+    std::string key;   // Loose path as the game asks for it ("assets/levels/zone1_level1.json")
+    AssetPack::EntryType type = AssetPack::EntryType::Raw;
+    std::uint32_t width = 0;
+    std::uint32_t height = 0;
+    std::vector<std::uint8_t> bytes;
+};
+
+void printUsage() {
+    std::cout << "Usage: PlatformerPack [options]\n"
+              << "  --assets <dir>   Asset directory to bake (default assets)\n"
+              << "  --out <file>     Pack file to write (default assets.pack)\n"
+              << "  --levels-only    Only compile level JSON files to .lvlb\n";
+}
+
+bool parseArgs(int argc, char** argv, PackOptions& options) {
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        auto next = [&](std::string& out) -> bool {
+            if (i + 1 >= argc) {
+                std::cerr << "Missing value for " << arg << "\n";
+                return false;
+            }
+            out = argv[++i];
+            return true;
+        };
+
+        if (arg == "--help" || arg == "-h") {
+            printUsage();
+            std::exit(EXIT_SUCCESS);
+        } else if (arg == "--assets") {
+            if (!next(options.assetsDir)) return false;
+        } else if (arg == "--out") {
+            if (!next(options.outputPath)) return false;
+        } else if (arg == "--levels-only") {
+            options.levelsOnly = true;
+        } else {
+            std::cerr << "Unknown option: " << arg << "\n";
+            printUsage();
+            return false;
+        }
+    }
+    return true;
+}
+
+std::string lowerExtension(const fs::path& path) {
+    std::string ext = path.extension().string();
+    std::transform(ext.begin(), ext.end(), ext.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return ext;
+}
+
+bool readFile(const fs::path& path, std::vector<std::uint8_t>& out) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) {
+        return false;
+    }
+    out.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    return true;
+}
+
+bool collectItems(const PackOptions& options, std::vector<PackItem>& items) {
+    const fs::path root(options.assetsDir);
+    std::error_code ec;
+    if (!fs::is_directory(root, ec)) {
+        std::cerr << "Error: not a directory: " << options.assetsDir << "\n";
+        return false;
+    }
+
+    // Keys keep the directory name ("assets/..."), like the paths used in code
+    const fs::path base = fs::absolute(root).lexically_normal().parent_path();
+
+    for (const auto& file : fs::recursive_directory_iterator(root)) {
+        if (!file.is_regular_file()) continue;
+
+        const std::string ext = lowerExtension(file.path());
+        const bool image = ext == ".png";
+        const bool raw = ext == ".json" || ext == LevelBinary::EXTENSION || ext == ".wav" || ext == ".ogg" || ext == ".flac";
+        if (!image && !raw) continue;
+
+        PackItem item;
+        item.key = AssetPack::normalizeKey(
+            fs::absolute(file.path()).lexically_normal().lexically_relative(base).generic_string());
+
+        if (image) {
+            sf::Image decoded;
+            if (!decoded.loadFromFile(file.path().string())) {
+                std::cerr << "Warning: skipping unreadable image " << file.path().string() << "\n";
+                continue;
+            }
+            item.type = AssetPack::EntryType::Image;
+            item.width = decoded.getSize().x;
+            item.height = decoded.getSize().y;
+            const std::uint8_t* pixels = decoded.getPixelsPtr();
+            item.bytes.assign(pixels, pixels + static_cast<std::size_t>(item.width) * item.height * 4);
+        } else if (!readFile(file.path(), item.bytes)) {
+            std::cerr << "Warning: skipping unreadable file " << file.path().string() << "\n";
+            continue;
+        }
+        items.push_back(std::move(item));
+    }
+
+    // Stable output for identical inputs
+    std::sort(items.begin(), items.end(),
+              [](const PackItem& a, const PackItem& b) { return a.key < b.key; });
+    return true;
+}
+
+// Every JSON file under a "levels" directory -> .lvlb beside it
+bool compileLevels(const PackOptions& options, std::size_t& compiled) {
+    compiled = 0;
+    std::error_code ec;
+    if (!fs::is_directory(options.assetsDir, ec)) {
+        std::cerr << "Error: not a directory: " << options.assetsDir << "\n";
+        return false;
+    }
+
+    // The loader prints every platform it reads; only errors matter here
+    std::ostringstream discarded;
+    std::streambuf* consoleBuffer = std::cout.rdbuf(discarded.rdbuf());
+
+    bool ok = true;
+    for (const auto& file : fs::recursive_directory_iterator(options.assetsDir)) {
+        if (!file.is_regular_file() || lowerExtension(file.path()) != ".json" ||
+            file.path().parent_path().filename() != "levels") {
+            continue;
+        }
+        const std::string source = file.path().string();
+        if (LevelLoader::compileLevel(source, LevelBinary::pathFor(source))) {
+            compiled++;
+        } else {
+            std::cerr << "Error: could not compile level " << source << "\n" << discarded.str();
+            ok = false;
+        }
+        discarded.str("");
+    }
+
+    std::cout.rdbuf(consoleBuffer);
+    return ok;
+}
+
+std::uint64_t alignUp(std::uint64_t value) {
+    const std::uint64_t mask = AssetPack::DATA_ALIGNMENT - 1;
+    return (value + mask) & ~mask;
+}
+
+bool writePack(const std::string& path, const std::vector<PackItem>& items, std::uint64_t& totalBytes) {
+    // Data starts after the index; every blob is aligned for direct GPU uploads / loads
+    std::uint64_t cursor = sizeof(AssetPack::Header);
+    for (const PackItem& item : items) {
+        cursor += sizeof(AssetPack::IndexEntry) + item.key.size();
+    }
+
+    std::vector<AssetPack::IndexEntry> index;
+    index.reserve(items.size());
+    for (const PackItem& item : items) {
+        cursor = alignUp(cursor);
+        AssetPack::IndexEntry entry;
+        entry.offset = cursor;
+        entry.size = item.bytes.size();
+        entry.type = static_cast<std::uint32_t>(item.type);
+        entry.width = item.width;
+        entry.height = item.height;
+        entry.nameLength = static_cast<std::uint32_t>(item.key.size());
+        index.push_back(entry);
+        cursor += entry.size;
+    }
+    totalBytes = cursor;
+
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out.is_open()) {
+        std::cerr << "Error: cannot write " << path << "\n";
+        return false;
+    }
+
+    AssetPack::Header header;
+    header.magic = AssetPack::MAGIC;
+    header.version = AssetPack::VERSION;
+    header.entryCount = static_cast<std::uint32_t>(items.size());
+    header.reserved = 0;
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    for (std::size_t i = 0; i < items.size(); ++i) {
+        out.write(reinterpret_cast<const char*>(&index[i]), sizeof(AssetPack::IndexEntry));
+        out.write(items[i].key.data(), static_cast<std::streamsize>(items[i].key.size()));
+    }
+
+    const char zeros[AssetPack::DATA_ALIGNMENT] = {};
+    std::uint64_t written = static_cast<std::uint64_t>(out.tellp());
+    for (std::size_t i = 0; i < items.size(); ++i) {
+        out.write(zeros, static_cast<std::streamsize>(index[i].offset - written));
+        out.write(reinterpret_cast<const char*>(items[i].bytes.data()),
+                  static_cast<std::streamsize>(items[i].bytes.size()));
+        written = index[i].offset + index[i].size;
+    }
+
+    return static_cast<bool>(out);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    PackOptions options;
+    if (!parseArgs(argc, argv, options)) {
+        return EXIT_FAILURE;
+    }
+
+    std::size_t levels = 0;
+    if (!compileLevels(options, levels)) {
+        return EXIT_FAILURE;
+    }
+    if (options.levelsOnly) {
+        std::cout << "Compiled " << levels << " levels\n";
+        return EXIT_SUCCESS;
+    }
+
+    std::vector<PackItem> items;
+    if (!collectItems(options, items)) {
+        return EXIT_FAILURE;
+    }
+
+    std::uint64_t totalBytes = 0;
+    if (!writePack(options.outputPath, items, totalBytes)) {
+        return EXIT_FAILURE;
+    }
+
+    std::size_t images = 0;
+    for (const PackItem& item : items) {
+        if (item.type == AssetPack::EntryType::Image) images++;
+    }
+    std::cout << "Wrote " << options.outputPath << ": " << items.size() << " entries ("
+              << images << " images, " << levels << " compiled levels), " << totalBytes / 1024 << " KiB\n";
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,314 @@
+// PlatformerSim: headless level playthroughs.
+// Steps the World as fast as the CPU allows (no window, no GL, no audio)
+// and reports simulation throughput in frames/second.
+#include "world/World.h"
+#include "world/LevelLoader.h"
+#include "world/Checkpoint.h"
+#include "entities/Player.h"
+#include "entities/Enemy.h"
+#include "systems/PortalSpawner.h"
+#include "graphics/SpriteManager.h"
+#include "core/Config.h"
+#include "core/AssetPack.h"
+#include <chrono>
+#include <cstdlib>
+#include <exception>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+
+namespace {
+
+struct SimOptions {
+    std::string levelPath = "assets/levels/zone1_level1.json";
+    std::string packPath;   // Empty: loose level files
+    long long frames = 3600;
+    int runs = 1;
+    float dt = 1.0f / static_cast<float>(Config::SIMULATION_TICK_RATE);
+    std::string script = "runner";   // idle | runner | random
+    unsigned int seed = 1;
+    CharacterType character = CharacterType::Lyra;
+    bool quiet = true;
+};
+
+struct RunStats {
+    long long frames = 0;
+    double seconds = 0.0;
+    int deaths = 0;
+    int checkpoints = 0;
+    int portals = 0;
+    std::string finalLevel;
+    sf::Vector2f finalPosition;
+};
+
+void printUsage() {
+    std::cout << "Usage: PlatformerSim [options]\n"
+              << "  --level <path>       Level JSON to start from (default assets/levels/zone1_level1.json)\n"
+              << "  --frames <n>         Frames to simulate per run (default 3600)\n"
+              << "  --runs <n>           Number of playthroughs (default 1)\n"
+              << "  --dt <seconds>       Fixed step per frame (default 1/" << Config::SIMULATION_TICK_RATE << ")\n"
+              << "  --input <script>     idle | runner | random (default runner)\n"
+              << "  --seed <n>           Seed for the random script (run i uses seed + i)\n"
+              << "  --character <name>   lyra | noah | sera (default lyra)\n"
+              << "  --pack <file>        Read levels from a baked asset pack (PlatformerPack)\n"
+              << "  --verbose            Keep level loader / gameplay logs\n";
+}
+
+bool parseArgs(int argc, char** argv, SimOptions& options) {
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        auto next = [&](std::string& out) -> bool {
+            if (i + 1 >= argc) {
+                std::cerr << "Missing value for " << arg << "\n";
+                return false;
+            }
+            out = argv[++i];
+            return true;
+        };
+
+        std::string value;
+        if (arg == "--help" || arg == "-h") {
+            printUsage();
+            std::exit(EXIT_SUCCESS);
+        } else if (arg == "--verbose") {
+            options.quiet = false;
+        } else if (arg == "--level") {
+            if (!next(options.levelPath)) return false;
+        } else if (arg == "--pack") {
+            if (!next(options.packPath)) return false;
+        } else if (arg == "--frames") {
+            if (!next(value)) return false;
+            options.frames = std::atoll(value.c_str());
+        } else if (arg == "--runs") {
+            if (!next(value)) return false;
+            options.runs = std::atoi(value.c_str());
+        } else if (arg == "--dt") {
+            if (!next(value)) return false;
+            options.dt = static_cast<float>(std::atof(value.c_str()));
+        } else if (arg == "--input") {
+            if (!next(options.script)) return false;
+        } else if (arg == "--seed") {
+            if (!next(value)) return false;
+            options.seed = static_cast<unsigned int>(std::strtoul(value.c_str(), nullptr, 10));
+        } else if (arg == "--character") {
+            if (!next(value)) return false;
+            if (value == "lyra") options.character = CharacterType::Lyra;
+            else if (value == "noah") options.character = CharacterType::Noah;
+            else if (value == "sera") options.character = CharacterType::Sera;
+            else {
+                std::cerr << "Unknown character: " << value << "\n";
+                return false;
+            }
+        } else {
+            std::cerr << "Unknown option: " << arg << "\n";
+            printUsage();
+            return false;
+        }
+    }
+
+    if (options.frames <= 0 || options.runs <= 0 || options.dt <= 0.0f) {
+        std::cerr << "--frames, --runs and --dt must be positive\n";
+        return false;
+    }
+    if (options.script != "idle" && options.script != "runner" && options.script != "random") {
+        std::cerr << "Unknown input script: " << options.script << "\n";
+        return false;
+    }
+    return true;
+}
+
+// Scripted input: deterministic for a given frame index and seed
+class InputScript {
+public:
+    InputScript(const std::string& name, unsigned int seed)
+        : name(name)
+        , rng(seed)
+        , holdFrames(0)
+    {
+    }
+
+    PlayerInput next(long long frame) {
+        if (name == "runner") {
+            PlayerInput input;
+            input.moveRight = true;
+            input.jump = (frame % 45) < 12;
+            input.dash = (frame % 120) == 0;
+            input.ability = (frame % 200) == 0;
+            return input;
+        }
+        if (name == "random") {
+            if (holdFrames <= 0) {
+                std::uniform_int_distribution<int> coin(0, 99);
+                held = PlayerInput();
+                int dir = coin(rng);
+                held.moveRight = dir < 55;
+                held.moveLeft = dir >= 55 && dir < 80;
+                held.jump = coin(rng) < 35;
+                held.dash = coin(rng) < 5;
+                held.ability = coin(rng) < 5;
+                held.up = coin(rng) < 5;
+                holdFrames = 5 + coin(rng) % 25;
+            }
+            --holdFrames;
+            return held;
+        }
+        return PlayerInput();
+    }
+
+private:
+    std::string name;
+    std::mt19937 rng;
+    PlayerInput held;
+    int holdFrames;
+};
+
+bool loadLevelInto(World& world, const std::string& levelPath, std::string& resolvedPath) {
+    resolvedPath = LevelLoader::resolveLevelPath(levelPath);
+    std::unique_ptr<LevelData> level = LevelLoader::loadFromFile(resolvedPath);
+    if (!level) {
+        return false;
+    }
+    world.setLevel(std::move(level));
+    return true;
+}
+
+void placePlayers(World& world, const sf::Vector2f& spawnPos) {
+    for (auto& player : world.getPlayers()) {
+        if (player) {
+            player->setPosition(spawnPos.x, spawnPos.y);
+            player->setSpawnPoint(spawnPos.x, spawnPos.y);
+            player->setVelocity(sf::Vector2f(0.0f, 0.0f));
+        }
+    }
+}
+
+bool runOnce(const SimOptions& options, int runIndex, RunStats& stats) {
+    World world;
+
+    std::string resolvedPath;
+    if (!loadLevelInto(world, options.levelPath, resolvedPath)) {
+        std::cerr << "Error: could not load level " << options.levelPath << "\n";
+        return false;
+    }
+
+    sf::Vector2f spawnPos = world.getDefaultSpawnPosition();
+    world.addPlayer(std::make_unique<Player>(spawnPos.x, spawnPos.y, options.character));
+    world.setActivePlayerIndex(0);
+    placePlayers(world, spawnPos);
+
+    InputScript script(options.script, options.seed + static_cast<unsigned int>(runIndex));
+
+    auto start = std::chrono::steady_clock::now();
+    for (long long frame = 0; frame < options.frames; ++frame) {
+        world.applyInput(script.next(frame));
+        WorldEvents events = world.update(options.dt);
+
+        if (events.playerDied) {
+            stats.deaths++;
+        }
+
+        // Checkpoints move the respawn point (no save file in headless runs)
+        if (events.reachedCheckpoint) {
+            events.reachedCheckpoint->activate();
+            sf::Vector2f cpPos = events.reachedCheckpoint->getSpawnPosition();
+            for (auto& player : world.getPlayers()) {
+                if (player) {
+                    player->setSpawnPoint(cpPos.x, cpPos.y);
+                }
+            }
+            stats.checkpoints++;
+        }
+
+        // Portals load the target level immediately (no fade)
+        if (events.enteredPortal) {
+            const Portal portal = *events.enteredPortal;
+            std::string targetPath = "assets/levels/" + portal.targetLevel + ".json";
+            if (!loadLevelInto(world, targetPath, resolvedPath)) {
+                std::cerr << "Warning: portal target not found: " << targetPath << "\n";
+                break;
+            }
+            PortalSpawnResult portalResult = PortalSpawner::computeSpawn(
+                portal.spawnDirection,
+                portal.useCustomSpawn,
+                portal.customSpawnPos,
+                world.getLevel(),
+                world.getPlatformIndex());
+            placePlayers(world, portalResult.usedPortal ? portalResult.position : world.getDefaultSpawnPosition());
+            stats.portals++;
+        }
+
+        stats.frames++;
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    stats.seconds = std::chrono::duration<double>(end - start).count();
+    stats.finalLevel = world.getLevel() ? world.getLevel()->levelId : resolvedPath;
+    if (Player* player = world.getActivePlayer()) {
+        stats.finalPosition = player->getPosition();
+    }
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    SimOptions options;
+    if (!parseArgs(argc, argv, options)) {
+        return EXIT_FAILURE;
+    }
+
+    // No window means no GL context: never create textures
+    SpriteManager::getInstance().setHeadless(true);
+
+    if (!options.packPath.empty() && !AssetPack::getInstance().open(options.packPath)) {
+        std::cerr << "Error: could not open asset pack " << options.packPath << "\n";
+        return EXIT_FAILURE;
+    }
+
+    // Level loading and gameplay print to std::cout; silence them unless --verbose
+    std::ostringstream discarded;
+    std::streambuf* consoleBuffer = std::cout.rdbuf();
+
+    long long totalFrames = 0;
+    double totalSeconds = 0.0;
+
+    try {
+        for (int run = 0; run < options.runs; ++run) {
+            RunStats stats;
+            if (options.quiet) std::cout.rdbuf(discarded.rdbuf());
+            bool ok = runOnce(options, run, stats);
+            std::cout.rdbuf(consoleBuffer);
+            discarded.str("");
+            if (!ok) {
+                return EXIT_FAILURE;
+            }
+
+            totalFrames += stats.frames;
+            totalSeconds += stats.seconds;
+            const double fps = stats.seconds > 0.0 ? static_cast<double>(stats.frames) / stats.seconds : 0.0;
+            std::cout << "run " << run
+                      << " frames=" << stats.frames
+                      << " time=" << std::fixed << std::setprecision(3) << stats.seconds << "s"
+                      << " fps=" << std::setprecision(0) << fps
+                      << " deaths=" << stats.deaths
+                      << " checkpoints=" << stats.checkpoints
+                      << " portals=" << stats.portals
+                      << " level=" << stats.finalLevel
+                      << " pos=(" << std::setprecision(1) << stats.finalPosition.x << ", " << stats.finalPosition.y << ")\n";
+        }
+    }
+    catch (const std::exception& e) {
+        std::cout.rdbuf(consoleBuffer);
+        std::cerr << "Error: " << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    const double fps = totalSeconds > 0.0 ? static_cast<double>(totalFrames) / totalSeconds : 0.0;
+    std::cout << "total frames=" << totalFrames
+              << " time=" << std::fixed << std::setprecision(3) << totalSeconds << "s"
+              << " fps=" << std::setprecision(0) << fps << "\n";
+
+    return EXIT_SUCCESS;
+}
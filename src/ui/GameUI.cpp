@@ -1,42 +1,35 @@
 #include "ui/GameUI.h"
-#include <sstream>
-#include <iomanip>
+#include "core/AssetFileSystem.h"
+#include <cstdio>
 #include <iostream>
 
+namespace {
+    enum HudKey : std::uint32_t { HudDeaths, HudTimer, HudTimerFraction };
+}
+
 GameUI::GameUI()
     : fontLoaded(false)
-    , deathCount(0)
-    , timer(0.0f)
-    , victoryMessageVisible(false)
-    , currentHealth(3)
-    , maxHealthValue(3)
+    , displayedDeaths(-1)
+    , displayedSeconds(-1)
+    , displayedCentiseconds(-1)
+    , displayedHealth(-1)
+    , displayedMaxHealth(-1)
 {
     // Try to load font (optional - will work without it)
-    if (!font.loadFromFile("assets/fonts/arial.ttf")) {
+    if (!font.loadFromFile(AssetFileSystem::getInstance().resolve("assets/fonts/arial.ttf"))) {
         std::cout << "Warning: Could not load font for UI. Using default font.\n";
         fontLoaded = false;
     } else {
         fontLoaded = true;
     }
 
-    // Setup death counter text
-    deathText.setCharacterSize(24);
-    deathText.setFillColor(sf::Color::White);
-    deathText.setOutlineColor(sf::Color::Black);
-    deathText.setOutlineThickness(2.0f);
-    deathText.setPosition(10.0f, 10.0f);
-    if (fontLoaded) {
-        deathText.setFont(font);
-    }
-
-    // Setup timer text
-    timerText.setCharacterSize(24);
-    timerText.setFillColor(sf::Color::White);
-    timerText.setOutlineColor(sf::Color::Black);
-    timerText.setOutlineThickness(2.0f);
-    timerText.setPosition(10.0f, 40.0f);
+    // Death counter and timer style
+    hudStyle.characterSize = 24;
+    hudStyle.fillColor = sf::Color::White;
+    hudStyle.outlineColor = sf::Color::Black;
+    hudStyle.outlineThickness = 2.0f;
     if (fontLoaded) {
-        timerText.setFont(font);
+        hudText.setFont(font);
     }
 
     // Setup victory message (centered, large text)
@@ -47,7 +40,6 @@ GameUI::GameUI()
     victoryText.setString("LEVEL COMPLETE!");
     if (fontLoaded) {
         victoryText.setFont(font);
-        // Center the text (will be adjusted in showVictoryMessage)
     }
 
     // Setup semi-transparent background for victory message
@@ -56,92 +48,103 @@ GameUI::GameUI()
     victoryBackground.setOutlineColor(sf::Color::Yellow);
     victoryBackground.setOutlineThickness(5.0f);
 
-    // Initialize hearts
-    updateHearts();
-
-    updateTexts();
+    // Center the victory message on screen (assuming 1280x720 window)
+    sf::FloatRect textBounds = victoryText.getLocalBounds();
+    victoryText.setOrigin(textBounds.width / 2.0f, textBounds.height / 2.0f);
+    victoryText.setPosition(640.0f, 360.0f);
+    victoryBackground.setOrigin(victoryBackground.getSize().x / 2.0f, victoryBackground.getSize().y / 2.0f);
+    victoryBackground.setPosition(640.0f, 360.0f);
 }
 
 void GameUI::update(float dt) {
-    timer += dt;
-    updateTexts();
+    values.timer += dt;
 }
 
 void GameUI::draw(sf::RenderWindow& window) {
+    draw(window, values);
+}
+
+void GameUI::draw(sf::RenderTarget& target, const HudValues& shown) {
     if (fontLoaded) {
-        window.draw(deathText);
-        window.draw(timerText);
+        updateTexts(shown);
+        updateHearts(shown);
+
+        // Glyphs are cached per string: only the changed digits are laid out again
+        hudText.put(TextBatch::key(HudDeaths, 0), deathString, hudStyle, sf::Vector2f(10.0f, 10.0f));
+        hudText.put(TextBatch::key(HudTimer, 0), timerString, hudStyle, sf::Vector2f(10.0f, 40.0f));
+        const float fractionX = 10.0f + hudText.getAdvance(TextBatch::key(HudTimer, 0));
+        hudText.put(TextBatch::key(HudTimerFraction, 0), fractionString, hudStyle, sf::Vector2f(fractionX, 40.0f));
+        hudText.draw(target);
 
         // Draw hearts
         for (const auto& heart : hearts) {
-            window.draw(heart);
+            target.draw(heart);
         }
 
         // Draw victory message if visible
-        if (victoryMessageVisible) {
-            window.draw(victoryBackground);
-            window.draw(victoryText);
+        if (shown.victoryVisible) {
+            target.draw(victoryBackground);
+            target.draw(victoryText);
         }
     }
 }
 
 void GameUI::incrementDeaths() {
-    deathCount++;
-    updateTexts();
+    values.deaths++;
 }
 
 void GameUI::resetDeaths() {
-    deathCount = 0;
-    timer = 0.0f;
-    updateTexts();
+    values.deaths = 0;
+    values.timer = 0.0f;
 }
 
 void GameUI::setTimer(float time) {
-    timer = time;
-    updateTexts();
+    values.timer = time;
 }
 
-void GameUI::updateTexts() {
-    // Update death counter
-    deathText.setString("Deaths: " + std::to_string(deathCount));
-
-    // Update timer (format: MM:SS.mm)
-    int minutes = static_cast<int>(timer) / 60;
-    int seconds = static_cast<int>(timer) % 60;
-    int milliseconds = static_cast<int>((timer - static_cast<int>(timer)) * 100);
-
-    std::ostringstream oss;
-    oss << "Time: "
-        << std::setfill('0') << std::setw(2) << minutes << ":"
-        << std::setfill('0') << std::setw(2) << seconds << "."
-        << std::setfill('0') << std::setw(2) << milliseconds;
-    timerText.setString(oss.str());
-}
+void GameUI::updateTexts(const HudValues& shown) {
+    // Reformat a field only when the value it shows changes
+    if (shown.deaths != displayedDeaths) {
+        displayedDeaths = shown.deaths;
+        deathString = "Deaths: " + std::to_string(shown.deaths);
+    }
 
-void GameUI::showVictoryMessage() {
-    victoryMessageVisible = true;
+    // Timer (format: MM:SS.mm): the MM:SS part changes once per second
+    char buffer[32];
+    const int totalSeconds = static_cast<int>(shown.timer);
+    if (totalSeconds != displayedSeconds) {
+        displayedSeconds = totalSeconds;
+        std::snprintf(buffer, sizeof(buffer), "Time: %02d:%02d", totalSeconds / 60, totalSeconds % 60);
+        timerString = buffer;
+    }
 
-    // Center the victory message on screen (assuming 1280x720 window)
-    sf::FloatRect textBounds = victoryText.getLocalBounds();
-    victoryText.setOrigin(textBounds.width / 2.0f, textBounds.height / 2.0f);
-    victoryText.setPosition(640.0f, 360.0f);
+    const int centiseconds = static_cast<int>((shown.timer - static_cast<float>(totalSeconds)) * 100);
+    if (centiseconds != displayedCentiseconds) {
+        displayedCentiseconds = centiseconds;
+        std::snprintf(buffer, sizeof(buffer), ".%02d", centiseconds);
+        fractionString = buffer;
+    }
+}
 
-    // Center the background
-    victoryBackground.setOrigin(victoryBackground.getSize().x / 2.0f, victoryBackground.getSize().y / 2.0f);
-    victoryBackground.setPosition(640.0f, 360.0f);
+void GameUI::showVictoryMessage() {
+    values.victoryVisible = true;
 }
 
 void GameUI::hideVictoryMessage() {
-    victoryMessageVisible = false;
+    values.victoryVisible = false;
 }
 
 void GameUI::setHealth(int health, int maxHealth) {
-    currentHealth = health;
-    maxHealthValue = maxHealth;
-    updateHearts();
+    values.health = health;
+    values.maxHealth = maxHealth;
 }
 
-void GameUI::updateHearts() {
+void GameUI::updateHearts(const HudValues& shown) {
+    if (shown.health == displayedHealth && shown.maxHealth == displayedMaxHealth) {
+        return;
+    }
+    displayedHealth = shown.health;
+    displayedMaxHealth = shown.maxHealth;
     hearts.clear();
 
     float heartSize = 30.0f;
@@ -149,7 +152,7 @@ void GameUI::updateHearts() {
     float startX = 10.0f;
     float startY = 70.0f; // Below the timer
 
-    for (int i = 0; i < maxHealthValue; ++i) {
+    for (int i = 0; i < shown.maxHealth; ++i) {
         sf::RectangleShape heart;
         heart.setSize(sf::Vector2f(heartSize, heartSize));
         heart.setPosition(startX + i * heartSpacing, startY);
@@ -157,7 +160,7 @@ void GameUI::updateHearts() {
         heart.setOutlineThickness(2.0f);
 
         // Full heart if still has health, empty heart otherwise
-        if (i < currentHealth) {
+        if (i < shown.health) {
             heart.setFillColor(sf::Color::Red); // Full heart
         } else {
             heart.setFillColor(sf::Color(100, 100, 100)); // Empty heart (gray)
@@ -22,18 +22,8 @@ KeyBindingMenu::KeyBindingMenu()
         display.actionName = name;
         display.action = action;
 
-        if (fontLoaded) {
-            display.labelText.setFont(font);
-            display.valueText.setFont(font);
-
-            display.labelText.setCharacterSize(25);
-            display.valueText.setCharacterSize(25);
-
-            display.labelText.setFillColor(sf::Color::White);
-            display.valueText.setFillColor(sf::Color(100, 200, 255));
-
-            display.labelText.setString(name + ":");
-        }
+        display.labelString = name + ":";
+        display.valueColor = sf::Color(100, 200, 255);
 
         bindings.push_back(display);
     }
@@ -80,21 +70,13 @@ void KeyBindingMenu::setCallbacks(std::function<void()> onBack) {
 void KeyBindingMenu::updateBindingDisplays() {
     InputConfig& config = InputConfig::getInstance();
 
-    float centerX = Config::WINDOW_WIDTH / 2.0f;
-    float labelX = centerX - 250.0f;
-    float valueX = centerX + 50.0f;
-    float startY = 180.0f;
-    float spacing = 50.0f;
-
     for (size_t i = 0; i < bindings.size(); i++) {
         sf::Keyboard::Key key = config.getBinding(bindings[i].action);
         std::string keyName = config.getKeyName(key);
 
-        bindings[i].valueText.setString("< " + keyName + " >");
-
-        bindings[i].labelText.setPosition(labelX, startY + i * spacing);
-        bindings[i].valueText.setPosition(valueX, startY + i * spacing);
+        bindings[i].valueString = "< " + keyName + " >";
     }
+    markDirty();
 }
 
 void KeyBindingMenu::startRebinding(const std::string& action) {
@@ -106,8 +88,8 @@ void KeyBindingMenu::startRebinding(const std::string& action) {
     // Update display to show waiting state
     for (auto& binding : bindings) {
         if (binding.action == action) {
-            binding.valueText.setString("< Press Key >");
-            binding.valueText.setFillColor(sf::Color::Yellow);
+            binding.valueString = "< Press Key >";
+            binding.valueColor = sf::Color::Yellow;
             break;
         }
     }
@@ -126,7 +108,7 @@ void KeyBindingMenu::completeRebinding(sf::Keyboard::Key key) {
 
     // Restore color
     for (auto& binding : bindings) {
-        binding.valueText.setFillColor(sf::Color(100, 200, 255));
+        binding.valueColor = sf::Color(100, 200, 255);
     }
 }
 
@@ -140,12 +122,13 @@ void KeyBindingMenu::cancelRebinding() {
 
     // Restore color
     for (auto& binding : bindings) {
-        binding.valueText.setFillColor(sf::Color(100, 200, 255));
+        binding.valueColor = sf::Color(100, 200, 255);
     }
 }
 
 void KeyBindingMenu::handleInput(const sf::Event& event) {
     if (event.type == sf::Event::KeyPressed) {
+        markDirty();
         if (isWaitingForKey) {
             // Cancel rebinding on Escape
             if (event.key.code == sf::Keyboard::Escape) {
@@ -180,32 +163,39 @@ void KeyBindingMenu::handleInput(const sf::Event& event) {
     }
 }
 
-void KeyBindingMenu::draw(sf::RenderWindow& window) {
-    // Draw base menu
-    Menu::draw(window);
+void KeyBindingMenu::putLabels() {
+    // Binding displays and instruction, above the menu's own texts
+    float centerX = Config::WINDOW_WIDTH / 2.0f;
+    float labelX = centerX - 250.0f;
+    float valueX = centerX + 50.0f;
+    float startY = 180.0f;
+    float spacing = 50.0f;
 
-    // Draw binding displays
-    if (fontLoaded) {
-        for (const auto& binding : bindings) {
-            window.draw(binding.labelText);
-            window.draw(binding.valueText);
-        }
+    TextStyle labelStyle;
+    labelStyle.characterSize = 25;
+
+    for (size_t i = 0; i < bindings.size(); i++) {
+        const std::uint32_t index = static_cast<std::uint32_t>(i);
+        const float y = startY + static_cast<float>(i) * spacing;
+
+        labels.put(TextBatch::key(LabelBindingName, index), bindings[i].labelString, labelStyle,
+                   sf::Vector2f(labelX, y));
+
+        TextStyle valueStyle = labelStyle;
+        valueStyle.fillColor = bindings[i].valueColor;
+        labels.put(TextBatch::key(LabelBindingValue, index), bindings[i].valueString, valueStyle,
+                   sf::Vector2f(valueX, y));
     }
 
-    // Draw instruction text if waiting for key
-    if (isWaitingForKey && fontLoaded) {
-        sf::Text instructionText;
-        instructionText.setFont(font);
-        instructionText.setCharacterSize(20);
-        instructionText.setFillColor(sf::Color::Yellow);
-        instructionText.setString("Press any key to rebind, or ESC to cancel");
-
-        sf::FloatRect bounds = instructionText.getLocalBounds();
-        instructionText.setPosition(
-            Config::WINDOW_WIDTH / 2.0f - bounds.width / 2.0f,
-            Config::WINDOW_HEIGHT - 100.0f
-        );
-
-        window.draw(instructionText);
+    // Instruction text if waiting for key
+    if (isWaitingForKey) {
+        TextStyle instructionStyle;
+        instructionStyle.characterSize = 20;
+        instructionStyle.fillColor = sf::Color::Yellow;
+
+        const std::uint64_t key = TextBatch::key(LabelInstruction, 0);
+        const sf::FloatRect bounds = labels.layout(key, "Press any key to rebind, or ESC to cancel", instructionStyle);
+        labels.put(key, sf::Vector2f(Config::WINDOW_WIDTH / 2.0f - bounds.width / 2.0f,
+                                     Config::WINDOW_HEIGHT - 100.0f));
     }
 }
@@ -1,4 +1,5 @@
 #include "ui/Menu.h"
+#include "core/AssetFileSystem.h"
 #include "core/Config.h"
 #include "core/InputConfig.h"
 #include <iostream>
@@ -6,17 +7,12 @@
 // MenuItem implementation
 MenuItem::MenuItem(const std::string& text, std::function<void()> callback)
     : callback(callback)
-    , font(nullptr)
-    , hasFont(false)
+    , label(text)
 {
     background.setSize(sf::Vector2f(400.0f, 60.0f));
     background.setFillColor(sf::Color(50, 50, 50, 200));
     background.setOutlineThickness(2.0f);
     background.setOutlineColor(sf::Color(100, 100, 100));
-
-    this->text.setString(text);
-    this->text.setCharacterSize(30);
-    this->text.setFillColor(sf::Color::White);
 }
 
 void MenuItem::draw(sf::RenderWindow& window, bool isSelected) {
@@ -29,22 +25,10 @@ void MenuItem::draw(sf::RenderWindow& window, bool isSelected) {
     }
 
     window.draw(background);
-    if (hasFont) {
-        window.draw(text);
-    }
 }
 
 void MenuItem::setPosition(float x, float y) {
     background.setPosition(x, y);
-
-    if (hasFont) {
-        // Center text in background
-        sf::FloatRect textBounds = text.getLocalBounds();
-        text.setPosition(
-            x + (background.getSize().x - textBounds.width) / 2.0f - textBounds.left,
-            y + (background.getSize().y - textBounds.height) / 2.0f - textBounds.top
-        );
-    }
 }
 
 sf::FloatRect MenuItem::getBounds() const {
@@ -55,18 +39,18 @@ sf::FloatRect MenuItem::getBounds() const {
 Menu::Menu()
     : selectedIndex(0)
     , fontLoaded(false)
+    , dirty(true)
 {
     // Try to load font (optional)
-    if (font.loadFromFile("assets/fonts/arial.ttf")) {
+    if (font.loadFromFile(AssetFileSystem::getInstance().resolve("assets/fonts/arial.ttf"))) {
         fontLoaded = true;
-        titleText.setFont(font);
+        labels.setFont(font);
     } else {
         std::cout << "Warning: Could not load menu font\n";
     }
 
-    titleText.setCharacterSize(50);
-    titleText.setFillColor(sf::Color::White);
-    titleText.setPosition(Config::WINDOW_WIDTH / 2.0f - 150.0f, 100.0f);
+    titleStyle.characterSize = 50;
+    itemStyle.characterSize = 30;
 
     // Semi-transparent dark background
     background.setSize(sf::Vector2f(Config::WINDOW_WIDTH, Config::WINDOW_HEIGHT));
@@ -74,20 +58,14 @@ Menu::Menu()
 }
 
 void Menu::addItem(const std::string& text, std::function<void()> callback) {
-    MenuItem item(text, callback);
-
-    if (fontLoaded) {
-        item.font = &font;
-        item.text.setFont(font);
-        item.hasFont = true;
-    }
-
-    items.push_back(item);
+    items.push_back(MenuItem(text, callback));
     updateLayout();
+    markDirty();
 }
 
 void Menu::handleInput(const sf::Event& event) {
     if (event.type == sf::Event::KeyPressed) {
+        markDirty();   // Any key may move the selection or change a value
         const InputBindings& bindings = InputConfig::getInstance().getBindings();
 
         if (event.key.code == sf::Keyboard::Up || event.key.code == bindings.menuUp) {
@@ -106,7 +84,10 @@ void Menu::handleMouseMove(const sf::Vector2f& mousePos) {
     // Check if mouse is hovering over any item
     for (size_t i = 0; i < items.size(); i++) {
         if (items[i].getBounds().contains(mousePos)) {
-            selectedIndex = static_cast<int>(i);
+            if (selectedIndex != static_cast<int>(i)) {
+                selectedIndex = static_cast<int>(i);
+                markDirty();
+            }
             break;
         }
     }
@@ -130,30 +111,44 @@ void Menu::update(float /*dt*/) {
 void Menu::draw(sf::RenderWindow& window) {
     window.draw(background);
 
-    if (fontLoaded) {
-        window.draw(titleText);
-    }
-
     for (size_t i = 0; i < items.size(); i++) {
         items[i].draw(window, i == selectedIndex);
     }
-}
-
-void Menu::setTitle(const std::string& title) {
-    titleText.setString(title);
 
     if (fontLoaded) {
-        sf::FloatRect bounds = titleText.getLocalBounds();
-        titleText.setPosition(
-            Config::WINDOW_WIDTH / 2.0f - bounds.width / 2.0f,
-            100.0f
-        );
+        // Layouts are cached by the batch: this only recomputes positions
+        const sf::FloatRect titleBounds = labels.layout(TextBatch::key(LabelTitle, 0), titleString, titleStyle);
+        labels.put(TextBatch::key(LabelTitle, 0), sf::Vector2f(Config::WINDOW_WIDTH / 2.0f - titleBounds.width / 2.0f, 100.0f));
+
+        for (size_t i = 0; i < items.size(); i++) {
+            const std::uint64_t key = TextBatch::key(LabelItem, static_cast<std::uint32_t>(i));
+            const sf::FloatRect textBounds = labels.layout(key, items[i].label, itemStyle);
+
+            // Center text in background
+            const sf::Vector2f& itemPosition = items[i].background.getPosition();
+            const sf::Vector2f& itemSize = items[i].background.getSize();
+            labels.put(key, sf::Vector2f(
+                itemPosition.x + (itemSize.x - textBounds.width) / 2.0f - textBounds.left,
+                itemPosition.y + (itemSize.y - textBounds.height) / 2.0f - textBounds.top
+            ));
+        }
+
+        putLabels();
     }
+
+    labels.draw(window);
+    dirty = false;
+}
+
+void Menu::setTitle(const std::string& title) {
+    titleString = title;
+    markDirty();
 }
 
 void Menu::selectNext() {
     if (!items.empty()) {
         selectedIndex = (selectedIndex + 1) % items.size();
+        markDirty();
     }
 }
 
@@ -163,10 +158,12 @@ void Menu::selectPrevious() {
         if (selectedIndex < 0) {
             selectedIndex = static_cast<int>(items.size()) - 1;
         }
+        markDirty();
     }
 }
 
 void Menu::activate() {
+    markDirty();   // The callback may change what the menu shows
     if (selectedIndex >= 0 && selectedIndex < items.size()) {
         if (items[selectedIndex].callback) {
             items[selectedIndex].callback();
@@ -9,20 +9,6 @@ SettingsMenu::SettingsMenu(AudioManager* audioManager)
 {
     setTitle("SETTINGS");
 
-    if (fontLoaded) {
-        volumeText.setFont(font);
-        soundVolumeText.setFont(font);
-        musicVolumeText.setFont(font);
-
-        volumeText.setCharacterSize(30);
-        soundVolumeText.setCharacterSize(30);
-        musicVolumeText.setCharacterSize(30);
-
-        volumeText.setFillColor(sf::Color::White);
-        soundVolumeText.setFillColor(sf::Color::White);
-        musicVolumeText.setFillColor(sf::Color::White);
-    }
-
     updateVolumeDisplay();
 }
 
@@ -40,18 +26,10 @@ void SettingsMenu::setCallbacks(std::function<void()> onControls, std::function<
 }
 
 void SettingsMenu::updateVolumeDisplay() {
-    volumeText.setString("Master Volume: < " + std::to_string(masterVolume) + " >");
-    soundVolumeText.setString("Sound Volume:  < " + std::to_string(soundVolume) + " >");
-    musicVolumeText.setString("Music Volume:  < " + std::to_string(musicVolume) + " >");
-
-    // Position texts to match menu items layout
-    float startY = 250.0f;
-    float spacing = 80.0f;
-    float centerX = Config::WINDOW_WIDTH / 2.0f;
-
-    volumeText.setPosition(centerX - volumeText.getLocalBounds().width / 2.0f, startY);
-    soundVolumeText.setPosition(centerX - soundVolumeText.getLocalBounds().width / 2.0f, startY + spacing);
-    musicVolumeText.setPosition(centerX - musicVolumeText.getLocalBounds().width / 2.0f, startY + spacing * 2);
+    volumeStrings[0] = "Master Volume: < " + std::to_string(masterVolume) + " >";
+    volumeStrings[1] = "Sound Volume:  < " + std::to_string(soundVolume) + " >";
+    volumeStrings[2] = "Music Volume:  < " + std::to_string(musicVolume) + " >";
+    markDirty();
 
     if (audioManager) {
         audioManager->setMasterVolume(static_cast<float>(masterVolume));
@@ -104,14 +82,16 @@ void SettingsMenu::handleInput(const sf::Event& event) {
     Menu::handleInput(event);
 }
 
-void SettingsMenu::draw(sf::RenderWindow& window) {
-    // Draw base menu
-    Menu::draw(window);
+void SettingsMenu::putLabels() {
+    // Volume displays over the first items, laid out only when a volume changes
+    // Position texts to match menu items layout
+    float startY = 250.0f;
+    float spacing = 80.0f;
+    float centerX = Config::WINDOW_WIDTH / 2.0f;
 
-    // Override item text with volume displays
-    if (fontLoaded) {
-        window.draw(volumeText);
-        window.draw(soundVolumeText);
-        window.draw(musicVolumeText);
+    for (std::uint32_t i = 0; i < 3; ++i) {
+        const std::uint64_t key = TextBatch::key(LABEL_GROUP_USER, i);
+        const sf::FloatRect bounds = labels.layout(key, volumeStrings[i], itemStyle);
+        labels.put(key, sf::Vector2f(centerX - bounds.width / 2.0f, startY + spacing * static_cast<float>(i)));
     }
 }
@@ -15,11 +15,13 @@ Camera::Camera(float width, float height)
     , hasLimits(false)
 {
     view.setCenter(width / 2.0f, height / 2.0f);
+    previousCenter = view.getCenter();
 }
 
 void Camera::update(const sf::Vector2f& targetPosition, float dt) {
     (void)dt; // Parameter not used (kept for API consistency)
     sf::Vector2f currentCenter = view.getCenter();
+    previousCenter = currentCenter;
     sf::Vector2f desiredCenter = targetPosition;
 
     // Smooth camera movement (lerp)
@@ -39,8 +41,25 @@ void Camera::update(const sf::Vector2f& targetPosition, float dt) {
     view.setCenter(newCenter + shakeOffset);
 }
 
-void Camera::apply(sf::RenderWindow& window) {
-    window.setView(view);
+void Camera::apply(sf::RenderWindow& window, float alpha) {
+    window.setView(getRenderView(alpha));
+}
+
+sf::View Camera::getRenderView(float alpha) const {
+    if (alpha >= 1.0f) {
+        return view;
+    }
+
+    // Draw between the last two simulation ticks
+    sf::View interpolated = view;
+    interpolated.setCenter(previousCenter + (view.getCenter() - previousCenter) * alpha);
+    return interpolated;
+}
+
+sf::FloatRect Camera::visibleArea(const sf::View& view, float margin) {
+    const sf::Vector2f size = view.getSize();
+    const sf::Vector2f topLeft = view.getCenter() - size / 2.0f;
+    return sf::FloatRect(topLeft.x - margin, topLeft.y - margin, size.x + margin * 2.0f, size.y + margin * 2.0f);
 }
 
 void Camera::setShakeOffset(const sf::Vector2f& offset) {
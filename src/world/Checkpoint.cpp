@@ -1,4 +1,5 @@
 #include "world/Checkpoint.h"
+#include "graphics/RenderQueue.h"
 #include <cmath>
 
 Checkpoint::Checkpoint(float x, float y, const std::string& id)
@@ -29,8 +30,8 @@ void Checkpoint::update(float dt) {
     }
 }
 
-void Checkpoint::draw(sf::RenderWindow& window) {
-    window.draw(shape);
+void Checkpoint::submit(RenderQueue& queue) const {
+    queue.submit(RenderLayer::Props, shape);
 }
 
 bool Checkpoint::isPlayerInside(const sf::FloatRect& playerBounds) const {
@@ -1,4 +1,5 @@
 #include "world/GoalZone.h"
+#include "graphics/RenderQueue.h"
 #include <cmath>
 
 GoalZone::GoalZone(float x, float y, float width, float height)
@@ -21,8 +22,8 @@ void GoalZone::update(float dt) {
     shape.setFillColor(sf::Color(255, 215, 0, static_cast<sf::Uint8>(alpha)));
 }
 
-void GoalZone::draw(sf::RenderWindow& window) {
-    window.draw(shape);
+void GoalZone::submit(RenderQueue& queue, const sf::Vector2f& offset) {
+    queue.submit(RenderLayer::Props, shape, offset);
 }
 
 bool GoalZone::isPlayerInside(const sf::FloatRect& playerBounds) const {
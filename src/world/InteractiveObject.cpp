@@ -1,5 +1,6 @@
 #include "world/InteractiveObject.h"
 #include "core/Config.h"
+#include "graphics/RenderQueue.h"
 #include <cmath>
 
 InteractiveObject::InteractiveObject(float x, float y, float width, float height, InteractiveType type, const std::string& id)
@@ -74,8 +75,8 @@ void InteractiveObject::update(float dt) {
     }
 }
 
-void InteractiveObject::draw(sf::RenderWindow& window) {
-    window.draw(shape);
+void InteractiveObject::submit(RenderQueue& queue) const {
+    queue.submit(RenderLayer::Props, shape);
 }
 
 sf::FloatRect InteractiveObject::getBounds() const {
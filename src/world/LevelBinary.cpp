@@ -0,0 +1,150 @@
+#include "world/LevelBinary.h"
+#include "core/MappedFile.h"
+#include <cstring>
+#include <fstream>
+#include <type_traits>
+
+namespace {
+    constexpr std::size_t SECTION_ALIGNMENT = 8;
+
+    std::size_t alignUp(std::size_t value) {
+        return (value + SECTION_ALIGNMENT - 1) & ~(SECTION_ALIGNMENT - 1);
+    }
+
+    template <typename Record>
+    void writeSection(std::ofstream& out, const std::vector<Record>& records) {
+        static_assert(std::is_trivially_copyable<Record>::value, "records are written as raw bytes");
+        const char zeros[SECTION_ALIGNMENT] = {};
+        const std::size_t position = static_cast<std::size_t>(out.tellp());
+        out.write(zeros, static_cast<std::streamsize>(alignUp(position) - position));
+        if (!records.empty()) {
+            out.write(reinterpret_cast<const char*>(records.data()),
+                      static_cast<std::streamsize>(records.size() * sizeof(Record)));
+        }
+    }
+
+    template <typename Record>
+    bool readSection(const std::uint8_t* data, std::size_t size, std::size_t& cursor,
+                     std::uint32_t count, std::vector<Record>& out) {
+        cursor = alignUp(cursor);
+        const std::size_t bytes = static_cast<std::size_t>(count) * sizeof(Record);
+        if (cursor > size || bytes > size - cursor) {
+            return false;
+        }
+        out.resize(count);
+        if (bytes > 0) {
+            std::memcpy(out.data(), data + cursor, bytes);
+        }
+        cursor += bytes;
+        return true;
+    }
+}
+
+LevelBinary::StringRef LevelBinary::LevelRecords::addString(const std::string& value) {
+    StringRef ref;
+    ref.offset = static_cast<std::uint32_t>(strings.size());
+    ref.length = static_cast<std::uint32_t>(value.size());
+    strings += value;
+    return ref;
+}
+
+std::string LevelBinary::LevelRecords::getString(const StringRef& ref) const {
+    if (ref.offset > strings.size() || ref.length > strings.size() - ref.offset) {
+        return std::string();
+    }
+    return strings.substr(ref.offset, ref.length);
+}
+
+std::string LevelBinary::pathFor(const std::string& sourcePath) {
+    const std::size_t slash = sourcePath.find_last_of("/\\");
+    const std::size_t dot = sourcePath.find_last_of('.');
+    if (dot == std::string::npos || (slash != std::string::npos && dot < slash)) {
+        return sourcePath + EXTENSION;
+    }
+    return sourcePath.substr(0, dot) + EXTENSION;
+}
+
+bool LevelBinary::write(const LevelRecords& level, const std::string& path) {
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out.is_open()) {
+        return false;
+    }
+
+    Header header{};
+    header.magic = MAGIC;
+    header.version = VERSION;
+    header.name = level.name;
+    header.levelId = level.levelId;
+    header.nextZone = level.nextZone;
+    header.zoneNumber = level.zoneNumber;
+    header.isBossLevel = level.isBossLevel ? 1u : 0u;
+    header.startX = level.startX;
+    header.startY = level.startY;
+    header.platformCount = static_cast<std::uint32_t>(level.platforms.size());
+    header.checkpointCount = static_cast<std::uint32_t>(level.checkpoints.size());
+    header.interactiveCount = static_cast<std::uint32_t>(level.interactiveObjects.size());
+    header.enemyCount = static_cast<std::uint32_t>(level.enemies.size());
+    header.cameraZoneCount = static_cast<std::uint32_t>(level.cameraZones.size());
+    header.portalCount = static_cast<std::uint32_t>(level.portals.size());
+    header.backgroundTileCount = static_cast<std::uint32_t>(level.backgroundTiles.size());
+    header.nextLevelCount = static_cast<std::uint32_t>(level.nextLevels.size());
+    header.stringTableSize = static_cast<std::uint32_t>(level.strings.size());
+    header.sectorSize = level.sectorSize;
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    writeSection(out, level.platforms);
+    writeSection(out, level.checkpoints);
+    writeSection(out, level.interactiveObjects);
+    writeSection(out, level.enemies);
+    writeSection(out, level.cameraZones);
+    writeSection(out, level.portals);
+    writeSection(out, level.backgroundTiles);
+    writeSection(out, level.nextLevels);
+    out.write(level.strings.data(), static_cast<std::streamsize>(level.strings.size()));
+
+    return static_cast<bool>(out);
+}
+
+bool LevelBinary::read(const std::uint8_t* data, std::size_t size, LevelRecords& out) {
+    if (!data || size < sizeof(Header)) {
+        return false;
+    }
+
+    Header header;
+    std::memcpy(&header, data, sizeof(Header));
+    if (header.magic != MAGIC || header.version != VERSION) {
+        return false;
+    }
+
+    out.name = header.name;
+    out.levelId = header.levelId;
+    out.nextZone = header.nextZone;
+    out.zoneNumber = header.zoneNumber;
+    out.isBossLevel = header.isBossLevel != 0;
+    out.startX = header.startX;
+    out.startY = header.startY;
+    out.sectorSize = header.sectorSize;
+
+    std::size_t cursor = sizeof(Header);
+    if (!readSection(data, size, cursor, header.platformCount, out.platforms) ||
+        !readSection(data, size, cursor, header.checkpointCount, out.checkpoints) ||
+        !readSection(data, size, cursor, header.interactiveCount, out.interactiveObjects) ||
+        !readSection(data, size, cursor, header.enemyCount, out.enemies) ||
+        !readSection(data, size, cursor, header.cameraZoneCount, out.cameraZones) ||
+        !readSection(data, size, cursor, header.portalCount, out.portals) ||
+        !readSection(data, size, cursor, header.backgroundTileCount, out.backgroundTiles) ||
+        !readSection(data, size, cursor, header.nextLevelCount, out.nextLevels)) {
+        return false;
+    }
+
+    if (header.stringTableSize > size - cursor) {
+        return false;
+    }
+    out.strings.assign(reinterpret_cast<const char*>(data + cursor), header.stringTableSize);
+    return true;
+}
+
+bool LevelBinary::readFile(const std::string& path, LevelRecords& out) {
+    MappedFile file;
+    return file.open(path) && read(file.getData(), file.getSize(), out);
+}
@@ -0,0 +1,86 @@
+#include "world/LevelCache.h"
+#include "core/AssetPack.h"
+#include "core/Config.h"
+
+LevelCache& LevelCache::getInstance() {
+    static LevelCache instance;
+    return instance;
+}
+
+LevelCache::LevelCache()
+    : capacity(Config::LEVEL_CACHE_CAPACITY) {
+}
+
+bool LevelCache::getStamp(const std::string& path, Stamp& out) {
+    if (AssetPack::getInstance().contains(path)) {
+        out = Stamp::min();
+        return true;
+    }
+    std::error_code ec;
+    out = std::filesystem::last_write_time(path, ec);
+    return !ec;
+}
+
+LevelCache::Template LevelCache::find(const std::string& path, Stamp stamp) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = index.find(path);
+    if (it == index.end()) {
+        return nullptr;
+    }
+    if (it->second->stamp != stamp) {
+        // Source changed since it was parsed
+        entries.erase(it->second);
+        index.erase(it);
+        return nullptr;
+    }
+    entries.splice(entries.begin(), entries, it->second);
+    return it->second->records;
+}
+
+void LevelCache::store(const std::string& path, Stamp stamp, Template records) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = index.find(path);
+    if (it != index.end()) {
+        entries.erase(it->second);
+        index.erase(it);
+    }
+    if (capacity == 0) {
+        return;
+    }
+    entries.push_front(Entry{path, stamp, std::move(records)});
+    index[path] = entries.begin();
+    trim();
+}
+
+void LevelCache::invalidate(const std::string& path) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = index.find(path);
+    if (it != index.end()) {
+        entries.erase(it->second);
+        index.erase(it);
+    }
+}
+
+void LevelCache::clear() {
+    std::lock_guard<std::mutex> lock(mutex);
+    entries.clear();
+    index.clear();
+}
+
+void LevelCache::setCapacity(std::size_t levels) {
+    std::lock_guard<std::mutex> lock(mutex);
+    capacity = levels;
+    trim();
+}
+
+std::size_t LevelCache::getSize() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return entries.size();
+}
+
+void LevelCache::trim() {
+    while (entries.size() > capacity) {
+        index.erase(entries.back().path);
+        entries.pop_back();
+    }
+}
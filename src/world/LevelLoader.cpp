@@ -1,15 +1,24 @@
 #include "world/LevelLoader.h"
+#include "world/LevelCache.h"
+#include "world/LevelBinary.h"
 #include "entities/PatrolEnemy.h"
 #include "entities/FlyingEnemy.h"
 #include "entities/Spike.h"
 #include "entities/FlameTrap.h"
 #include "entities/RotatingTrap.h"
 #include "entities/EnemyStatsPresets.h"
+#include "core/AssetPack.h"
+#include "core/AssetFileSystem.h"
 #include <fstream>
 #include <sstream>
 #include <iostream>
 #include <algorithm>
+#include <array>
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
 #include <filesystem>
+#include <string_view>
 
 // Optional: use nlohmann/json if available (header-only, single include)
 #if __has_include(<nlohmann/json.hpp>)
@@ -19,492 +28,709 @@
     #define LEVEL_LOADER_HAS_JSON 0
 #endif
 
-// Helper to extract value between quotes or after colon
-std::string extractValue(const std::string& str, const std::string& key) {
-    size_t keyPos = str.find("\"" + key + "\"");
-    if (keyPos == std::string::npos) return "";
+namespace {
+
+// Scalar (or raw nested) value as it appears in the level text
+struct JsonValue {
+    enum class Kind { String, Number, Literal, Composite };
+    Kind kind = Kind::Literal;
+    std::string_view text;   // String: between the quotes, escapes left as-is; Composite: the whole [..] / {..}
+};
+
+// Single-pass reader for the legacy path: walks the level text once and hands out views into it
+// (nothing is copied while scanning). Stops at the first syntax error and remembers where it was.
+// Trailing commas are accepted, like the old substring parser did.
+class JsonReader {
+public:
+    explicit JsonReader(std::string_view text) : text(text), pos(0), errorPos(std::string_view::npos), error("") {}
+
+    bool failed() const { return errorPos != std::string_view::npos; }
+    const char* getError() const { return error; }
+
+    // 1-based line / column of the error
+    void getErrorLocation(std::size_t& line, std::size_t& column) const {
+        line = 1;
+        std::size_t lineStart = 0;
+        for (std::size_t i = 0; i < errorPos && i < text.size(); ++i) {
+            if (text[i] == '\n') {
+                line++;
+                lineStart = i + 1;
+            }
+        }
+        column = errorPos - lineStart + 1;
+    }
 
-    size_t colonPos = str.find(":", keyPos);
-    if (colonPos == std::string::npos) return "";
+    // Next significant character ('\0' at the end)
+    char peek() {
+        skipWhitespace();
+        return pos < text.size() ? text[pos] : '\0';
+    }
 
-    size_t valueStart = str.find_first_not_of(" \t:", colonPos);
-    if (valueStart == std::string::npos) return "";
+    bool atEnd() { return peek() == '\0'; }
 
-    size_t valueEnd = str.find_first_of(",}", valueStart);
-    if (valueEnd == std::string::npos) valueEnd = str.length();
+    bool fail(const char* message) {
+        if (!failed()) {
+            errorPos = pos;
+            error = message;
+        }
+        return false;
+    }
 
-    std::string value = str.substr(valueStart, valueEnd - valueStart);
-    // Remove quotes if present (can be at start, end, or both)
-    while (!value.empty() && (value.front() == '"' || value.front() == '\'')) {
-        value = value.substr(1);
+    // onKey(key) is called for each member and must read or skip its value
+    template <typename OnKey>
+    bool readObject(OnKey&& onKey) {
+        if (!expect('{', "expected '{'")) return false;
+        if (consume('}')) return true;
+        while (true) {
+            std::string_view key;
+            if (!readString(key)) return false;
+            if (!expect(':', "expected ':' after key")) return false;
+            if (!onKey(key)) return false;
+            if (consume(',')) {
+                if (consume('}')) return true;
+                continue;
+            }
+            if (consume('}')) return true;
+            return fail("expected ',' or '}'");
+        }
     }
-    while (!value.empty() && (value.back() == '"' || value.back() == '\'' || value.back() == ' ' || value.back() == '\t')) {
-            value = value.substr(0, value.length() - 1);
+
+    // onElement() is called for each element and must read or skip it
+    template <typename OnElement>
+    bool readArray(OnElement&& onElement) {
+        if (!expect('[', "expected '['")) return false;
+        if (consume(']')) return true;
+        while (true) {
+            if (!onElement()) return false;
+            if (consume(',')) {
+                if (consume(']')) return true;
+                continue;
+            }
+            if (consume(']')) return true;
+            return fail("expected ',' or ']'");
         }
-    // Trim whitespace
-    size_t first = value.find_first_not_of(" \t\r\n");
-    if (first != std::string::npos) {
-        size_t last = value.find_last_not_of(" \t\r\n");
-        value = value.substr(first, last - first + 1);
-    } else {
-        value = "";
     }
-    return value;
-}
 
-std::string LevelLoader::resolveLevelPath(const std::string& filepath) {
-    namespace fs = std::filesystem;
-    fs::path inputPath(filepath);
+    bool readString(std::string_view& out) {
+        if (!expect('"', "expected string")) return false;
+        const std::size_t start = pos;
+        while (pos < text.size() && text[pos] != '"') {
+            if (text[pos] == '\n') return fail("unterminated string");
+            pos += text[pos] == '\\' ? 2 : 1;
+        }
+        if (pos >= text.size()) return fail("unterminated string");
+        out = text.substr(start, pos - start);
+        pos++;
+        return true;
+    }
 
-    if (inputPath.is_absolute()) {
-        std::error_code ec;
-        if (fs::exists(inputPath, ec)) {
-            return inputPath.string();
+    bool readValue(JsonValue& out) {
+        const char c = peek();
+        if (c == '"') {
+            out.kind = JsonValue::Kind::String;
+            return readString(out.text);
+        }
+        if (c == '{' || c == '[') {
+            const std::size_t start = pos;
+            if (!skipValue()) return false;
+            out.kind = JsonValue::Kind::Composite;
+            out.text = text.substr(start, pos - start);
+            return true;
         }
-        return filepath;
+        if (c == '-' || c == '+' || c == '.' || (c >= '0' && c <= '9')) {
+            out.kind = JsonValue::Kind::Number;
+            out.text = scanWhile([](char ch) {
+                return (ch >= '0' && ch <= '9') || ch == '-' || ch == '+' || ch == '.' || ch == 'e' || ch == 'E';
+            });
+            return true;
+        }
+        const std::string_view word = scanWhile([](char ch) {
+            return (ch >= 'a' && ch <= 'z') || (ch >= 'A' && ch <= 'Z');
+        });
+        if (word == "true" || word == "false" || word == "null") {
+            out.kind = JsonValue::Kind::Literal;
+            out.text = word;
+            return true;
+        }
+        pos -= word.size();
+        return fail(c == '\0' ? "unexpected end of file" : "unexpected character");
     }
 
-    std::vector<fs::path> candidates;
+    bool skipValue() {
+        const char c = peek();
+        if (c == '{') {
+            return readObject([this](std::string_view) { return skipValue(); });
+        }
+        if (c == '[') {
+            return readArray([this]() { return skipValue(); });
+        }
+        JsonValue ignored;
+        return readValue(ignored);
+    }
 
-    // Prefer project source directory (PlatformerGame)
-    fs::path probe = fs::current_path();
-    for (int i = 0; i < 10 && !probe.empty(); ++i) {
-        if (probe.filename() == "PlatformerGame") {
-            candidates.push_back(probe / inputPath);
-            break;
+private:
+    void skipWhitespace() {
+        while (pos < text.size() && (text[pos] == ' ' || text[pos] == '\t' || text[pos] == '\r' || text[pos] == '\n')) {
+            pos++;
         }
-        probe = probe.parent_path();
     }
 
-    // Current working directory
-    candidates.push_back(fs::current_path() / inputPath);
+    bool consume(char c) {
+        if (peek() != c) return false;
+        pos++;
+        return true;
+    }
 
-    // Common build output directories
-    fs::path cwd = fs::current_path();
-    candidates.push_back(cwd / "bin" / "Release" / inputPath);
-    candidates.push_back(cwd / "bin" / "Debug" / inputPath);
-    candidates.push_back(cwd.parent_path() / inputPath);
+    bool expect(char c, const char* message) {
+        return consume(c) || fail(peek() == '\0' ? "unexpected end of file" : message);
+    }
 
-    for (const auto& candidate : candidates) {
-        if (candidate.empty()) continue;
-        std::error_code ec;
-        if (fs::exists(candidate, ec)) {
-            return candidate.string();
+    template <typename Predicate>
+    std::string_view scanWhile(Predicate predicate) {
+        const std::size_t start = pos;
+        while (pos < text.size() && predicate(text[pos])) {
+            pos++;
         }
+        return text.substr(start, pos - start);
     }
 
-    return filepath;
-}
+    std::string_view text;
+    std::size_t pos;
+    std::size_t errorPos;
+    const char* error;
+};
+
+// Members of one flat level object (platform, enemy...), looked up by key once the object is read.
+// Fixed capacity: reading an object never allocates; members past the capacity are ignored.
+class JsonFields {
+public:
+    void clear() { count = 0; }
+
+    void add(std::string_view key, const JsonValue& value) {
+        if (count < entries.size()) {
+            entries[count++] = Entry{key, value};
+        }
+    }
 
-std::unique_ptr<LevelData> LevelLoader::loadFromFile(const std::string& filepath) {
-    std::string resolvedPath = resolveLevelPath(filepath);
-    std::ifstream file(resolvedPath);
-    if (!file.is_open()) {
-        // Fallback to original path if resolution failed
-        if (resolvedPath != filepath) {
-            file.open(filepath);
+    // First member named `key` with a non-empty value (the old parser's notion of "present")
+    const JsonValue* find(std::string_view key) const {
+        for (std::size_t i = 0; i < count; ++i) {
+            if (entries[i].key == key) {
+                return entries[i].value.text.empty() ? nullptr : &entries[i].value;
+            }
         }
+        return nullptr;
     }
 
-    if (!file.is_open()) {
-        std::cout << "Warning: Could not open level file: " << resolvedPath << "\n";
-        std::cout << "Loading default level instead.\n";
-        return createDefaultLevel();
+    bool has(std::string_view key) const { return find(key) != nullptr; }
+
+private:
+    struct Entry {
+        std::string_view key;
+        JsonValue value;
+    };
+
+    std::array<Entry, 48> entries;
+    std::size_t count = 0;
+};
+
+bool equalsIgnoreCase(std::string_view a, std::string_view b) {
+    if (a.size() != b.size()) return false;
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        if (std::tolower(static_cast<unsigned char>(a[i])) != std::tolower(static_cast<unsigned char>(b[i]))) {
+            return false;
+        }
     }
+    return true;
+}
 
-    // Read entire file
-    std::stringstream buffer;
-    buffer << file.rdbuf();
-    std::string content = buffer.str();
-    file.close();
+// Numbers may also come quoted ("x": "120"); anything unreadable is 0, as before
+float toFloat(const JsonValue* value, float fallback) {
+    if (!value) return fallback;
+    char buffer[64];
+    const std::size_t length = std::min(value->text.size(), sizeof(buffer) - 1);
+    std::memcpy(buffer, value->text.data(), length);
+    buffer[length] = '\0';
+    return std::strtof(buffer, nullptr);
+}
 
-#if LEVEL_LOADER_HAS_JSON
-    // Preferred path: modern, robust JSON parsing via nlohmann/json
-    try {
-        nlohmann::json j = nlohmann::json::parse(content);
-
-        auto levelData = std::make_unique<LevelData>();
-
-        // Basic metadata
-        levelData->name       = j.value("name",      std::string("Loaded Level"));
-        levelData->levelId    = j.value("levelId",   std::string{});
-        levelData->zoneNumber = j.value("zoneNumber", 1);
-        levelData->isBossLevel = j.value("isBossLevel", false);
-        levelData->nextZone   = j.value("nextZone",  std::string{});
-
-        // Level graph: nextLevels (array of strings)
-        if (j.contains("nextLevels") && j["nextLevels"].is_array()) {
-            for (const auto& v : j["nextLevels"]) {
-                if (v.is_string()) {
-                    levelData->nextLevels.push_back(v.get<std::string>());
+bool toBool(const JsonValue* value, bool fallback) {
+    if (!value) return fallback;
+    if (equalsIgnoreCase(value->text, "true") || value->text == "1") return true;
+    if (equalsIgnoreCase(value->text, "false") || value->text == "0") return false;
+    return fallback;
+}
+
+void appendUtf8(std::string& out, unsigned int codepoint) {
+    if (codepoint < 0x80) {
+        out += static_cast<char>(codepoint);
+    } else if (codepoint < 0x800) {
+        out += static_cast<char>(0xC0 | (codepoint >> 6));
+        out += static_cast<char>(0x80 | (codepoint & 0x3F));
+    } else {
+        out += static_cast<char>(0xE0 | (codepoint >> 12));
+        out += static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F));
+        out += static_cast<char>(0x80 | (codepoint & 0x3F));
+    }
+}
+
+// Copies out a string value (the only allocation), decoding escapes when there are any
+std::string toString(const JsonValue* value) {
+    if (!value) return std::string();
+    const std::string_view text = value->text;
+    if (value->kind != JsonValue::Kind::String || text.find('\\') == std::string_view::npos) {
+        return std::string(text);
+    }
+
+    std::string out;
+    out.reserve(text.size());
+    for (std::size_t i = 0; i < text.size(); ++i) {
+        if (text[i] != '\\' || i + 1 >= text.size()) {
+            out += text[i];
+            continue;
+        }
+        const char escaped = text[++i];
+        switch (escaped) {
+            case 'n': out += '\n'; break;
+            case 't': out += '\t'; break;
+            case 'r': out += '\r'; break;
+            case 'b': out += '\b'; break;
+            case 'f': out += '\f'; break;
+            case 'u':
+                if (i + 4 < text.size()) {
+                    char hex[5] = {text[i + 1], text[i + 2], text[i + 3], text[i + 4], '\0'};
+                    appendUtf8(out, static_cast<unsigned int>(std::strtoul(hex, nullptr, 16)));
+                    i += 4;
                 }
-            }
+                break;
+            default: out += escaped; break;   // \" \\ \/
         }
+    }
+    return out;
+}
 
-        // Start position: [x, y]
-        levelData->startPosition = sf::Vector2f(100.0f, 100.0f);
-        if (j.contains("startPosition") && j["startPosition"].is_array() && j["startPosition"].size() >= 2) {
-            float x = j["startPosition"][0].get<float>();
-            float y = j["startPosition"][1].get<float>();
-            levelData->startPosition = sf::Vector2f(x, y);
-        }
+// [x, y] into `out`; false (out untouched) unless both numbers are there
+bool toVector(const JsonValue* value, sf::Vector2f& out) {
+    if (!value || value->kind != JsonValue::Kind::Composite) return false;
+    JsonReader reader(value->text);
+    JsonValue components[2];
+    std::size_t count = 0;
+    reader.readArray([&]() {
+        if (count < 2) return reader.readValue(components[count++]);
+        return reader.skipValue();
+    });
+    if (reader.failed() || count < 2 || components[0].text.empty() || components[1].text.empty()) return false;
+    out = sf::Vector2f(toFloat(&components[0], 0.0f), toFloat(&components[1], 0.0f));
+    return true;
+}
 
-        // Platforms
-        if (j.contains("platforms") && j["platforms"].is_array()) {
-            for (const auto& p : j["platforms"]) {
-                if (!p.is_object()) continue;
-                float x = p.value("x", 0.0f);
-                float y = p.value("y", 0.0f);
-                float w = p.value("width", 0.0f);
-                float h = p.value("height", 0.0f);
-                std::string typeStr = p.value("type", std::string("floor"));
-                Platform::Type type = Platform::Type::Floor;
-                if (typeStr == "endfloor") {
-                    type = Platform::Type::EndFloor;
-                    std::cout << "Chargement plateforme avec type: endfloor\n";
-                } else {
-                    std::cout << "Chargement plateforme avec type: floor (typeStr=" << typeStr << ")\n";
-                }
-                levelData->platforms.push_back(std::make_unique<Platform>(x, y, w, h, type));
-            }
+// Reads an array of flat objects, calling onObject(fields) for each one (other elements are skipped)
+template <typename OnObject>
+bool readObjectArray(JsonReader& reader, JsonFields& fields, OnObject&& onObject) {
+    return reader.readArray([&]() {
+        if (reader.peek() != '{') return reader.skipValue();
+        fields.clear();
+        const bool read = reader.readObject([&](std::string_view key) {
+            JsonValue value;
+            if (!reader.readValue(value)) return false;
+            fields.add(key, value);
+            return true;
+        });
+        if (!read) return false;
+        onObject(fields);
+        return true;
+    });
+}
+
+// Preset overrides shared by every enemy type
+void readEnemyStats(const JsonFields& fields, EnemyStats& stats) {
+    stats.maxHP = static_cast<int>(toFloat(fields.find("maxHP"), static_cast<float>(stats.maxHP)));
+    stats.sizeX = toFloat(fields.find("sizeX"), stats.sizeX);
+    stats.sizeY = toFloat(fields.find("sizeY"), stats.sizeY);
+    stats.damage = static_cast<int>(toFloat(fields.find("damage"), static_cast<float>(stats.damage)));
+    stats.color.r = static_cast<sf::Uint8>(toFloat(fields.find("colorR"), stats.color.r));
+    stats.color.g = static_cast<sf::Uint8>(toFloat(fields.find("colorG"), stats.color.g));
+    stats.color.b = static_cast<sf::Uint8>(toFloat(fields.find("colorB"), stats.color.b));
+}
+
+// Movement and shooting overrides (patrol / flying enemies)
+void readMovingEnemyStats(const JsonFields& fields, EnemyStats& stats) {
+    stats.speed = toFloat(fields.find("speed"), stats.speed);
+    stats.canShoot = toBool(fields.find("canShoot"), stats.canShoot);
+    if (stats.canShoot) {
+        stats.shootCooldown = toFloat(fields.find("shootCooldown"), stats.shootCooldown);
+        stats.projectileSpeed = toFloat(fields.find("projectileSpeed"), stats.projectileSpeed);
+        stats.projectileRange = toFloat(fields.find("projectileRange"), stats.projectileRange);
+        stats.shootRange = toFloat(fields.find("shootRange"), stats.shootRange);
+    }
+}
+
+FlameDirection toFlameDirection(std::string_view dir) {
+    if (equalsIgnoreCase(dir, "left")) return FlameDirection::Left;
+    if (equalsIgnoreCase(dir, "up")) return FlameDirection::Up;
+    if (equalsIgnoreCase(dir, "down")) return FlameDirection::Down;
+    return FlameDirection::Right;
+}
+
+void storeStats(const EnemyStats& stats, LevelBinary::EnemyRecord& record) {
+    record.maxHP = stats.maxHP;
+    record.sizeX = stats.sizeX;
+    record.sizeY = stats.sizeY;
+    record.speed = stats.speed;
+    record.damage = stats.damage;
+    record.color[0] = stats.color.r;
+    record.color[1] = stats.color.g;
+    record.color[2] = stats.color.b;
+    record.color[3] = stats.color.a;
+    record.canShoot = stats.canShoot ? 1u : 0u;
+    record.shootCooldown = stats.shootCooldown;
+    record.projectileSpeed = stats.projectileSpeed;
+    record.projectileRange = stats.projectileRange;
+    record.shootRange = stats.shootRange;
+}
+
+EnemyStats loadStats(const LevelBinary::EnemyRecord& record) {
+    EnemyStats stats;
+    stats.maxHP = record.maxHP;
+    stats.sizeX = record.sizeX;
+    stats.sizeY = record.sizeY;
+    stats.speed = record.speed;
+    stats.damage = record.damage;
+    stats.color = sf::Color(record.color[0], record.color[1], record.color[2], record.color[3]);
+    stats.canShoot = record.canShoot != 0;
+    stats.shootCooldown = record.shootCooldown;
+    stats.projectileSpeed = record.projectileSpeed;
+    stats.projectileRange = record.projectileRange;
+    stats.shootRange = record.shootRange;
+    return stats;
+}
+
+// Enemy object of a level file to its record; false for incomplete objects and unknown types
+bool readEnemy(const JsonFields& fields, LevelBinary::EnemyRecord& record) {
+    const JsonValue* typeVal = fields.find("type");
+    if (!typeVal || !fields.has("x") || !fields.has("y")) {
+        return false;
+    }
+
+    record = LevelBinary::EnemyRecord{};
+    record.x = toFloat(fields.find("x"), 0.0f);
+    record.y = toFloat(fields.find("y"), 0.0f);
+
+    // Trap parameters keep the constructor defaults unless the level sets them
+    auto override = [&](const char* key, LevelBinary::EnemyOverride bit, float& target) {
+        if (const JsonValue* v = fields.find(key)) {
+            target = toFloat(v, 0.0f);
+            record.overrides |= bit;
         }
+    };
+
+    const std::string_view type = typeVal->text;
+    EnemyStats stats;
+    if (type == "patrol") {
+        record.kind = static_cast<std::uint32_t>(LevelBinary::EnemyKind::Patrol);
+        record.patrolDistance = toFloat(fields.find("patrolDistance"), 100.0f);
+        stats = EnemyPresets::Basic();
+        readEnemyStats(fields, stats);
+        readMovingEnemyStats(fields, stats);
+    } else if (type == "flying") {
+        record.kind = static_cast<std::uint32_t>(LevelBinary::EnemyKind::Flying);
+        record.patrolDistance = toFloat(fields.find("patrolDistance"), 200.0f);
+        record.horizontalPatrol = toBool(fields.find("horizontalPatrol"), true) ? 1u : 0u;
+        stats = EnemyPresets::FlyingBasic();
+        readEnemyStats(fields, stats);
+        readMovingEnemyStats(fields, stats);
+    } else if (type == "spike") {
+        record.kind = static_cast<std::uint32_t>(LevelBinary::EnemyKind::Spike);
+    } else if (type == "flameTrap") {
+        record.kind = static_cast<std::uint32_t>(LevelBinary::EnemyKind::FlameTrap);
+        stats = EnemyPresets::FlameHorizontal();
+        readEnemyStats(fields, stats);
+        const JsonValue* dir = fields.find("direction");
+        record.direction = static_cast<std::uint32_t>(toFlameDirection(dir ? dir->text : std::string_view()));
+        override("activeDuration", LevelBinary::OverrideActiveDuration, record.activeDuration);
+        override("inactiveDuration", LevelBinary::OverrideInactiveDuration, record.inactiveDuration);
+        override("shotInterval", LevelBinary::OverrideShotInterval, record.shotInterval);
+        override("projectileSpeed", LevelBinary::OverrideProjectileSpeed, record.trapProjectileSpeed);
+        override("projectileRange", LevelBinary::OverrideProjectileRange, record.trapProjectileRange);
+    } else if (type == "rotatingTrap") {
+        record.kind = static_cast<std::uint32_t>(LevelBinary::EnemyKind::RotatingTrap);
+        stats = EnemyPresets::RotatingSlow();
+        readEnemyStats(fields, stats);
+        override("rotationSpeed", LevelBinary::OverrideRotationSpeed, record.rotationSpeed);
+        override("armLength", LevelBinary::OverrideArmLength, record.armLength);
+        override("armThickness", LevelBinary::OverrideArmThickness, record.armThickness);
+    } else {
+        return false;
+    }
+    storeStats(stats, record);
+    return true;
+}
 
-        // Checkpoints
-        if (j.contains("checkpoints") && j["checkpoints"].is_array()) {
-            for (const auto& c : j["checkpoints"]) {
-                if (!c.is_object()) continue;
-                float x = c.value("x", 0.0f);
-                float y = c.value("y", 0.0f);
-                std::string id = c.value("id", std::string{});
-                if (!id.empty()) {
-                    levelData->checkpoints.push_back(std::make_unique<Checkpoint>(x, y, id));
-                }
-            }
+// Runtime enemy built from its record
+std::unique_ptr<Enemy> makeEnemy(const LevelBinary::EnemyRecord& record) {
+    const EnemyStats stats = loadStats(record);
+    const std::uint32_t overrides = record.overrides;
+
+    switch (static_cast<LevelBinary::EnemyKind>(record.kind)) {
+        case LevelBinary::EnemyKind::Patrol:
+            return std::make_unique<PatrolEnemy>(record.x, record.y, record.patrolDistance, stats);
+        case LevelBinary::EnemyKind::Flying:
+            return std::make_unique<FlyingEnemy>(record.x, record.y, record.patrolDistance,
+                                                 record.horizontalPatrol != 0, stats);
+        case LevelBinary::EnemyKind::Spike:
+            return std::make_unique<Spike>(record.x, record.y);
+        case LevelBinary::EnemyKind::FlameTrap: {
+            auto flame = std::make_unique<FlameTrap>(record.x, record.y, stats);
+            flame->setDirection(static_cast<FlameDirection>(record.direction));
+            if (overrides & LevelBinary::OverrideActiveDuration) flame->setActiveDuration(record.activeDuration);
+            if (overrides & LevelBinary::OverrideInactiveDuration) flame->setInactiveDuration(record.inactiveDuration);
+            if (overrides & LevelBinary::OverrideShotInterval) flame->setShotInterval(record.shotInterval);
+            if (overrides & LevelBinary::OverrideProjectileSpeed) flame->setProjectileSpeed(record.trapProjectileSpeed);
+            if (overrides & LevelBinary::OverrideProjectileRange) flame->setProjectileRange(record.trapProjectileRange);
+            return flame;
         }
+        case LevelBinary::EnemyKind::RotatingTrap: {
+            auto trap = std::make_unique<RotatingTrap>(record.x, record.y, stats);
+            if (overrides & LevelBinary::OverrideRotationSpeed) trap->setRotationSpeed(record.rotationSpeed);
+            if (overrides & LevelBinary::OverrideArmLength) trap->setArmLength(record.armLength);
+            if (overrides & LevelBinary::OverrideArmThickness) trap->setArmThickness(record.armThickness);
+            return trap;
+        }
+    }
+    return nullptr;
+}
 
-        // Interactive objects (doors, terminals, turrets...)
-        if (j.contains("interactiveObjects") && j["interactiveObjects"].is_array()) {
-            for (const auto& io : j["interactiveObjects"]) {
-                if (!io.is_object()) continue;
-                float x = io.value("x", 0.0f);
-                float y = io.value("y", 0.0f);
-                float w = io.value("width", 0.0f);
-                float h = io.value("height", 0.0f);
-                std::string typeStr = io.value("type", std::string{});
-                std::string id = io.value("id", std::string{});
+} // namespace
 
-                if (id.empty()) continue;
+std::string LevelLoader::resolveLevelPath(const std::string& filepath) {
+    // Mount table and index built once at startup: no filesystem probing per load
+    return AssetFileSystem::getInstance().resolve(filepath);
+}
 
-                InteractiveType type = InteractiveType::Terminal;
-                if (typeStr == "terminal" || typeStr == "Terminal") {
-                    type = InteractiveType::Terminal;
-                } else if (typeStr == "door" || typeStr == "Door") {
-                    type = InteractiveType::Door;
-                } else if (typeStr == "turret" || typeStr == "Turret") {
-                    type = InteractiveType::Turret;
-                }
+bool LevelLoader::hasJsonLibrary() {
+    return LEVEL_LOADER_HAS_JSON != 0;
+}
+
+namespace {
 
-                levelData->interactiveObjects.push_back(
-                    std::make_unique<InteractiveObject>(x, y, w, h, type, id)
-                );
+#if LEVEL_LOADER_HAS_JSON
+// nlohmann/json: level text to records (throws on malformed input)
+void parseJsonRecords(std::string_view content, LevelBinary::LevelRecords& records) {
+    nlohmann::json j = nlohmann::json::parse(content.begin(), content.end());
+
+    // Basic metadata
+    records.name       = records.addString(j.value("name", std::string("Loaded Level")));
+    records.levelId    = records.addString(j.value("levelId", std::string{}));
+    records.zoneNumber = j.value("zoneNumber", 1);
+    records.isBossLevel = j.value("isBossLevel", false);
+    records.sectorSize = j.value("sectorSize", 0.0f);
+    records.nextZone   = records.addString(j.value("nextZone", std::string{}));
+
+    // Level graph: nextLevels (array of strings)
+    if (j.contains("nextLevels") && j["nextLevels"].is_array()) {
+        for (const auto& v : j["nextLevels"]) {
+            if (v.is_string()) {
+                records.nextLevels.push_back(records.addString(v.get<std::string>()));
             }
         }
+    }
 
-        // Camera zones
-        if (j.contains("cameraZones") && j["cameraZones"].is_array()) {
-            for (const auto& cz : j["cameraZones"]) {
-                if (!cz.is_object()) continue;
-                CameraZone zone{};
-                zone.minX = cz.value("minX", 0.0f);
-                zone.maxX = cz.value("maxX", 0.0f);
-                zone.minY = cz.value("minY", 0.0f);
-                zone.maxY = cz.value("maxY", 0.0f);
-                levelData->cameraZones.push_back(zone);
+    // Start position: [x, y]
+    if (j.contains("startPosition") && j["startPosition"].is_array() && j["startPosition"].size() >= 2) {
+        records.startX = j["startPosition"][0].get<float>();
+        records.startY = j["startPosition"][1].get<float>();
+    }
+
+    // Platforms
+    if (j.contains("platforms") && j["platforms"].is_array()) {
+        for (const auto& p : j["platforms"]) {
+            if (!p.is_object()) continue;
+            std::string typeStr = p.value("type", std::string("floor"));
+            Platform::Type type = Platform::Type::Floor;
+            if (typeStr == "endfloor") {
+                type = Platform::Type::EndFloor;
+                std::cout << "Chargement plateforme avec type: endfloor\n";
+            } else {
+                std::cout << "Chargement plateforme avec type: floor (typeStr=" << typeStr << ")\n";
             }
+            records.platforms.push_back(LevelBinary::PlatformRecord{
+                p.value("x", 0.0f), p.value("y", 0.0f), p.value("width", 0.0f), p.value("height", 0.0f),
+                static_cast<std::uint32_t>(type)});
         }
+    }
 
-        // Portals (zones de transition vers d'autres niveaux)
-        if (j.contains("portals") && j["portals"].is_array()) {
-            for (const auto& p : j["portals"]) {
-                if (!p.is_object()) continue;
-                Portal portal{};
-                portal.x = p.value("x", 0.0f);
-                portal.y = p.value("y", 0.0f);
-                portal.width = p.value("width", 50.0f);
-                portal.height = p.value("height", 100.0f);
-                portal.targetLevel = p.value("targetLevel", std::string{});
-                portal.spawnDirection = p.value("spawnDirection", std::string("default"));
-                portal.useCustomSpawn = p.value("useCustomSpawn", false);
-                if (portal.useCustomSpawn && p.contains("customSpawnPos") && p["customSpawnPos"].is_array() && p["customSpawnPos"].size() >= 2) {
-                    portal.customSpawnPos.x = p["customSpawnPos"][0].get<float>();
-                    portal.customSpawnPos.y = p["customSpawnPos"][1].get<float>();
-                }
-                if (!portal.targetLevel.empty()) {
-                    levelData->portals.push_back(portal);
-                }
+    // Checkpoints
+    if (j.contains("checkpoints") && j["checkpoints"].is_array()) {
+        for (const auto& c : j["checkpoints"]) {
+            if (!c.is_object()) continue;
+            std::string id = c.value("id", std::string{});
+            if (!id.empty()) {
+                records.checkpoints.push_back(LevelBinary::CheckpointRecord{
+                    c.value("x", 0.0f), c.value("y", 0.0f), records.addString(id)});
             }
         }
+    }
 
-        // Enemies
-        if (j.contains("enemies") && j["enemies"].is_array()) {
-            auto parseDirection = [](const std::string& dir) {
-                std::string lower = dir;
-                std::transform(lower.begin(), lower.end(), lower.begin(), ::tolower);
-                if (lower == "left") return FlameDirection::Left;
-                if (lower == "up") return FlameDirection::Up;
-                if (lower == "down") return FlameDirection::Down;
-                return FlameDirection::Right;
-            };
-            for (const auto& e : j["enemies"]) {
-                if (!e.is_object()) continue;
-                float x = e.value("x", 0.0f);
-                float y = e.value("y", 0.0f);
-                std::string typeStr = e.value("type", std::string("patrol"));
-                
-                if (typeStr == "patrol") {
-                    float patrolDistance = e.value("patrolDistance", 100.0f);
-                    // Start from preset defaults, then override with JSON values
-                    EnemyStats stats = EnemyPresets::Basic();
-                    stats.maxHP = e.value("maxHP", stats.maxHP);
-                    stats.sizeX = e.value("sizeX", stats.sizeX);
-                    stats.sizeY = e.value("sizeY", stats.sizeY);
-                    stats.speed = e.value("speed", stats.speed);
-                    stats.damage = e.value("damage", stats.damage);
-                    stats.canShoot = e.value("canShoot", stats.canShoot);
-                    if (stats.canShoot) {
-                        stats.shootCooldown = e.value("shootCooldown", stats.shootCooldown);
-                        stats.projectileSpeed = e.value("projectileSpeed", stats.projectileSpeed);
-                        stats.projectileRange = e.value("projectileRange", stats.projectileRange);
-                        stats.shootRange = e.value("shootRange", stats.shootRange);
-                    }
-                    stats.color.r = static_cast<sf::Uint8>(e.value("colorR", static_cast<int>(stats.color.r)));
-                    stats.color.g = static_cast<sf::Uint8>(e.value("colorG", static_cast<int>(stats.color.g)));
-                    stats.color.b = static_cast<sf::Uint8>(e.value("colorB", static_cast<int>(stats.color.b)));
-                    levelData->enemies.push_back(std::make_unique<PatrolEnemy>(x, y, patrolDistance, stats));
-                } else if (typeStr == "flying") {
-                    float patrolDistance = e.value("patrolDistance", 200.0f);
-                    bool horizontalPatrol = e.value("horizontalPatrol", true);
-                    // Start from preset defaults, then override with JSON values
-                    EnemyStats stats = EnemyPresets::FlyingBasic();
-                    stats.maxHP = e.value("maxHP", stats.maxHP);
-                    stats.sizeX = e.value("sizeX", stats.sizeX);
-                    stats.sizeY = e.value("sizeY", stats.sizeY);
-                    stats.speed = e.value("speed", stats.speed);
-                    stats.damage = e.value("damage", stats.damage);
-                    stats.canShoot = e.value("canShoot", stats.canShoot);
-                    if (stats.canShoot) {
-                        stats.shootCooldown = e.value("shootCooldown", stats.shootCooldown);
-                        stats.projectileSpeed = e.value("projectileSpeed", stats.projectileSpeed);
-                        stats.projectileRange = e.value("projectileRange", stats.projectileRange);
-                        stats.shootRange = e.value("shootRange", stats.shootRange);
-                    }
-                    stats.color.r = static_cast<sf::Uint8>(e.value("colorR", static_cast<int>(stats.color.r)));
-                    stats.color.g = static_cast<sf::Uint8>(e.value("colorG", static_cast<int>(stats.color.g)));
-                    stats.color.b = static_cast<sf::Uint8>(e.value("colorB", static_cast<int>(stats.color.b)));
-                    levelData->enemies.push_back(std::make_unique<FlyingEnemy>(x, y, patrolDistance, horizontalPatrol, stats));
-                } else if (typeStr == "spike") {
-                    levelData->enemies.push_back(std::make_unique<Spike>(x, y));
-                } else if (typeStr == "flameTrap") {
-                    EnemyStats stats = EnemyPresets::FlameHorizontal();
-                    stats.maxHP = e.value("maxHP", stats.maxHP);
-                    stats.sizeX = e.value("sizeX", stats.sizeX);
-                    stats.sizeY = e.value("sizeY", stats.sizeY);
-                    stats.damage = e.value("damage", stats.damage);
-                    stats.color.r = static_cast<sf::Uint8>(e.value("colorR", static_cast<int>(stats.color.r)));
-                    stats.color.g = static_cast<sf::Uint8>(e.value("colorG", static_cast<int>(stats.color.g)));
-                    stats.color.b = static_cast<sf::Uint8>(e.value("colorB", static_cast<int>(stats.color.b)));
-                    auto flame = std::make_unique<FlameTrap>(x, y, stats);
-                    std::string dirStr = e.value("direction", std::string("right"));
-                    flame->setDirection(parseDirection(dirStr));
-                    flame->setActiveDuration(e.value("activeDuration", 1.5f));
-                    flame->setInactiveDuration(e.value("inactiveDuration", 1.5f));
-                    flame->setShotInterval(e.value("shotInterval", 0.2f));
-                    flame->setProjectileSpeed(e.value("projectileSpeed", 350.0f));
-                    flame->setProjectileRange(e.value("projectileRange", 450.0f));
-                    levelData->enemies.push_back(std::move(flame));
-                } else if (typeStr == "rotatingTrap") {
-                    EnemyStats stats = EnemyPresets::RotatingSlow();
-                    stats.maxHP = e.value("maxHP", stats.maxHP);
-                    stats.sizeX = e.value("sizeX", stats.sizeX);
-                    stats.sizeY = e.value("sizeY", stats.sizeY);
-                    stats.damage = e.value("damage", stats.damage);
-                    stats.color.r = static_cast<sf::Uint8>(e.value("colorR", static_cast<int>(stats.color.r)));
-                    stats.color.g = static_cast<sf::Uint8>(e.value("colorG", static_cast<int>(stats.color.g)));
-                    stats.color.b = static_cast<sf::Uint8>(e.value("colorB", static_cast<int>(stats.color.b)));
-                    auto trap = std::make_unique<RotatingTrap>(x, y, stats);
-                    trap->setRotationSpeed(e.value("rotationSpeed", 120.0f));
-                    trap->setArmLength(e.value("armLength", stats.sizeX));
-                    trap->setArmThickness(e.value("armThickness", stats.sizeY));
-                    levelData->enemies.push_back(std::move(trap));
-                }
+    // Interactive objects (doors, terminals, turrets...)
+    if (j.contains("interactiveObjects") && j["interactiveObjects"].is_array()) {
+        for (const auto& io : j["interactiveObjects"]) {
+            if (!io.is_object()) continue;
+            std::string typeStr = io.value("type", std::string{});
+            std::string id = io.value("id", std::string{});
+
+            if (id.empty()) continue;
+
+            InteractiveType type = InteractiveType::Terminal;
+            if (typeStr == "terminal" || typeStr == "Terminal") {
+                type = InteractiveType::Terminal;
+            } else if (typeStr == "door" || typeStr == "Door") {
+                type = InteractiveType::Door;
+            } else if (typeStr == "turret" || typeStr == "Turret") {
+                type = InteractiveType::Turret;
             }
-        }
 
-        // Validation (same policy as legacy path)
-        if (levelData->platforms.empty()) {
-            std::cout << "Warning: Level has no platforms. Loading default level.\n";
-            return createDefaultLevel();
+            records.interactiveObjects.push_back(LevelBinary::InteractiveRecord{
+                io.value("x", 0.0f), io.value("y", 0.0f), io.value("width", 0.0f), io.value("height", 0.0f),
+                static_cast<std::uint32_t>(type), records.addString(id)});
         }
+    }
 
-        // Log level load summary (only key info)
-        std::cout << "Level loaded (json): " << levelData->name;
-        if (!levelData->levelId.empty()) {
-            std::cout << " (ID: " << levelData->levelId << ", Zone: " << levelData->zoneNumber << ")";
+    // Camera zones
+    if (j.contains("cameraZones") && j["cameraZones"].is_array()) {
+        for (const auto& cz : j["cameraZones"]) {
+            if (!cz.is_object()) continue;
+            records.cameraZones.push_back(LevelBinary::CameraZoneRecord{
+                cz.value("minX", 0.0f), cz.value("maxX", 0.0f), cz.value("minY", 0.0f), cz.value("maxY", 0.0f)});
         }
-        std::cout << "\n";
-
-        return levelData;
-    } catch (const std::exception& e) {
-        std::cout << "Warning: JSON parse failed for level '" << filepath
-                  << "': " << e.what() << "\n";
-        std::cout << "Falling back to legacy string parser.\n";
     }
-#endif // LEVEL_LOADER_HAS_JSON
 
-    // Legacy path: manual string parsing (kept as robust fallback)
-    auto levelData = std::make_unique<LevelData>();
-    levelData->name = "Loaded Level";
-    levelData->levelId = "";
-    levelData->zoneNumber = 1;
-    levelData->isBossLevel = false;
-    levelData->nextZone = "";
-    levelData->startPosition = sf::Vector2f(100.0f, 100.0f);
-
-    // Extract name
-    std::string nameValue = extractValue(content, "name");
-    if (!nameValue.empty()) {
-        levelData->name = nameValue;
-    }
-
-    // Extract levelId
-    std::string levelIdValue = extractValue(content, "levelId");
-    if (!levelIdValue.empty()) {
-        levelData->levelId = levelIdValue;
-    }
-
-    // Extract zoneNumber
-    std::string zoneNumberValue = extractValue(content, "zoneNumber");
-    if (!zoneNumberValue.empty()) {
-        levelData->zoneNumber = static_cast<int>(parseFloat(zoneNumberValue));
-    }
-
-    // Extract isBossLevel (boolean - can be true/false without quotes)
-    size_t isBossPos = content.find("\"isBossLevel\"");
-    if (isBossPos != std::string::npos) {
-        size_t colonPos = content.find(":", isBossPos);
-        if (colonPos != std::string::npos) {
-            size_t valueStart = content.find_first_not_of(" \t:", colonPos);
-            if (valueStart != std::string::npos) {
-                size_t valueEnd = content.find_first_of(",}", valueStart);
-                if (valueEnd == std::string::npos) valueEnd = content.length();
-                std::string isBossValue = trim(content.substr(valueStart, valueEnd - valueStart));
-                // Remove quotes if present
-                if (!isBossValue.empty() && isBossValue.front() == '"') {
-                    isBossValue = isBossValue.substr(1);
-                    if (!isBossValue.empty() && isBossValue.back() == '"') {
-                        isBossValue = isBossValue.substr(0, isBossValue.length() - 1);
-                    }
-                }
-                levelData->isBossLevel = (isBossValue == "true" || isBossValue == "True" || isBossValue == "1");
+    // Portals (zones de transition vers d'autres niveaux)
+    if (j.contains("portals") && j["portals"].is_array()) {
+        for (const auto& p : j["portals"]) {
+            if (!p.is_object()) continue;
+            std::string targetLevel = p.value("targetLevel", std::string{});
+            if (targetLevel.empty()) continue;
+            LevelBinary::PortalRecord portal{};
+            portal.x = p.value("x", 0.0f);
+            portal.y = p.value("y", 0.0f);
+            portal.width = p.value("width", 50.0f);
+            portal.height = p.value("height", 100.0f);
+            portal.targetLevel = records.addString(targetLevel);
+            portal.spawnDirection = records.addString(p.value("spawnDirection", std::string("default")));
+            portal.useCustomSpawn = p.value("useCustomSpawn", false) ? 1u : 0u;
+            if (portal.useCustomSpawn && p.contains("customSpawnPos") && p["customSpawnPos"].is_array() && p["customSpawnPos"].size() >= 2) {
+                portal.customSpawnX = p["customSpawnPos"][0].get<float>();
+                portal.customSpawnY = p["customSpawnPos"][1].get<float>();
             }
+            records.portals.push_back(portal);
         }
     }
 
-    // Extract nextZone
-    std::string nextZoneValue = extractValue(content, "nextZone");
-    if (!nextZoneValue.empty()) {
-        levelData->nextZone = nextZoneValue;
-    }
-
-    // Extract nextLevels (array of strings)
-    size_t nextLevelsStart = content.find("\"nextLevels\"");
-    if (nextLevelsStart != std::string::npos) {
-        // Find the opening bracket of the array
-        size_t arrayStart = content.find("[", nextLevelsStart);
-        if (arrayStart != std::string::npos) {
-            // Find the matching closing bracket
-            int bracketDepth = 1;
-            size_t arrayEnd = arrayStart + 1;
-            while (arrayEnd < content.length() && bracketDepth > 0) {
-                if (content[arrayEnd] == '[') bracketDepth++;
-                else if (content[arrayEnd] == ']') bracketDepth--;
-                if (bracketDepth > 0) arrayEnd++;
-            }
-            
-            if (arrayEnd < content.length() && bracketDepth == 0) {
-                // Extract the array content (between brackets)
-                std::string arrayContent = content.substr(arrayStart + 1, arrayEnd - arrayStart - 1);
-                size_t pos = 0;
-                // Find all quoted strings in the array
-                while ((pos = arrayContent.find("\"", pos)) != std::string::npos) {
-                    size_t quoteEnd = arrayContent.find("\"", pos + 1);
-                    if (quoteEnd == std::string::npos) break;
-                    std::string levelId = arrayContent.substr(pos + 1, quoteEnd - pos - 1);
-                    if (!levelId.empty()) {
-                        levelData->nextLevels.push_back(levelId);
-                        std::cout << "  Parsed nextLevel: " << levelId << "\n";
-                    }
-                    pos = quoteEnd + 1;
-                }
+    // Background tile variants
+    if (j.contains("backgroundTiles") && j["backgroundTiles"].is_array()) {
+        for (const auto& bt : j["backgroundTiles"]) {
+            if (!bt.is_object()) continue;
+            std::string tile = bt.value("tile", std::string{});
+            const float width = bt.value("width", 32.0f);
+            const float height = bt.value("height", 32.0f);
+            if (!tile.empty() && width > 0.0f && height > 0.0f) {
+                records.backgroundTiles.push_back(LevelBinary::BackgroundTileRecord{
+                    records.addString(tile), bt.value("x", 0.0f), bt.value("y", 0.0f), width, height});
             }
         }
     }
 
-    // Parse startPosition (array format: [x, y])
-    size_t startPosStart = content.find("\"startPosition\"");
-    if (startPosStart != std::string::npos) {
-        size_t arrayStart = content.find("[", startPosStart);
-        size_t arrayEnd = content.find("]", arrayStart);
-        if (arrayStart != std::string::npos && arrayEnd != std::string::npos) {
-            std::string arrayContent = content.substr(arrayStart + 1, arrayEnd - arrayStart - 1);
-            size_t commaPos = arrayContent.find(",");
-            if (commaPos != std::string::npos) {
-                std::string xStr = trim(arrayContent.substr(0, commaPos));
-                std::string yStr = trim(arrayContent.substr(commaPos + 1));
-                if (!xStr.empty() && !yStr.empty()) {
-                    float x = parseFloat(xStr);
-                    float y = parseFloat(yStr);
-                    levelData->startPosition = sf::Vector2f(x, y);
+    // Enemies
+    if (j.contains("enemies") && j["enemies"].is_array()) {
+        for (const auto& e : j["enemies"]) {
+            if (!e.is_object()) continue;
+            LevelBinary::EnemyRecord record{};
+            record.x = e.value("x", 0.0f);
+            record.y = e.value("y", 0.0f);
+            std::string typeStr = e.value("type", std::string("patrol"));
+
+            // Start from preset defaults, then override with JSON values
+            EnemyStats stats;
+            auto readStats = [&](bool moving) {
+                stats.maxHP = e.value("maxHP", stats.maxHP);
+                stats.sizeX = e.value("sizeX", stats.sizeX);
+                stats.sizeY = e.value("sizeY", stats.sizeY);
+                stats.damage = e.value("damage", stats.damage);
+                stats.color.r = static_cast<sf::Uint8>(e.value("colorR", static_cast<int>(stats.color.r)));
+                stats.color.g = static_cast<sf::Uint8>(e.value("colorG", static_cast<int>(stats.color.g)));
+                stats.color.b = static_cast<sf::Uint8>(e.value("colorB", static_cast<int>(stats.color.b)));
+                if (!moving) return;
+                stats.speed = e.value("speed", stats.speed);
+                stats.canShoot = e.value("canShoot", stats.canShoot);
+                if (stats.canShoot) {
+                    stats.shootCooldown = e.value("shootCooldown", stats.shootCooldown);
+                    stats.projectileSpeed = e.value("projectileSpeed", stats.projectileSpeed);
+                    stats.projectileRange = e.value("projectileRange", stats.projectileRange);
+                    stats.shootRange = e.value("shootRange", stats.shootRange);
                 }
+            };
+
+            if (typeStr == "patrol") {
+                record.kind = static_cast<std::uint32_t>(LevelBinary::EnemyKind::Patrol);
+                record.patrolDistance = e.value("patrolDistance", 100.0f);
+                stats = EnemyPresets::Basic();
+                readStats(true);
+            } else if (typeStr == "flying") {
+                record.kind = static_cast<std::uint32_t>(LevelBinary::EnemyKind::Flying);
+                record.patrolDistance = e.value("patrolDistance", 200.0f);
+                record.horizontalPatrol = e.value("horizontalPatrol", true) ? 1u : 0u;
+                stats = EnemyPresets::FlyingBasic();
+                readStats(true);
+            } else if (typeStr == "spike") {
+                record.kind = static_cast<std::uint32_t>(LevelBinary::EnemyKind::Spike);
+            } else if (typeStr == "flameTrap") {
+                record.kind = static_cast<std::uint32_t>(LevelBinary::EnemyKind::FlameTrap);
+                stats = EnemyPresets::FlameHorizontal();
+                readStats(false);
+                record.direction = static_cast<std::uint32_t>(toFlameDirection(e.value("direction", std::string("right"))));
+                record.activeDuration = e.value("activeDuration", 1.5f);
+                record.inactiveDuration = e.value("inactiveDuration", 1.5f);
+                record.shotInterval = e.value("shotInterval", 0.2f);
+                record.trapProjectileSpeed = e.value("projectileSpeed", 350.0f);
+                record.trapProjectileRange = e.value("projectileRange", 450.0f);
+                record.overrides = LevelBinary::OverrideActiveDuration | LevelBinary::OverrideInactiveDuration |
+                                   LevelBinary::OverrideShotInterval | LevelBinary::OverrideProjectileSpeed |
+                                   LevelBinary::OverrideProjectileRange;
+            } else if (typeStr == "rotatingTrap") {
+                record.kind = static_cast<std::uint32_t>(LevelBinary::EnemyKind::RotatingTrap);
+                stats = EnemyPresets::RotatingSlow();
+                readStats(false);
+                record.rotationSpeed = e.value("rotationSpeed", 120.0f);
+                record.armLength = e.value("armLength", stats.sizeX);
+                record.armThickness = e.value("armThickness", stats.sizeY);
+                record.overrides = LevelBinary::OverrideRotationSpeed | LevelBinary::OverrideArmLength |
+                                   LevelBinary::OverrideArmThickness;
+            } else {
+                continue;
             }
+            storeStats(stats, record);
+            records.enemies.push_back(record);
         }
     }
+}
+#endif // LEVEL_LOADER_HAS_JSON
 
-    // Parse platforms - find all {"x": ..., "y": ..., "width": ..., "height": ...}
-    size_t platformsStart = content.find("\"platforms\"");
-    if (platformsStart != std::string::npos) {
-        size_t arrayStart = content.find("[", platformsStart);
-        if (arrayStart != std::string::npos) {
-            // Find the matching closing bracket (handle nested brackets)
-            int bracketDepth = 1;
-            size_t platformsEnd = arrayStart + 1;
-            while (platformsEnd < content.length() && bracketDepth > 0) {
-                if (content[platformsEnd] == '[') bracketDepth++;
-                else if (content[platformsEnd] == ']') bracketDepth--;
-                if (bracketDepth > 0) platformsEnd++;
-            }
-            
-            if (platformsEnd < content.length() && bracketDepth == 0) {
-                std::string platformsSection = content.substr(arrayStart, platformsEnd - arrayStart);
-
-        size_t pos = 0;
-        while ((pos = platformsSection.find("{", pos)) != std::string::npos) {
-            size_t objEnd = platformsSection.find("}", pos);
-            if (objEnd == std::string::npos) break;
-
-            std::string obj = platformsSection.substr(pos, objEnd - pos + 1);
-
-            std::string xVal = extractValue(obj, "x");
-            std::string yVal = extractValue(obj, "y");
-            std::string wVal = extractValue(obj, "width");
-            std::string hVal = extractValue(obj, "height");
-            std::string typeVal = extractValue(obj, "type");
-
-            if (!xVal.empty() && !yVal.empty() && !wVal.empty() && !hVal.empty()) {
-                float x = parseFloat(xVal);
-                float y = parseFloat(yVal);
-                float w = parseFloat(wVal);
-                float h = parseFloat(hVal);
+// Built-in reader: level text to records. False (error already printed) on a syntax error.
+bool readLevelRecords(std::string_view content, const std::string& filepath, LevelBinary::LevelRecords& records) {
+    // Metadata stays as views until the end: only what is kept gets copied
+    JsonValue name{JsonValue::Kind::Literal, "Loaded Level"};
+    JsonValue levelId;
+    JsonValue nextZone;
+
+    JsonReader reader(content);
+    JsonFields fields;
+    JsonValue value;
+
+    reader.readObject([&](std::string_view key) {
+        if (key == "platforms") {
+            return readObjectArray(reader, fields, [&](const JsonFields& f) {
+                if (!f.has("x") || !f.has("y") || !f.has("width") || !f.has("height")) return;
+                const std::string_view typeVal = f.find("type") ? f.find("type")->text : std::string_view();
                 Platform::Type type = Platform::Type::Floor;
                 if (typeVal == "endfloor") {
                     type = Platform::Type::EndFloor;
@@ -512,371 +738,340 @@ std::unique_ptr<LevelData> LevelLoader::loadFromFile(const std::string& filepath
                 } else {
                     std::cout << "Chargement plateforme (fallback) avec type: floor (typeVal=" << typeVal << ")\n";
                 }
-                levelData->platforms.push_back(std::make_unique<Platform>(x, y, w, h, type));
-            }
-
-            pos = objEnd + 1;
+                records.platforms.push_back(LevelBinary::PlatformRecord{
+                    toFloat(f.find("x"), 0.0f), toFloat(f.find("y"), 0.0f),
+                    toFloat(f.find("width"), 0.0f), toFloat(f.find("height"), 0.0f), static_cast<std::uint32_t>(type)});
+            });
+        }
+        if (key == "checkpoints") {
+            return readObjectArray(reader, fields, [&](const JsonFields& f) {
+                if (!f.has("x") || !f.has("y") || !f.has("id")) return;
+                records.checkpoints.push_back(LevelBinary::CheckpointRecord{
+                    toFloat(f.find("x"), 0.0f), toFloat(f.find("y"), 0.0f), records.addString(toString(f.find("id")))});
+            });
+        }
+        if (key == "interactiveObjects") {
+            return readObjectArray(reader, fields, [&](const JsonFields& f) {
+                if (!f.has("x") || !f.has("y") || !f.has("width") || !f.has("height") || !f.has("type") || !f.has("id")) {
+                    return;
                 }
-            } else {
-                std::cout << "Warning: Could not find end of platforms array\n";
-            }
-        } else {
-            std::cout << "Warning: Could not find start of platforms array\n";
+                const std::string_view typeVal = f.find("type")->text;
+                InteractiveType type = InteractiveType::Terminal; // Default
+                if (typeVal == "door" || typeVal == "Door") {
+                    type = InteractiveType::Door;
+                } else if (typeVal == "turret" || typeVal == "Turret") {
+                    type = InteractiveType::Turret;
+                }
+                records.interactiveObjects.push_back(LevelBinary::InteractiveRecord{
+                    toFloat(f.find("x"), 0.0f), toFloat(f.find("y"), 0.0f),
+                    toFloat(f.find("width"), 0.0f), toFloat(f.find("height"), 0.0f),
+                    static_cast<std::uint32_t>(type), records.addString(toString(f.find("id")))});
+            });
+        }
+        if (key == "enemies") {
+            return readObjectArray(reader, fields, [&](const JsonFields& f) {
+                LevelBinary::EnemyRecord record;
+                if (readEnemy(f, record)) {
+                    records.enemies.push_back(record);
+                }
+            });
+        }
+        if (key == "cameraZones") {
+            return readObjectArray(reader, fields, [&](const JsonFields& f) {
+                if (!f.has("minX") || !f.has("maxX") || !f.has("minY") || !f.has("maxY")) return;
+                records.cameraZones.push_back(LevelBinary::CameraZoneRecord{
+                    toFloat(f.find("minX"), 0.0f), toFloat(f.find("maxX"), 0.0f),
+                    toFloat(f.find("minY"), 0.0f), toFloat(f.find("maxY"), 0.0f)});
+            });
+        }
+        if (key == "portals") {
+            return readObjectArray(reader, fields, [&](const JsonFields& f) {
+                const std::string targetLevel = toString(f.find("targetLevel"));
+                if (targetLevel.empty()) return;
+                LevelBinary::PortalRecord portal{};
+                portal.x = toFloat(f.find("x"), 0.0f);
+                portal.y = toFloat(f.find("y"), 0.0f);
+                portal.width = toFloat(f.find("width"), 0.0f);
+                if (portal.width <= 0.0f) portal.width = 50.0f;
+                portal.height = toFloat(f.find("height"), 0.0f);
+                if (portal.height <= 0.0f) portal.height = 100.0f;
+                portal.targetLevel = records.addString(targetLevel);
+                const std::string spawnDirection = toString(f.find("spawnDirection"));
+                portal.spawnDirection = records.addString(spawnDirection.empty() ? "default" : spawnDirection);
+                const JsonValue* useCustom = f.find("useCustomSpawn");
+                portal.useCustomSpawn = useCustom && (useCustom->text == "true" || useCustom->text == "True" || useCustom->text == "1");
+                sf::Vector2f customSpawn;
+                if (portal.useCustomSpawn && toVector(f.find("customSpawnPos"), customSpawn)) {
+                    portal.customSpawnX = customSpawn.x;
+                    portal.customSpawnY = customSpawn.y;
+                }
+                records.portals.push_back(portal);
+            });
+        }
+        if (key == "backgroundTiles") {
+            return readObjectArray(reader, fields, [&](const JsonFields& f) {
+                const std::string tile = toString(f.find("tile"));
+                const float width = toFloat(f.find("width"), 32.0f);
+                const float height = toFloat(f.find("height"), 32.0f);
+                if (!tile.empty() && width > 0.0f && height > 0.0f) {
+                    records.backgroundTiles.push_back(LevelBinary::BackgroundTileRecord{
+                        records.addString(tile), toFloat(f.find("x"), 0.0f), toFloat(f.find("y"), 0.0f), width, height});
+                }
+            });
+        }
+        if (key == "nextLevels") {
+            return reader.readArray([&]() {
+                if (!reader.readValue(value)) return false;
+                if (value.kind == JsonValue::Kind::String && !value.text.empty()) {
+                    const std::string levelId = toString(&value);
+                    records.nextLevels.push_back(records.addString(levelId));
+                    std::cout << "  Parsed nextLevel: " << levelId << "\n";
+                }
+                return true;
+            });
         }
-    }
-
-    // Parse checkpoints
-    size_t checkpointsStart = content.find("\"checkpoints\"");
-    size_t checkpointsEnd = content.find("],", checkpointsStart);
-    if (checkpointsEnd == std::string::npos) checkpointsEnd = content.find("]", checkpointsStart);
 
-    if (checkpointsStart != std::string::npos && checkpointsEnd != std::string::npos) {
-        std::string checkpointsSection = content.substr(checkpointsStart, checkpointsEnd - checkpointsStart);
+        // Scalar metadata
+        if (!reader.readValue(value)) return false;
+        const JsonValue* present = value.text.empty() ? nullptr : &value;
+        if (key == "name" && present) {
+            name = value;
+        } else if (key == "levelId" && present) {
+            levelId = value;
+        } else if (key == "zoneNumber" && present) {
+            records.zoneNumber = static_cast<int>(toFloat(present, 1.0f));
+        } else if (key == "sectorSize" && present) {
+            records.sectorSize = toFloat(present, 0.0f);
+        } else if (key == "isBossLevel") {
+            records.isBossLevel = present && (value.text == "true" || value.text == "True" || value.text == "1");
+        } else if (key == "nextZone" && present) {
+            nextZone = value;
+        } else if (key == "startPosition") {
+            sf::Vector2f start;
+            if (toVector(present, start)) {
+                records.startX = start.x;
+                records.startY = start.y;
+            }
+        }
+        return true;
+    });
 
-        size_t pos = 0;
-        while ((pos = checkpointsSection.find("{", pos)) != std::string::npos) {
-            size_t objEnd = checkpointsSection.find("}", pos);
-            if (objEnd == std::string::npos) break;
+    if (!reader.failed() && !reader.atEnd()) {
+        reader.fail("unexpected data after the level object");
+    }
+    if (reader.failed()) {
+        std::size_t line = 0, column = 0;
+        reader.getErrorLocation(line, column);
+        std::cout << "Warning: level parse error in " << filepath << ":" << line << ":" << column
+                  << ": " << reader.getError() << "\n";
+        return false;
+    }
 
-            std::string obj = checkpointsSection.substr(pos, objEnd - pos + 1);
+    records.name = records.addString(toString(&name));
+    records.levelId = records.addString(toString(&levelId));
+    records.nextZone = records.addString(toString(&nextZone));
+    return true;
+}
 
-            std::string xVal = extractValue(obj, "x");
-            std::string yVal = extractValue(obj, "y");
-            std::string idVal = extractValue(obj, "id");
+} // namespace
 
-            if (!xVal.empty() && !yVal.empty() && !idVal.empty()) {
-                float x = parseFloat(xVal);
-                float y = parseFloat(yVal);
-                levelData->checkpoints.push_back(std::make_unique<Checkpoint>(x, y, idVal));
-            }
+std::unique_ptr<LevelData> LevelLoader::loadFromFile(const std::string& filepath, Parser parser) {
+    const char* label = nullptr;
+    std::shared_ptr<const LevelBinary::LevelRecords> records = loadTemplate(filepath, parser, label);
+    if (!records) {
+        std::cout << "Loading default level instead.\n";
+        return createDefaultLevel();
+    }
+    return instantiate(*records, label);
+}
 
-            pos = objEnd + 1;
+std::shared_ptr<const LevelBinary::LevelRecords> LevelLoader::loadTemplate(const std::string& filepath, Parser parser,
+                                                                           const char*& label) {
+    LevelCache& cache = LevelCache::getInstance();
+    LevelCache::Stamp stamp;
+    const bool cacheable = parser == Parser::Auto && LevelCache::getStamp(filepath, stamp);
+    if (cacheable) {
+        if (LevelCache::Template cached = cache.find(filepath, stamp)) {
+            label = "cache";
+            return cached;
         }
     }
 
-    // Parse interactiveObjects (terminals, doors, etc.)
-    size_t interactivesStart = content.find("\"interactiveObjects\"");
-    size_t interactivesEnd = content.find("],", interactivesStart);
-    if (interactivesEnd == std::string::npos) interactivesEnd = content.find("]", interactivesStart);
+    auto records = std::make_shared<LevelBinary::LevelRecords>();
+    if (parser == Parser::Auto && loadCompiled(filepath, *records)) {
+        label = "binary";
+    } else if (!parseSource(filepath, parser, *records, label)) {
+        return nullptr;
+    }
 
-    if (interactivesStart != std::string::npos && interactivesEnd != std::string::npos) {
-        std::string interactivesSection = content.substr(interactivesStart, interactivesEnd - interactivesStart);
+    if (cacheable) {
+        cache.store(filepath, stamp, records);
+    }
+    return records;
+}
 
-        size_t pos = 0;
-        while ((pos = interactivesSection.find("{", pos)) != std::string::npos) {
-            size_t objEnd = interactivesSection.find("}", pos);
-            if (objEnd == std::string::npos) break;
+bool LevelLoader::compileLevel(const std::string& sourcePath, const std::string& outputPath) {
+    LevelBinary::LevelRecords records;
+    const char* label = nullptr;
+    if (!parseSource(sourcePath, Parser::Json, records, label)) {
+        return false;
+    }
+    if (!LevelBinary::write(records, outputPath)) {
+        std::cout << "Warning: Could not write compiled level: " << outputPath << "\n";
+        return false;
+    }
+    return true;
+}
 
-            std::string obj = interactivesSection.substr(pos, objEnd - pos + 1);
+bool LevelLoader::loadCompiled(const std::string& filepath, LevelBinary::LevelRecords& out) {
+    const std::string binaryPath = LevelBinary::pathFor(filepath);
 
-            std::string xVal = extractValue(obj, "x");
-            std::string yVal = extractValue(obj, "y");
-            std::string wVal = extractValue(obj, "width");
-            std::string hVal = extractValue(obj, "height");
-            std::string typeVal = extractValue(obj, "type");
-            std::string idVal = extractValue(obj, "id");
+    AssetPack::DataView packed;
+    if (AssetPack::getInstance().findData(binaryPath, packed)) {
+        if (LevelBinary::read(packed.data, packed.size, out)) {
+            return true;
+        }
+        std::cout << "Warning: ignoring invalid compiled level " << binaryPath << " in the asset pack\n";
+        out = LevelBinary::LevelRecords();
+        return false;
+    }
 
-            if (!xVal.empty() && !yVal.empty() && !wVal.empty() && !hVal.empty() && !typeVal.empty() && !idVal.empty()) {
-                float x = parseFloat(xVal);
-                float y = parseFloat(yVal);
-                float w = parseFloat(wVal);
-                float h = parseFloat(hVal);
-                
-                InteractiveType type = InteractiveType::Terminal; // Default
-                if (typeVal == "terminal" || typeVal == "Terminal") {
-                    type = InteractiveType::Terminal;
-                } else if (typeVal == "door" || typeVal == "Door") {
-                    type = InteractiveType::Door;
-                } else if (typeVal == "turret" || typeVal == "Turret") {
-                    type = InteractiveType::Turret;
-                }
-                
-                levelData->interactiveObjects.push_back(
-                    std::make_unique<InteractiveObject>(x, y, w, h, type, idVal)
-                );
-            }
+    // Loose file: only when at least as recent as its JSON source (editing the JSON wins)
+    namespace fs = std::filesystem;
+    const std::string sourcePath = resolveLevelPath(filepath);
+    const std::string looseBinary = LevelBinary::pathFor(sourcePath);
+    std::error_code ec;
+    const fs::file_time_type binaryTime = fs::last_write_time(looseBinary, ec);
+    if (ec) {
+        return false;
+    }
+    const fs::file_time_type sourceTime = fs::last_write_time(sourcePath, ec);
+    if (!ec && binaryTime < sourceTime) {
+        return false;
+    }
 
-            pos = objEnd + 1;
-        }
+    if (!LevelBinary::readFile(looseBinary, out)) {
+        std::cout << "Warning: ignoring invalid or outdated compiled level " << looseBinary << "\n";
+        out = LevelBinary::LevelRecords();
+        return false;
     }
+    return true;
+}
 
-    // Parse enemies
-    size_t enemiesStart = content.find("\"enemies\"");
-    if (enemiesStart != std::string::npos) {
-        size_t arrayStart = content.find("[", enemiesStart);
-        if (arrayStart != std::string::npos) {
-            int bracketDepth = 1;
-            size_t enemiesEnd = arrayStart + 1;
-            while (enemiesEnd < content.length() && bracketDepth > 0) {
-                char c = content[enemiesEnd];
-                if (c == '[') bracketDepth++;
-                else if (c == ']') bracketDepth--;
-                enemiesEnd++;
+bool LevelLoader::parseSource(const std::string& filepath, Parser parser, LevelBinary::LevelRecords& out,
+                              const char*& label) {
+    // Baked levels are parsed straight from the mapped pack: no copy of the level text
+    std::string storage;
+    std::string_view content;
+    AssetPack::DataView packed;
+    if (AssetPack::getInstance().findData(filepath, packed)) {
+        content = std::string_view(reinterpret_cast<const char*>(packed.data), packed.size);
+    } else {
+        std::string resolvedPath = resolveLevelPath(filepath);
+        std::ifstream file(resolvedPath);
+        if (!file.is_open()) {
+            // Fallback to original path if resolution failed
+            if (resolvedPath != filepath) {
+                file.open(filepath);
             }
+        }
 
-            if (bracketDepth == 0) {
-                std::string enemiesSection = content.substr(arrayStart, enemiesEnd - arrayStart);
-                size_t pos = 0;
-                auto parseBool = [](const std::string& val, bool defaultValue) {
-                    if (val.empty()) return defaultValue;
-                    std::string lower = val;
-                    std::transform(lower.begin(), lower.end(), lower.begin(), ::tolower);
-                    if (lower == "true" || lower == "1") return true;
-                    if (lower == "false" || lower == "0") return false;
-                    return defaultValue;
-                };
-
-                auto parseDirection = [](const std::string& dir) {
-                    std::string lower = dir;
-                    std::transform(lower.begin(), lower.end(), lower.begin(), ::tolower);
-                    if (lower == "left") return FlameDirection::Left;
-                    if (lower == "up") return FlameDirection::Up;
-                    if (lower == "down") return FlameDirection::Down;
-                    return FlameDirection::Right;
-                };
-
-                while ((pos = enemiesSection.find("{", pos)) != std::string::npos) {
-                    size_t objEnd = enemiesSection.find("}", pos);
-                    if (objEnd == std::string::npos) break;
-
-                    std::string obj = enemiesSection.substr(pos, objEnd - pos + 1);
-                    pos = objEnd + 1;
-
-                    std::string typeVal = extractValue(obj, "type");
-                    std::string xVal = extractValue(obj, "x");
-                    std::string yVal = extractValue(obj, "y");
-                    if (typeVal.empty() || xVal.empty() || yVal.empty()) {
-                        continue;
-                    }
-
-                    float x = parseFloat(xVal);
-                    float y = parseFloat(yVal);
-
-                    if (typeVal == "patrol") {
-                        std::string patrolDistVal = extractValue(obj, "patrolDistance");
-                        float patrolDistance = patrolDistVal.empty() ? 100.0f : parseFloat(patrolDistVal);
-                        EnemyStats stats = EnemyPresets::Basic();
-                        std::string maxHpVal = extractValue(obj, "maxHP");
-                        if (!maxHpVal.empty()) stats.maxHP = static_cast<int>(parseFloat(maxHpVal));
-                        std::string sizeXVal = extractValue(obj, "sizeX");
-                        if (!sizeXVal.empty()) stats.sizeX = parseFloat(sizeXVal);
-                        std::string sizeYVal = extractValue(obj, "sizeY");
-                        if (!sizeYVal.empty()) stats.sizeY = parseFloat(sizeYVal);
-                        std::string speedVal = extractValue(obj, "speed");
-                        if (!speedVal.empty()) stats.speed = parseFloat(speedVal);
-                        std::string damageVal = extractValue(obj, "damage");
-                        if (!damageVal.empty()) stats.damage = static_cast<int>(parseFloat(damageVal));
-                        stats.canShoot = parseBool(extractValue(obj, "canShoot"), stats.canShoot);
-                        if (stats.canShoot) {
-                            std::string cooldownVal = extractValue(obj, "shootCooldown");
-                            if (!cooldownVal.empty()) stats.shootCooldown = parseFloat(cooldownVal);
-                            std::string projSpeedVal = extractValue(obj, "projectileSpeed");
-                            if (!projSpeedVal.empty()) stats.projectileSpeed = parseFloat(projSpeedVal);
-                            std::string projRangeVal = extractValue(obj, "projectileRange");
-                            if (!projRangeVal.empty()) stats.projectileRange = parseFloat(projRangeVal);
-                            std::string shootRangeVal = extractValue(obj, "shootRange");
-                            if (!shootRangeVal.empty()) stats.shootRange = parseFloat(shootRangeVal);
-                        }
-                        std::string colorRVal = extractValue(obj, "colorR");
-                        if (!colorRVal.empty()) stats.color.r = static_cast<sf::Uint8>(parseFloat(colorRVal));
-                        std::string colorGVal = extractValue(obj, "colorG");
-                        if (!colorGVal.empty()) stats.color.g = static_cast<sf::Uint8>(parseFloat(colorGVal));
-                        std::string colorBVal = extractValue(obj, "colorB");
-                        if (!colorBVal.empty()) stats.color.b = static_cast<sf::Uint8>(parseFloat(colorBVal));
-                        levelData->enemies.push_back(std::make_unique<PatrolEnemy>(x, y, patrolDistance, stats));
-                    } else if (typeVal == "flying") {
-                        std::string patrolDistVal = extractValue(obj, "patrolDistance");
-                        float patrolDistance = patrolDistVal.empty() ? 200.0f : parseFloat(patrolDistVal);
-                        bool horizontalPatrol = parseBool(extractValue(obj, "horizontalPatrol"), true);
-                        EnemyStats stats = EnemyPresets::FlyingBasic();
-                        std::string maxHpVal = extractValue(obj, "maxHP");
-                        if (!maxHpVal.empty()) stats.maxHP = static_cast<int>(parseFloat(maxHpVal));
-                        std::string sizeXVal = extractValue(obj, "sizeX");
-                        if (!sizeXVal.empty()) stats.sizeX = parseFloat(sizeXVal);
-                        std::string sizeYVal = extractValue(obj, "sizeY");
-                        if (!sizeYVal.empty()) stats.sizeY = parseFloat(sizeYVal);
-                        std::string speedVal = extractValue(obj, "speed");
-                        if (!speedVal.empty()) stats.speed = parseFloat(speedVal);
-                        std::string damageVal = extractValue(obj, "damage");
-                        if (!damageVal.empty()) stats.damage = static_cast<int>(parseFloat(damageVal));
-                        stats.canShoot = parseBool(extractValue(obj, "canShoot"), stats.canShoot);
-                        if (stats.canShoot) {
-                            std::string cooldownVal = extractValue(obj, "shootCooldown");
-                            if (!cooldownVal.empty()) stats.shootCooldown = parseFloat(cooldownVal);
-                            std::string projSpeedVal = extractValue(obj, "projectileSpeed");
-                            if (!projSpeedVal.empty()) stats.projectileSpeed = parseFloat(projSpeedVal);
-                            std::string projRangeVal = extractValue(obj, "projectileRange");
-                            if (!projRangeVal.empty()) stats.projectileRange = parseFloat(projRangeVal);
-                            std::string shootRangeVal = extractValue(obj, "shootRange");
-                            if (!shootRangeVal.empty()) stats.shootRange = parseFloat(shootRangeVal);
-                        }
-                        std::string colorRVal = extractValue(obj, "colorR");
-                        if (!colorRVal.empty()) stats.color.r = static_cast<sf::Uint8>(parseFloat(colorRVal));
-                        std::string colorGVal = extractValue(obj, "colorG");
-                        if (!colorGVal.empty()) stats.color.g = static_cast<sf::Uint8>(parseFloat(colorGVal));
-                        std::string colorBVal = extractValue(obj, "colorB");
-                        if (!colorBVal.empty()) stats.color.b = static_cast<sf::Uint8>(parseFloat(colorBVal));
-                        levelData->enemies.push_back(std::make_unique<FlyingEnemy>(x, y, patrolDistance, horizontalPatrol, stats));
-                    } else if (typeVal == "spike") {
-                        levelData->enemies.push_back(std::make_unique<Spike>(x, y));
-                    } else if (typeVal == "flameTrap") {
-                        EnemyStats stats = EnemyPresets::FlameHorizontal();
-                        std::string maxHpVal = extractValue(obj, "maxHP");
-                        if (!maxHpVal.empty()) stats.maxHP = static_cast<int>(parseFloat(maxHpVal));
-                        std::string sizeXVal = extractValue(obj, "sizeX");
-                        if (!sizeXVal.empty()) stats.sizeX = parseFloat(sizeXVal);
-                        std::string sizeYVal = extractValue(obj, "sizeY");
-                        if (!sizeYVal.empty()) stats.sizeY = parseFloat(sizeYVal);
-                        std::string damageVal = extractValue(obj, "damage");
-                        if (!damageVal.empty()) stats.damage = static_cast<int>(parseFloat(damageVal));
-                        std::string colorRVal = extractValue(obj, "colorR");
-                        if (!colorRVal.empty()) stats.color.r = static_cast<sf::Uint8>(parseFloat(colorRVal));
-                        std::string colorGVal = extractValue(obj, "colorG");
-                        if (!colorGVal.empty()) stats.color.g = static_cast<sf::Uint8>(parseFloat(colorGVal));
-                        std::string colorBVal = extractValue(obj, "colorB");
-                        if (!colorBVal.empty()) stats.color.b = static_cast<sf::Uint8>(parseFloat(colorBVal));
-                        auto flame = std::make_unique<FlameTrap>(x, y, stats);
-                        flame->setDirection(parseDirection(extractValue(obj, "direction")));
-                        std::string activeVal = extractValue(obj, "activeDuration");
-                        if (!activeVal.empty()) flame->setActiveDuration(parseFloat(activeVal));
-                        std::string inactiveVal = extractValue(obj, "inactiveDuration");
-                        if (!inactiveVal.empty()) flame->setInactiveDuration(parseFloat(inactiveVal));
-                        std::string intervalVal = extractValue(obj, "shotInterval");
-                        if (!intervalVal.empty()) flame->setShotInterval(parseFloat(intervalVal));
-                        std::string projSpeedVal = extractValue(obj, "projectileSpeed");
-                        if (!projSpeedVal.empty()) flame->setProjectileSpeed(parseFloat(projSpeedVal));
-                        std::string projRangeVal = extractValue(obj, "projectileRange");
-                        if (!projRangeVal.empty()) flame->setProjectileRange(parseFloat(projRangeVal));
-                        levelData->enemies.push_back(std::move(flame));
-                    } else if (typeVal == "rotatingTrap") {
-                        EnemyStats stats = EnemyPresets::RotatingSlow();
-                        std::string maxHpVal = extractValue(obj, "maxHP");
-                        if (!maxHpVal.empty()) stats.maxHP = static_cast<int>(parseFloat(maxHpVal));
-                        std::string sizeXVal = extractValue(obj, "sizeX");
-                        if (!sizeXVal.empty()) stats.sizeX = parseFloat(sizeXVal);
-                        std::string sizeYVal = extractValue(obj, "sizeY");
-                        if (!sizeYVal.empty()) stats.sizeY = parseFloat(sizeYVal);
-                        std::string damageVal = extractValue(obj, "damage");
-                        if (!damageVal.empty()) stats.damage = static_cast<int>(parseFloat(damageVal));
-                        std::string colorRVal = extractValue(obj, "colorR");
-                        if (!colorRVal.empty()) stats.color.r = static_cast<sf::Uint8>(parseFloat(colorRVal));
-                        std::string colorGVal = extractValue(obj, "colorG");
-                        if (!colorGVal.empty()) stats.color.g = static_cast<sf::Uint8>(parseFloat(colorGVal));
-                        std::string colorBVal = extractValue(obj, "colorB");
-                        if (!colorBVal.empty()) stats.color.b = static_cast<sf::Uint8>(parseFloat(colorBVal));
-                        auto trap = std::make_unique<RotatingTrap>(x, y, stats);
-                        std::string rotSpeedVal = extractValue(obj, "rotationSpeed");
-                        if (!rotSpeedVal.empty()) trap->setRotationSpeed(parseFloat(rotSpeedVal));
-                        std::string armLenVal = extractValue(obj, "armLength");
-                        if (!armLenVal.empty()) trap->setArmLength(parseFloat(armLenVal));
-                        std::string armThickVal = extractValue(obj, "armThickness");
-                        if (!armThickVal.empty()) trap->setArmThickness(parseFloat(armThickVal));
-                        levelData->enemies.push_back(std::move(trap));
-                    }
-                }
-            } else {
-                std::cout << "Warning: Could not find end of enemies array\n";
-            }
-        } else {
-            std::cout << "Warning: Could not find start of enemies array\n";
+        if (!file.is_open()) {
+            std::cout << "Warning: Could not open level file: " << resolvedPath << "\n";
+            return false;
         }
+
+        // Read entire file
+        std::stringstream buffer;
+        buffer << file.rdbuf();
+        storage = buffer.str();
+        content = storage;
     }
 
-    // Parse camera zones
-    size_t cameraStart = content.find("\"cameraZones\"");
-    size_t cameraEnd = content.find("],", cameraStart);
-    if (cameraEnd == std::string::npos) cameraEnd = content.find("]", cameraStart);
+#if LEVEL_LOADER_HAS_JSON
+    // Preferred path: modern, robust JSON parsing via nlohmann/json
+    if (parser != Parser::Legacy) {
+        try {
+            parseJsonRecords(content, out);
+            label = "json";
+            return true;
+        } catch (const std::exception& e) {
+            std::cout << "Warning: JSON parse failed for level '" << filepath
+                      << "': " << e.what() << "\n";
+            std::cout << "Falling back to legacy string parser.\n";
+            out = LevelBinary::LevelRecords();
+        }
+    }
+#else
+    (void)parser;
+#endif // LEVEL_LOADER_HAS_JSON
 
-    if (cameraStart != std::string::npos && cameraEnd != std::string::npos) {
-        std::string cameraSection = content.substr(cameraStart, cameraEnd - cameraStart);
+    // Built-in single-pass reader (kept as robust fallback)
+    label = nullptr;
+    return readLevelRecords(content, filepath, out);
+}
 
-        size_t pos = 0;
-        while ((pos = cameraSection.find("{", pos)) != std::string::npos) {
-            size_t objEnd = cameraSection.find("}", pos);
-            if (objEnd == std::string::npos) break;
+std::unique_ptr<LevelData> LevelLoader::instantiate(const LevelBinary::LevelRecords& records, const char* label) {
+    auto levelData = std::make_unique<LevelData>();
+    levelData->name = records.getString(records.name);
+    levelData->levelId = records.getString(records.levelId);
+    levelData->zoneNumber = records.zoneNumber;
+    levelData->isBossLevel = records.isBossLevel;
+    levelData->sectorSize = records.sectorSize > 0.0f ? records.sectorSize : 0.0f;
+    levelData->nextZone = records.getString(records.nextZone);
+    levelData->startPosition = sf::Vector2f(records.startX, records.startY);
+
+    levelData->nextLevels.reserve(records.nextLevels.size());
+    for (const LevelBinary::StringRef& next : records.nextLevels) {
+        levelData->nextLevels.push_back(records.getString(next));
+    }
 
-            std::string obj = cameraSection.substr(pos, objEnd - pos + 1);
+    levelData->platforms.reserve(records.platforms.size());
+    for (const LevelBinary::PlatformRecord& p : records.platforms) {
+        levelData->platforms.push_back(std::make_unique<Platform>(p.x, p.y, p.width, p.height,
+                                                                  static_cast<Platform::Type>(p.type)));
+    }
 
-            std::string minXVal = extractValue(obj, "minX");
-            std::string maxXVal = extractValue(obj, "maxX");
-            std::string minYVal = extractValue(obj, "minY");
-            std::string maxYVal = extractValue(obj, "maxY");
+    levelData->checkpoints.reserve(records.checkpoints.size());
+    for (const LevelBinary::CheckpointRecord& c : records.checkpoints) {
+        levelData->checkpoints.push_back(std::make_unique<Checkpoint>(c.x, c.y, records.getString(c.id)));
+    }
 
-            if (!minXVal.empty() && !maxXVal.empty() && !minYVal.empty() && !maxYVal.empty()) {
-                CameraZone zone;
-                zone.minX = parseFloat(minXVal);
-                zone.maxX = parseFloat(maxXVal);
-                zone.minY = parseFloat(minYVal);
-                zone.maxY = parseFloat(maxYVal);
-                levelData->cameraZones.push_back(zone);
-            }
+    levelData->interactiveObjects.reserve(records.interactiveObjects.size());
+    for (const LevelBinary::InteractiveRecord& io : records.interactiveObjects) {
+        levelData->interactiveObjects.push_back(std::make_unique<InteractiveObject>(
+            io.x, io.y, io.width, io.height, static_cast<InteractiveType>(io.type), records.getString(io.id)));
+    }
 
-            pos = objEnd + 1;
+    levelData->enemies.reserve(records.enemies.size());
+    for (const LevelBinary::EnemyRecord& e : records.enemies) {
+        if (std::unique_ptr<Enemy> enemy = makeEnemy(e)) {
+            levelData->enemies.push_back(std::move(enemy));
         }
     }
 
-    // Portals (legacy parsing - simple extraction)
-    size_t portalsStart = content.find("\"portals\"");
-    if (portalsStart != std::string::npos) {
-        size_t arrayStart = content.find("[", portalsStart);
-        if (arrayStart != std::string::npos) {
-            int bracketDepth = 1;
-            size_t arrayEnd = arrayStart + 1;
-            while (arrayEnd < content.length() && bracketDepth > 0) {
-                if (content[arrayEnd] == '[') bracketDepth++;
-                else if (content[arrayEnd] == ']') bracketDepth--;
-                if (bracketDepth > 0) arrayEnd++;
-            }
-            
-            if (arrayEnd < content.length() && bracketDepth == 0) {
-                std::string portalsSection = content.substr(arrayStart, arrayEnd - arrayStart);
-                size_t pos = 0;
-                while ((pos = portalsSection.find("{", pos)) != std::string::npos) {
-                    size_t objEnd = portalsSection.find("}", pos);
-                    if (objEnd == std::string::npos) break;
-                    
-                    std::string obj = portalsSection.substr(pos, objEnd - pos + 1);
-                    
-                    Portal portal{};
-                    portal.x = parseFloat(extractValue(obj, "x"));
-                    portal.y = parseFloat(extractValue(obj, "y"));
-                    portal.width = parseFloat(extractValue(obj, "width"));
-                    if (portal.width <= 0.0f) portal.width = 50.0f;
-                    portal.height = parseFloat(extractValue(obj, "height"));
-                    if (portal.height <= 0.0f) portal.height = 100.0f;
-                    portal.targetLevel = extractValue(obj, "targetLevel");
-                    portal.spawnDirection = extractValue(obj, "spawnDirection");
-                    if (portal.spawnDirection.empty()) portal.spawnDirection = "default";
-                    
-                    std::string useCustomStr = extractValue(obj, "useCustomSpawn");
-                    portal.useCustomSpawn = (useCustomStr == "true" || useCustomStr == "True" || useCustomStr == "1");
-                    if (portal.useCustomSpawn) {
-                        // Try to extract customSpawnPos [x, y]
-                        size_t posArrayStart = obj.find("\"customSpawnPos\"");
-                        if (posArrayStart != std::string::npos) {
-                            size_t posArrayBracket = obj.find("[", posArrayStart);
-                            if (posArrayBracket != std::string::npos) {
-                                size_t posArrayEnd = obj.find("]", posArrayBracket);
-                                if (posArrayEnd != std::string::npos) {
-                                    std::string posArray = obj.substr(posArrayBracket + 1, posArrayEnd - posArrayBracket - 1);
-                                    size_t commaPos = posArray.find(",");
-                                    if (commaPos != std::string::npos) {
-                                        portal.customSpawnPos.x = parseFloat(posArray.substr(0, commaPos));
-                                        portal.customSpawnPos.y = parseFloat(posArray.substr(commaPos + 1));
-                                    }
-                                }
-                            }
-                        }
-                    }
-                    
-                    if (!portal.targetLevel.empty()) {
-                        levelData->portals.push_back(portal);
-                    }
-                    
-                    pos = objEnd + 1;
-                }
-            }
-        }
+    levelData->cameraZones.reserve(records.cameraZones.size());
+    for (const LevelBinary::CameraZoneRecord& cz : records.cameraZones) {
+        levelData->cameraZones.push_back(CameraZone{cz.minX, cz.maxX, cz.minY, cz.maxY});
+    }
+
+    levelData->portals.reserve(records.portals.size());
+    for (const LevelBinary::PortalRecord& p : records.portals) {
+        Portal portal{};
+        portal.x = p.x;
+        portal.y = p.y;
+        portal.width = p.width;
+        portal.height = p.height;
+        portal.targetLevel = records.getString(p.targetLevel);
+        portal.spawnDirection = records.getString(p.spawnDirection);
+        portal.customSpawnPos = sf::Vector2f(p.customSpawnX, p.customSpawnY);
+        portal.useCustomSpawn = p.useCustomSpawn != 0;
+        levelData->portals.push_back(portal);
+    }
+
+    levelData->backgroundTiles.reserve(records.backgroundTiles.size());
+    for (const LevelBinary::BackgroundTileRecord& bt : records.backgroundTiles) {
+        levelData->backgroundTiles.push_back(BackgroundTile{records.getString(bt.tile), bt.x, bt.y, bt.width, bt.height});
     }
 
     // Validation
@@ -886,12 +1081,17 @@ std::unique_ptr<LevelData> LevelLoader::loadFromFile(const std::string& filepath
     }
 
     // Log level load summary (only key info)
-    std::cout << "Level loaded: " << levelData->name;
+    std::cout << "Level loaded";
+    if (label) {
+        std::cout << " (" << label << ")";
+    }
+    std::cout << ": " << levelData->name;
     if (!levelData->levelId.empty()) {
         std::cout << " (ID: " << levelData->levelId << ", Zone: " << levelData->zoneNumber << ")";
     }
     std::cout << "\n";
 
+    levelData->platformIndex.build(levelData->platforms);
     return levelData;
 }
 
@@ -909,25 +1109,6 @@ std::unique_ptr<LevelData> LevelLoader::createDefaultLevel() {
     levelData->platforms.push_back(std::make_unique<Platform>(900.0f, 500.0f, 200.0f, 20.0f));
     levelData->platforms.push_back(std::make_unique<Platform>(1200.0f, 450.0f, 200.0f, 20.0f));
 
+    levelData->platformIndex.build(levelData->platforms);
     return levelData;
 }
-
-std::string LevelLoader::trim(const std::string& str) {
-    size_t first = str.find_first_not_of(" \t\r\n");
-    if (first == std::string::npos) return "";
-    size_t last = str.find_last_not_of(" \t\r\n,");
-    return str.substr(first, last - first + 1);
-}
-
-float LevelLoader::parseFloat(const std::string& str) {
-    std::string cleaned = trim(str);
-    // Remove trailing comma if present
-    if (!cleaned.empty() && cleaned.back() == ',') {
-        cleaned.pop_back();
-    }
-    try {
-        return std::stof(cleaned);
-    } catch (...) {
-        return 0.0f;
-    }
-}
@@ -0,0 +1,132 @@
+#include "world/LevelPrefetcher.h"
+#include "world/LevelLoader.h"
+#include <algorithm>
+#include <iostream>
+
+namespace {
+    template <typename Record>
+    std::size_t sectionBytes(const std::vector<Record>& records) {
+        return records.size() * sizeof(Record);
+    }
+
+    // Heap held by the records (what the memory cap counts)
+    std::size_t estimateBytes(const LevelBinary::LevelRecords& records) {
+        return sectionBytes(records.platforms) + sectionBytes(records.checkpoints) +
+               sectionBytes(records.interactiveObjects) + sectionBytes(records.enemies) +
+               sectionBytes(records.cameraZones) + sectionBytes(records.portals) +
+               sectionBytes(records.backgroundTiles) + sectionBytes(records.nextLevels) +
+               records.strings.size();
+    }
+}
+
+LevelPrefetcher::LevelPrefetcher(std::size_t maxBytes)
+    : maxBytes(maxBytes) {
+    thread = std::thread(&LevelPrefetcher::threadMain, this);
+}
+
+LevelPrefetcher::~LevelPrefetcher() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopRequested = true;
+        queue.clear();
+    }
+    changed.notify_all();
+    // A parse in progress runs to its end: levels are small, and the loader has no abort point
+    thread.join();
+}
+
+void LevelPrefetcher::want(const std::vector<std::string>& paths) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        wanted = paths;
+
+        for (auto it = ready.begin(); it != ready.end();) {
+            if (!isWanted(it->first)) {
+                readyBytes -= it->second.bytes;
+                it = ready.erase(it);
+            } else {
+                ++it;
+            }
+        }
+
+        queue.clear();
+        for (const std::string& path : wanted) {
+            if (path.empty() || path == parsing || ready.count(path) != 0 ||
+                std::find(queue.begin(), queue.end(), path) != queue.end()) {
+                continue;
+            }
+            queue.push_back(path);
+        }
+    }
+    changed.notify_all();
+}
+
+void LevelPrefetcher::clear() {
+    want(std::vector<std::string>());
+}
+
+bool LevelPrefetcher::take(const std::string& path, std::shared_ptr<const LevelBinary::LevelRecords>& out,
+                           const char*& label) {
+    std::unique_lock<std::mutex> lock(mutex);
+    // Cheaper to wait for the parse in progress than to start it again on this thread
+    changed.wait(lock, [&] { return parsing != path || stopRequested; });
+
+    auto it = ready.find(path);
+    if (it == ready.end()) {
+        // The caller loads it itself: the worker must not parse it a second time
+        queue.erase(std::remove(queue.begin(), queue.end(), path), queue.end());
+        return false;
+    }
+
+    out = std::move(it->second.records);
+    label = it->second.label;
+    readyBytes -= it->second.bytes;
+    ready.erase(it);
+    return true;
+}
+
+std::size_t LevelPrefetcher::getReadyBytes() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return readyBytes;
+}
+
+bool LevelPrefetcher::isWanted(const std::string& path) const {
+    return std::find(wanted.begin(), wanted.end(), path) != wanted.end();
+}
+
+void LevelPrefetcher::threadMain() {
+    while (true) {
+        std::string path;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            changed.wait(lock, [this] { return !queue.empty() || stopRequested; });
+            if (stopRequested) break;
+            path = queue.front();
+            queue.pop_front();
+            parsing = path;
+        }
+
+        const char* label = nullptr;
+        std::shared_ptr<const LevelBinary::LevelRecords> records =
+            LevelLoader::loadTemplate(path, LevelLoader::Parser::Auto, label);
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            parsing.clear();
+            // Dropped while parsing (the player went for another portal): nothing to keep
+            if (records && isWanted(path)) {
+                const std::size_t bytes = estimateBytes(*records);
+                if (readyBytes + bytes <= maxBytes) {
+                    Ready& entry = ready[path];
+                    entry.records = std::move(records);
+                    entry.label = label;
+                    entry.bytes = bytes;
+                    readyBytes += bytes;
+                } else {
+                    std::cout << "Prefetch skipped (memory cap): " << path << "\n";
+                }
+            }
+        }
+        changed.notify_all();
+    }
+}
@@ -64,8 +64,8 @@ void Platform::updateSprite() {
         float scaleY = size.y / static_cast<float>(tileH);
         sprite.setScale(1.0f, scaleY);
         sprite.setPosition(position);
-    } else {
-        // Debug: log when texture is missing
+    } else if (tilesetsLoaded) {
+        // Debug: log when texture is missing (tilesets are never loaded in headless mode)
         std::string typeName = (platformType == Type::EndFloor) ? "EndFloor" : "Floor";
         Logger::warning("Texture is nullptr for type " + typeName);
     }
@@ -87,17 +87,42 @@ void Platform::draw(sf::RenderWindow& window) {
         window.draw(sprite);
     } else {
         // Fallback to colored shapes based on type
-        sf::Color color;
-        switch (platformType) {
-            case Type::Floor: color = sf::Color(139, 69, 19); break;  // Brown
-            case Type::EndFloor: color = sf::Color(160, 82, 45); break;  // Sienna (slightly different brown)
-            default: color = sf::Color(139, 69, 19); break;
-        }
-        shape.setFillColor(color);
+        shape.setFillColor(getFallbackColor());
         window.draw(shape);
     }
 }
 
+sf::Color Platform::getFallbackColor() const {
+    switch (platformType) {
+        case Type::Floor: return sf::Color(139, 69, 19);     // Brown
+        case Type::EndFloor: return sf::Color(160, 82, 45);  // Sienna (slightly different brown)
+        default: return sf::Color(139, 69, 19);
+    }
+}
+
+void Platform::appendVertices(sf::VertexArray& vertices) const {
+    const float left = position.x;
+    const float top = position.y;
+    const float right = position.x + size.x;
+    const float bottom = position.y + size.y;
+
+    const sf::Texture* texture = getTexture();
+    if (texture) {
+        // Same mapping as the sprite: texture repeats along the width, one tile high
+        const float tileH = static_cast<float>(texture->getSize().y);
+        vertices.append(sf::Vertex(sf::Vector2f(left, top), sf::Color::White, sf::Vector2f(0.0f, 0.0f)));
+        vertices.append(sf::Vertex(sf::Vector2f(right, top), sf::Color::White, sf::Vector2f(size.x, 0.0f)));
+        vertices.append(sf::Vertex(sf::Vector2f(right, bottom), sf::Color::White, sf::Vector2f(size.x, tileH)));
+        vertices.append(sf::Vertex(sf::Vector2f(left, bottom), sf::Color::White, sf::Vector2f(0.0f, tileH)));
+    } else {
+        const sf::Color color = getFallbackColor();
+        vertices.append(sf::Vertex(sf::Vector2f(left, top), color));
+        vertices.append(sf::Vertex(sf::Vector2f(right, top), color));
+        vertices.append(sf::Vertex(sf::Vector2f(right, bottom), color));
+        vertices.append(sf::Vertex(sf::Vector2f(left, bottom), color));
+    }
+}
+
 sf::FloatRect Platform::getBounds() const {
     return sf::FloatRect(position.x, position.y, size.x, size.y);
 }
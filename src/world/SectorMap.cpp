@@ -0,0 +1,153 @@
+#include "world/SectorMap.h"
+#include "entities/Enemy.h"
+#include "core/Config.h"
+#include "physics/CellKey.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+SectorMap::SectorMap()
+    : sectorSize(0.0f)
+    , hasFocus(false)
+    , focusX(0)
+    , focusY(0) {
+}
+
+void SectorMap::build(float size, const std::vector<std::unique_ptr<Enemy>>& list) {
+    clear();
+    sectorSize = size > 0.0f ? size : 0.0f;
+
+    enemies.reserve(list.size());
+    for (const auto& enemy : list) {
+        enemies.push_back(enemy.get());
+        // Whoever stays asleep must not be drawn between two stale positions
+        if (enemy) enemy->storePreviousPosition();
+    }
+
+    if (!isEnabled()) {
+        // Single implicit sector, always active
+        for (std::size_t i = 0; i < enemies.size(); ++i) {
+            if (!enemies[i]) continue;
+            activeIndices.push_back(static_cast<std::int32_t>(i));
+            activeEnemies.push_back(enemies[i]);
+        }
+        return;
+    }
+
+    enemySectors.assign(enemies.size(), 0);
+    for (std::size_t i = 0; i < enemies.size(); ++i) {
+        if (!enemies[i]) continue;
+        enemySectors[i] = sectorOf(*enemies[i]);
+        buckets[enemySectors[i]].push_back(static_cast<std::int32_t>(i));
+    }
+    // Nothing runs until the first setFocus()
+}
+
+void SectorMap::clear() {
+    sectorSize = 0.0f;
+    enemies.clear();
+    enemySectors.clear();
+    buckets.clear();
+    activeSectors.clear();
+    activeIndices.clear();
+    previousIndices.clear();
+    activeEnemies.clear();
+    hasFocus = false;
+}
+
+void SectorMap::setFocus(const sf::Vector2f& focus) {
+    if (!isEnabled()) {
+        return;
+    }
+
+    const int sx = static_cast<int>(std::floor(focus.x / sectorSize));
+    const int sy = static_cast<int>(std::floor(focus.y / sectorSize));
+    if (hasFocus && sx == focusX && sy == focusY) {
+        return;
+    }
+    hasFocus = true;
+    focusX = sx;
+    focusY = sy;
+
+    // Sleep: only sectors past the eviction radius (the band in between keeps its state)
+    for (auto it = activeSectors.begin(); it != activeSectors.end();) {
+        const int x = CellKey::unpackX(*it);
+        const int y = CellKey::unpackY(*it);
+        if (std::max(std::abs(x - sx), std::abs(y - sy)) > Config::SECTOR_EVICT_RADIUS) {
+            it = activeSectors.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    // Wake: everything within the activation radius
+    for (int y = sy - Config::SECTOR_ACTIVE_RADIUS; y <= sy + Config::SECTOR_ACTIVE_RADIUS; ++y) {
+        for (int x = sx - Config::SECTOR_ACTIVE_RADIUS; x <= sx + Config::SECTOR_ACTIVE_RADIUS; ++x) {
+            activeSectors.insert(key(x, y));
+        }
+    }
+
+    refreshActiveEnemies();
+}
+
+void SectorMap::updateMembership() {
+    if (!isEnabled()) {
+        return;
+    }
+
+    bool moved = false;
+    for (std::int32_t index : activeIndices) {
+        const std::int64_t sector = sectorOf(*enemies[index]);
+        std::int64_t& current = enemySectors[index];
+        if (sector == current) continue;
+
+        std::vector<std::int32_t>& from = buckets[current];
+        from.erase(std::find(from.begin(), from.end(), index));
+        buckets[sector].push_back(index);
+        current = sector;
+        moved = true;
+    }
+
+    // An enemy that walked into a sleeping sector goes to sleep with it
+    if (moved) {
+        refreshActiveEnemies();
+    }
+}
+
+std::int64_t SectorMap::key(int sx, int sy) {
+    return CellKey::pack(sx, sy);
+}
+
+std::int64_t SectorMap::sectorOf(const Enemy& enemy) const {
+    const sf::Vector2f position = enemy.getPosition();
+    const sf::Vector2f size = enemy.getSize();
+    return key(static_cast<int>(std::floor((position.x + size.x * 0.5f) / sectorSize)),
+               static_cast<int>(std::floor((position.y + size.y * 0.5f) / sectorSize)));
+}
+
+void SectorMap::refreshActiveEnemies() {
+    previousIndices.swap(activeIndices);
+    activeIndices.clear();
+    for (std::int64_t sector : activeSectors) {
+        auto it = buckets.find(sector);
+        if (it != buckets.end()) {
+            activeIndices.insert(activeIndices.end(), it->second.begin(), it->second.end());
+        }
+    }
+    // List order keeps the simulation deterministic (projectile spawn order)
+    std::sort(activeIndices.begin(), activeIndices.end());
+
+    activeEnemies.clear();
+    for (std::int32_t index : activeIndices) {
+        activeEnemies.push_back(enemies[index]);
+    }
+
+    // Falling asleep: interpolation would keep drawing the enemy between its last two ticks
+    auto active = activeIndices.begin();
+    for (std::int32_t index : previousIndices) {
+        while (active != activeIndices.end() && *active < index) ++active;
+        if (active == activeIndices.end() || *active != index) {
+            enemies[index]->storePreviousPosition();
+        }
+    }
+}